@@ -0,0 +1,183 @@
+// --- aurum-bench-allocators ---
+// Compares SmallObjectAllocator and ObjectPool with malloc/free on
+// multithreaded alloc/free patterns:
+//   churn        each thread replaces random slots of a live working set
+//   cross-thread each thread frees the blocks its neighbour allocated
+//   pool         single-thread ObjectPool<T> vs new/delete
+//
+// Usage: aurum-bench-allocators [--threads N] [--ops N] [--live N]
+
+#include <algorithm>
+#include <barrier>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <Framework/ObjectPool.hpp>
+#include <Framework/SmallObjectAllocator.hpp>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+    using namespace Aurum;
+
+    struct MallocBackend
+    {
+        static constexpr const char* kName = "malloc";
+        static void* Allocate(std::size_t size) { return std::malloc(size); }
+        static void Free(void* memory, std::size_t) { std::free(memory); }
+    };
+
+    struct SmallObjectBackend
+    {
+        static constexpr const char* kName = "small objects";
+        static void* Allocate(std::size_t size) { return SmallObjectAllocator::Get().Allocate(size); }
+        static void Free(void* memory, std::size_t size) { SmallObjectAllocator::Get().Deallocate(memory, size); }
+    };
+
+    // Sizes skewed toward small blocks, like events and components
+    std::vector<std::size_t> MakeSizes(std::size_t count, unsigned seed)
+    {
+        std::mt19937 rng(seed);
+        std::geometric_distribution<int> shift(0.45);
+        std::vector<std::size_t> sizes(count);
+        for (std::size_t& size : sizes)
+            size = std::min<std::size_t>(16u << std::min(shift(rng), 5), 512) - (rng() % 8);
+        return sizes;
+    }
+
+    template <typename Backend>
+    double Churn(int threads, std::size_t ops, std::size_t live)
+    {
+        std::vector<std::thread> workers;
+        const auto start = Clock::now();
+        for (int t = 0; t < threads; ++t)
+        {
+            workers.emplace_back([=] {
+                const std::vector<std::size_t> sizes = MakeSizes(ops + live, 1234u + t);
+                std::vector<std::pair<void*, std::size_t>> slots(live);
+                for (std::size_t i = 0; i < live; ++i)
+                    slots[i] = { Backend::Allocate(sizes[i]), sizes[i] };
+
+                std::mt19937 rng(99u + t);
+                for (std::size_t i = 0; i < ops; ++i)
+                {
+                    auto& slot = slots[rng() % live];
+                    Backend::Free(slot.first, slot.second);
+                    slot = { Backend::Allocate(sizes[live + i]), sizes[live + i] };
+                    *static_cast<volatile char*>(slot.first) = 1;
+                }
+                for (auto& slot : slots)
+                    Backend::Free(slot.first, slot.second);
+            });
+        }
+        for (std::thread& worker : workers)
+            worker.join();
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / (double(ops) * threads);
+    }
+
+    template <typename Backend>
+    double CrossThread(int threads, std::size_t ops, std::size_t live)
+    {
+        const std::size_t rounds = std::max<std::size_t>(1, ops / live);
+        std::vector<std::vector<std::pair<void*, std::size_t>>> handoff(threads);
+        std::barrier sync(threads);
+
+        std::vector<std::thread> workers;
+        const auto start = Clock::now();
+        for (int t = 0; t < threads; ++t)
+        {
+            workers.emplace_back([&, t] {
+                const std::vector<std::size_t> sizes = MakeSizes(live, 777u + t);
+                for (std::size_t round = 0; round < rounds; ++round)
+                {
+                    auto& mine = handoff[t];
+                    mine.resize(live);
+                    for (std::size_t i = 0; i < live; ++i)
+                        mine[i] = { Backend::Allocate(sizes[i]), sizes[i] };
+                    sync.arrive_and_wait();
+
+                    // Free the neighbour's blocks
+                    for (auto& block : handoff[(t + 1) % threads])
+                        Backend::Free(block.first, block.second);
+                    sync.arrive_and_wait();
+                }
+            });
+        }
+        for (std::thread& worker : workers)
+            worker.join();
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / (double(rounds) * live * threads);
+    }
+
+    struct Node
+    {
+        float position[3];
+        float velocity[3];
+        Node* parent;
+        std::uint32_t flags;
+    };
+
+    template <typename CreateFn, typename DestroyFn>
+    double PoolPattern(std::size_t ops, std::size_t live, CreateFn&& create, DestroyFn&& destroy)
+    {
+        std::vector<Node*> nodes(live);
+        for (Node*& node : nodes)
+            node = create();
+
+        std::mt19937 rng(5);
+        const auto start = Clock::now();
+        for (std::size_t i = 0; i < ops; ++i)
+        {
+            Node*& node = nodes[rng() % live];
+            destroy(node);
+            node = create();
+            node->flags = static_cast<std::uint32_t>(i);
+        }
+        const double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / double(ops);
+
+        for (Node* node : nodes)
+            destroy(node);
+        return ns;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    int maxThreads = std::max(2u, std::min(8u, std::thread::hardware_concurrency()));
+    std::size_t ops = 2'000'000;
+    std::size_t live = 4096;
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        const std::string arg = argv[i];
+        if (arg == "--threads") maxThreads = std::max(1, std::atoi(argv[i + 1]));
+        else if (arg == "--ops") ops = std::max<std::size_t>(1000, std::strtoull(argv[i + 1], nullptr, 10));
+        else if (arg == "--live") live = std::max<std::size_t>(16, std::strtoull(argv[i + 1], nullptr, 10));
+    }
+
+    std::printf("Allocator benchmark: %zu ops per thread, %zu live blocks, ns per alloc+free\n", ops, live);
+    std::printf("  %-14s %-8s %12s %12s\n", "pattern", "threads", "malloc", "small objs");
+    for (int threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        std::printf("  %-14s %-8d %12.2f %12.2f\n", "churn", threads,
+                    Churn<MallocBackend>(threads, ops, live), Churn<SmallObjectBackend>(threads, ops, live));
+    }
+    for (int threads = 2; threads <= maxThreads; threads *= 2)
+    {
+        std::printf("  %-14s %-8d %12.2f %12.2f\n", "cross-thread", threads,
+                    CrossThread<MallocBackend>(threads, ops, live), CrossThread<SmallObjectBackend>(threads, ops, live));
+    }
+
+    ObjectPool<Node> pool("Benchmark Nodes");
+    const double heap = PoolPattern(ops, live, [] { return new Node(); }, [](Node* node) { delete node; });
+    const double pooled = PoolPattern(ops, live, [&] { return pool.Create(); }, [&](Node* node) { pool.Destroy(node); });
+    std::printf("\n  ObjectPool<Node> (%zu bytes): new/delete %.2f ns, pool %.2f ns\n", sizeof(Node), heap, pooled);
+
+    const MemoryPoolStats stats = SmallObjectAllocator::Get().GetPoolStats();
+    std::printf("  Small objects: %.2f MiB committed, %.2f MiB peak outstanding, %llu allocations\n",
+                stats.committedBytes / 1048576.0, stats.peakBytes / 1048576.0,
+                static_cast<unsigned long long>(stats.allocations));
+    return 0;
+}
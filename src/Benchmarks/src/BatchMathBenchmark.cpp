@@ -0,0 +1,221 @@
+// --- aurum-bench-batch ---
+// Compares the SoA batch kernels (every backend this CPU supports) with
+// the scalar AoS path, Matrix4x4::TransformPoint over a Vector3 array.
+// Checks each backend against the scalar SoA backend bit for bit first,
+// on the full set and on every small count that ends in a masked tail,
+// then reports points per second on one core.
+//
+// Usage: aurum-bench-batch [--count N] [--iterations N]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+#include <Framework/Math/Math.hpp>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+    using namespace Aurum;
+
+    volatile float g_sink = 0.0f;
+
+    struct Inputs
+    {
+        Matrix4x4 matrix;
+        std::vector<Matrix4x4> matrices;
+        std::vector<Vector3> points;        // AoS copy of the same data
+        Float3Buffer soa;
+        Float3Buffer mins, maxs;
+        std::vector<float> qw, qx, qy, qz;
+    };
+
+    Inputs MakeInputs(std::size_t count)
+    {
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> value(-100.0f, 100.0f);
+        std::uniform_real_distribution<float> size(0.0f, 10.0f);
+
+        Inputs in;
+        for (int i = 0; i < 4; ++i)
+            for (int j = 0; j < 4; ++j)
+                in.matrix.m[i][j] = value(rng);
+        in.matrices.resize(count);
+        for (Matrix4x4& m : in.matrices)
+            for (int i = 0; i < 4; ++i)
+                for (int j = 0; j < 4; ++j)
+                    m.m[i][j] = value(rng);
+
+        in.points.resize(count);
+        in.soa.Resize(count);
+        in.mins.Resize(count);
+        in.maxs.Resize(count);
+        in.qw.resize(count); in.qx.resize(count); in.qy.resize(count); in.qz.resize(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            // Some zero vectors for the normalize edge case
+            const Vector3 p = (rng() % 16 == 0) ? Vector3() : Vector3(value(rng), value(rng), value(rng));
+            in.points[i] = p;
+            in.soa.Set(i, p);
+            in.mins.Set(i, p);
+            in.maxs.Set(i, Vector3(p.x + size(rng), p.y + size(rng), p.z + size(rng)));
+
+            const Quaternion q = Quaternion(value(rng), value(rng), value(rng), value(rng)).Normalized();
+            in.qw[i] = q.w; in.qx[i] = q.x; in.qy[i] = q.y; in.qz[i] = q.z;
+        }
+        return in;
+    }
+
+    // Runs every kernel once into a flat result buffer. Outputs get
+    // `padding` extra elements holding a marker, returned with the rest,
+    // so a tail that stores past `count` shows up as a difference.
+    std::vector<float> RunAll(const Inputs& in, std::size_t count, std::size_t padding = 0)
+    {
+        const std::size_t size = count + padding;
+        Float3Buffer a(size), b(size), c(size), d(size), e(size), f(size);
+        for (Float3Buffer* buffer : {&a, &b, &c, &d, &e, &f})
+        {
+            for (std::size_t i = count; i < size; ++i)
+                buffer->Set(i, Vector3(-1234.5f, -1234.5f, -1234.5f));
+        }
+        const ConstQuaternionStream q{in.qw.data(), in.qx.data(), in.qy.data(), in.qz.data()};
+        BatchMath::TransformPoints(in.matrix, in.soa.Stream(), a.Stream(), count);
+        BatchMath::TransformPoints(in.matrices.data(), in.soa.Stream(), b.Stream(), count);
+        BatchMath::Normalize(in.soa.Stream(), c.Stream(), count);
+        BatchMath::Rotate(q, in.soa.Stream(), d.Stream(), count);
+        BatchMath::TransformAabbs(in.matrix, in.mins.Stream(), in.maxs.Stream(), e.Stream(), f.Stream(), count);
+
+        std::vector<float> out;
+        for (const Float3Buffer* buffer : {&a, &b, &c, &d, &e, &f})
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                const Vector3 v = buffer->Get(i);
+                out.insert(out.end(), {v.x, v.y, v.z});
+            }
+        }
+        return out;
+    }
+
+    template <typename Fn>
+    double PointsPerSecond(std::size_t count, int iterations, Fn&& fn)
+    {
+        std::vector<double> samples;
+        for (int it = 0; it < iterations; ++it)
+        {
+            const auto start = Clock::now();
+            fn();
+            samples.push_back(double(count) / std::chrono::duration<double>(Clock::now() - start).count());
+        }
+        std::sort(samples.begin(), samples.end());
+        return samples[samples.size() / 2];
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t count = (1 << 20) + 3;     // Odd, so the full run ends in a tail too
+    int iterations = 20;
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        const std::string arg = argv[i];
+        if (arg == "--count") count = std::max<std::size_t>(1, std::strtoull(argv[i + 1], nullptr, 10));
+        else if (arg == "--iterations") iterations = std::max(1, std::atoi(argv[i + 1]));
+    }
+
+    const Inputs in = MakeInputs(count);
+    const BatchMathBackend detected = BatchMath::GetBackend();
+    std::vector<BatchMathBackend> backends;
+    for (BatchMathBackend backend : {BatchMathBackend::Scalar, BatchMathBackend::Avx2, BatchMathBackend::Avx512})
+    {
+        if (BatchMath::IsSupported(backend))
+            backends.push_back(backend);
+    }
+
+    std::printf("Batch math: %zu points, dispatcher picked %s\n", count, BatchMath::GetBackendName(detected));
+
+    // --- Bit-exactness: each backend vs scalar SoA, and SoA vs AoS ---
+    bool exact = true;
+    BatchMath::SetBackend(BatchMathBackend::Scalar);
+    const std::vector<float> reference = RunAll(in, count);
+    {
+        std::size_t mismatches = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const Vector3 p = in.matrix.TransformPoint(in.points[i]);
+            mismatches += std::memcmp(&p.x, &reference[3 * i], 3 * sizeof(float)) != 0;
+        }
+        std::printf("  %-10s vs AoS TransformPoint: %s (%zu differ)\n", "Scalar", mismatches ? "MISMATCH" : "bit-exact", mismatches);
+        exact &= mismatches == 0;
+    }
+    for (BatchMathBackend backend : backends)
+    {
+        if (backend == BatchMathBackend::Scalar)
+            continue;
+        BatchMath::SetBackend(backend);
+        const std::vector<float> result = RunAll(in, count);
+        const bool same = std::memcmp(result.data(), reference.data(), result.size() * sizeof(float)) == 0;
+        std::printf("  %-10s vs Scalar, all kernels: %s\n", BatchMath::GetBackendName(backend), same ? "bit-exact" : "MISMATCH");
+        exact &= same;
+    }
+
+    // --- Tails: every count up to two AVX-512 vectors plus one ---
+    constexpr std::size_t kMaxTailCount = 33;
+    constexpr std::size_t kPadding = 16;
+    std::vector<std::vector<float>> tailReference;
+    BatchMath::SetBackend(BatchMathBackend::Scalar);
+    for (std::size_t n = 1; n <= kMaxTailCount; ++n)
+        tailReference.push_back(RunAll(MakeInputs(n), n, kPadding));
+    for (BatchMathBackend backend : backends)
+    {
+        if (backend == BatchMathBackend::Scalar)
+            continue;
+        BatchMath::SetBackend(backend);
+        std::size_t mismatches = 0;
+        for (std::size_t n = 1; n <= kMaxTailCount; ++n)
+        {
+            const std::vector<float> result = RunAll(MakeInputs(n), n, kPadding);
+            mismatches += std::memcmp(result.data(), tailReference[n - 1].data(), result.size() * sizeof(float)) != 0;
+        }
+        std::printf("  %-10s vs Scalar, counts 1-%zu: %s (%zu differ)\n", BatchMath::GetBackendName(backend), kMaxTailCount,
+                    mismatches ? "MISMATCH" : "bit-exact", mismatches);
+        exact &= mismatches == 0;
+    }
+
+    // --- Throughput ---
+    Float3Buffer out(count), outMax(count);
+    std::vector<Vector3> aos(count);
+    const ConstQuaternionStream q{in.qw.data(), in.qx.data(), in.qy.data(), in.qz.data()};
+
+    const double aosRate = PointsPerSecond(count, iterations, [&] {
+        for (std::size_t i = 0; i < count; ++i)
+            aos[i] = in.matrix.TransformPoint(in.points[i]);
+    });
+    g_sink = g_sink + aos[count / 2].x;
+
+    std::printf("\n  %-22s %14s\n", "AoS (Mpoints/s)", "TransformPoint");
+    std::printf("  %-22s %14.1f\n", "Matrix4x4 loop", aosRate * 1e-6);
+
+    std::printf("\n  %-10s (Mpoints/s) %10s %10s %10s %10s %10s %8s\n", "SoA", "Transform", "PerMatrix", "Normalize", "Rotate", "Aabb", "vs AoS");
+    for (BatchMathBackend backend : backends)
+    {
+        BatchMath::SetBackend(backend);
+        const double transform = PointsPerSecond(count, iterations, [&] { BatchMath::TransformPoints(in.matrix, in.soa.Stream(), out.Stream(), count); });
+        const double perMatrix = PointsPerSecond(count, iterations, [&] { BatchMath::TransformPoints(in.matrices.data(), in.soa.Stream(), out.Stream(), count); });
+        const double normalize = PointsPerSecond(count, iterations, [&] { BatchMath::Normalize(in.soa.Stream(), out.Stream(), count); });
+        const double rotate = PointsPerSecond(count, iterations, [&] { BatchMath::Rotate(q, in.soa.Stream(), out.Stream(), count); });
+        const double aabb = PointsPerSecond(count, iterations, [&] {
+            BatchMath::TransformAabbs(in.matrix, in.mins.Stream(), in.maxs.Stream(), out.Stream(), outMax.Stream(), count);
+        });
+        g_sink = g_sink + out.Get(count / 2).x;
+        std::printf("  %-22s %10.1f %10.1f %10.1f %10.1f %10.1f %7.2fx\n", BatchMath::GetBackendName(backend),
+                    transform * 1e-6, perMatrix * 1e-6, normalize * 1e-6, rotate * 1e-6, aabb * 1e-6, transform / aosRate);
+    }
+
+    BatchMath::SetBackend(detected);
+    return exact ? 0 : 1;
+}
@@ -0,0 +1,242 @@
+// --- aurum-bench-config ---
+// Compares ConfigManager::Load on a large generated config with and
+// without the compiled binary cache, and checks blob lookups for missing
+// and doubly spelled keys and for paths under dotted keys, and that a
+// schema binds what GetInt returns on both backends.
+//
+// Usage: aurum-bench-config [--keys N] [--runs N]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <Framework/Config.hpp>
+#include <Framework/ConfigSchema.hpp>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double MillisecondsSince(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    double Median(std::vector<double> samples)
+    {
+        std::sort(samples.begin(), samples.end());
+        return samples[samples.size() / 2];
+    }
+
+    // Sections of 100 keys with a mix of value types
+    std::vector<std::string> WriteConfig(const std::string& path, int keyCount)
+    {
+        Aurum::json root = Aurum::json::object();
+        std::vector<std::string> keys;
+        keys.reserve(static_cast<std::size_t>(keyCount));
+
+        for (int i = 0; i < keyCount; ++i)
+        {
+            const std::string section = "section_" + std::to_string(i / 100);
+            const std::string name = "key_" + std::to_string(i % 100);
+            auto& slot = root[section][name];
+            switch (i % 4)
+            {
+                case 0: slot = i; break;
+                case 1: slot = i * 0.25; break;
+                case 2: slot = (i % 3) == 0; break;
+                case 3: slot = "value_" + std::to_string(i); break;
+            }
+            keys.push_back(section + "." + name);
+        }
+
+        std::ofstream(path) << std::setw(4) << root;
+        return keys;
+    }
+
+    struct Result
+    {
+        double loadMs = 0.0;
+        double lookupMs = 0.0;
+        long long checksum = 0; // Both paths must read the same values
+    };
+
+    // Reads each key with the accessor matching how WriteConfig filled it
+    long long ReadAll(const Aurum::ConfigSnapshot& snapshot, const std::vector<Aurum::ConfigKey>& keys)
+    {
+        long long checksum = 0;
+        for (std::size_t i = 0; i < keys.size(); ++i)
+        {
+            switch (i % 4)
+            {
+                case 0: checksum += snapshot.GetInt(keys[i], 0); break;
+                case 1: checksum += static_cast<long long>(snapshot.GetFloat(keys[i], 0.0f)); break;
+                case 2: checksum += snapshot.GetBool(keys[i], false) ? 1 : 0; break;
+                case 3: checksum += static_cast<long long>(snapshot.GetString(keys[i]).size()); break;
+            }
+        }
+        return checksum;
+    }
+
+    Result Measure(const std::string& path, const std::vector<Aurum::ConfigKey>& keys, int runs)
+    {
+        auto& config = Aurum::ConfigManager::Get();
+        std::vector<double> loads;
+        std::vector<double> lookups;
+        long long checksum = 0;
+
+        for (int run = 0; run < runs; ++run)
+        {
+            auto start = Clock::now();
+            config.Load(path);
+            loads.push_back(MillisecondsSince(start));
+
+            // First read of every key, as a system would do during startup
+            start = Clock::now();
+            checksum += ReadAll(*config.Snapshot(), keys);
+            lookups.push_back(MillisecondsSince(start));
+        }
+
+        return { Median(loads), Median(lookups), checksum };
+    }
+
+    // A path spelled both nested and flat resolves like the json tree
+    // (nested first), and a missing key never matches another key's hash
+    // Paths under a dotted key exist in the json tree but no lookup reaches
+    // them; the blob must agree with the json snapshot on every one
+    bool CheckUnreachableKeys(const std::filesystem::path& directory)
+    {
+        const Aurum::json data = Aurum::json::parse(R"({"a.b": {"c": 5}, "x": {"y.z": 6, "w": 7}})");
+        const std::string path = (directory / "unreachable.blob").string();
+        auto blob = std::make_shared<Aurum::ConfigBlob>();
+        if (!Aurum::ConfigBlob::Compile(data, 0, 0, path) || !blob->Open(path))
+            return false;
+
+        const Aurum::ConfigSnapshot fromJson(data, path, 0, 0);
+        const Aurum::ConfigSnapshot fromBlob(blob, path, 0);
+        for (const char* key : { "a.b", "a.b.c", "x.y.z", "x.y", "x.w", "/x/w" })
+        {
+            if (fromJson.Contains(key) != fromBlob.Contains(key) || fromJson.GetInt(key, -1) != fromBlob.GetInt(key, -1))
+                return false;
+        }
+        return !fromBlob.Contains("a.b.c") && fromBlob.GetInt("a.b.c", -1) == -1 && fromBlob.GetInt("x.w", -1) == 7;
+    }
+
+    bool CheckBlobKeys(const std::filesystem::path& directory)
+    {
+        const Aurum::json data = Aurum::json::parse(R"({"a.b": 1, "a": {"b": 2, "c": 3}, "flat.only": 4, "list": [5, 6]})");
+        const std::string path = (directory / "keys.blob").string();
+        Aurum::ConfigBlob blob;
+        if (!Aurum::ConfigBlob::Compile(data, 0, 0, path) || !blob.Open(path))
+            return false;
+
+        auto intAt = [&](const Aurum::ConfigBlob::Entry* entry) { return entry ? Aurum::ConfigBlob::AsInt(*entry) : -1; };
+        return intAt(blob.Find("a.b")) == 2 && intAt(blob.Find("/a/b")) == 2 &&
+               intAt(blob.Find(Aurum::ConfigKey("a.c"))) == 3 && intAt(blob.Find(Aurum::ConfigKey("/list/1"))) == 6 &&
+               intAt(blob.Find("flat.only")) == 4 && blob.Find("a.d") == nullptr &&
+               blob.Find(Aurum::ConfigPath::HashDotted("a.b"), "a.x") == nullptr &&
+               blob.GetEntryCount() == 7 && CheckUnreachableKeys(directory);
+    }
+
+    struct WindowSettings
+    {
+        int width = 0;
+        int height = 0;
+
+        static constexpr auto Schema()
+        {
+            using Self = WindowSettings;
+            return Aurum::MakeConfigSchema<Self>(
+                Aurum::ConfigField<Self>("window.width",  &Self::width,  -1),
+                Aurum::ConfigField<Self>("window.height", &Self::height, -1));
+        }
+    };
+
+    // Nested spelling wins over the flat one; flat fills in when it is the
+    // only spelling. Checked against GetInt on the json and blob backends.
+    bool CheckSchemaPrecedence(const std::filesystem::path& directory)
+    {
+        const std::string path = (directory / "precedence.json").string();
+        std::ofstream(path) << R"({"window.width": 200, "window": {"width": 100}, "window.height": 300})";
+
+        auto& config = Aurum::ConfigManager::Get();
+        auto check = [&](bool binaryCache)
+        {
+            config.SetBinaryCache(binaryCache);
+            if (!config.Load(path) || (binaryCache && !config.Load(path)))
+                return false;
+
+            const auto snapshot = config.Snapshot();
+            WindowSettings settings;
+            const Aurum::ConfigReport report = WindowSettings::Schema().Load(*snapshot, settings);
+            return snapshot->IsBlobBacked() == binaryCache && report.GetIssues().empty() &&
+                   settings.width == 100 && settings.width == config.GetInt("window.width", -1) &&
+                   settings.height == 300 && settings.height == config.GetInt("window.height", -1);
+        };
+        return check(false) && check(true);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    int keyCount = 12000;
+    int runs = 15;
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        const std::string arg = argv[i];
+        if (arg == "--keys") keyCount = std::max(1, std::atoi(argv[i + 1]));
+        else if (arg == "--runs") runs = std::max(1, std::atoi(argv[i + 1]));
+    }
+
+    Aurum::Logger::Get().SetConsoleEnabled(false);
+
+    const auto directory = std::filesystem::temp_directory_path() / "aurum_bench_config";
+    std::filesystem::create_directories(directory);
+    const std::string path = (directory / "large_config.json").string();
+
+    std::vector<Aurum::ConfigKey> keys;
+    for (const auto& key : WriteConfig(path, keyCount))
+        keys.emplace_back(key);
+
+    auto& config = Aurum::ConfigManager::Get();
+    std::filesystem::remove(Aurum::ConfigManager::GetCachePath(path));
+
+    // --- JSON parse on every load ---
+    config.SetBinaryCache(false);
+    const Result parsed = Measure(path, keys, runs);
+
+    // --- First load with the cache compiles the blob ---
+    config.SetBinaryCache(true);
+    auto start = Clock::now();
+    config.Load(path);
+    const double compileMs = MillisecondsSince(start);
+
+    // --- Later loads map the blob ---
+    const Result cached = Measure(path, keys, runs);
+
+    std::printf("Config load benchmark: %d keys, %.1f KiB JSON, %.1f KiB blob, median of %d runs\n",
+                keyCount,
+                std::filesystem::file_size(path) / 1024.0,
+                std::filesystem::file_size(Aurum::ConfigManager::GetCachePath(path)) / 1024.0,
+                runs);
+    std::printf("  %-22s %10s %14s\n", "path", "load (ms)", "lookups (ms)");
+    std::printf("  %-22s %10.3f %14.3f\n", "json parse", parsed.loadMs, parsed.lookupMs);
+    std::printf("  %-22s %10.3f %14s\n", "blob compile (once)", compileMs, "-");
+    std::printf("  %-22s %10.3f %14.3f\n", "blob mapped", cached.loadMs, cached.lookupMs);
+    std::printf("  speedup (load): %.1fx\n", parsed.loadMs / cached.loadMs);
+    if (parsed.checksum != cached.checksum)
+        std::printf("  WARNING: blob and json values differ\n");
+
+    const bool keysOk = CheckBlobKeys(directory);
+    std::printf("  blob key checks: %s\n", keysOk ? "ok" : "FAILED");
+    const bool schemaOk = CheckSchemaPrecedence(directory);
+    std::printf("  schema key precedence: %s\n", schemaOk ? "ok" : "FAILED");
+
+    std::filesystem::remove_all(directory);
+    return (keysOk && schemaOk) ? 0 : 1;
+}
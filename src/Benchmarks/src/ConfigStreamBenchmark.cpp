@@ -0,0 +1,199 @@
+// --- aurum-bench-configstream ---
+// Streams a large generated data file through ConfigStreamLoader and
+// checks every delivered sub-tree against json::parse of the whole file:
+// the sequential "entities.*" route, the same route split into parallel
+// chunks, a whole sub-tree route ("physics") and the "*" route. Then
+// times each against the full parse.
+//
+// Usage: aurum-bench-configstream [--count N] [--runs N]
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <Framework/ConfigStream.hpp>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+    using Aurum::json;
+
+    double MillisecondsSince(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    template<typename Fn>
+    double MedianMs(int runs, Fn&& fn)
+    {
+        std::vector<double> samples;
+        for (int run = 0; run < runs; ++run)
+        {
+            const auto start = Clock::now();
+            fn();
+            samples.push_back(MillisecondsSince(start));
+        }
+        std::sort(samples.begin(), samples.end());
+        return samples[samples.size() / 2];
+    }
+
+    // Entities mix the things the structural scan has to step over:
+    // strings with escaped quotes and brackets, nested arrays and objects
+    void WriteData(const std::string& path, int count)
+    {
+        json root = json::object();
+        root["meta"] = { { "version", 3 }, { "name", "bench \"world\" [1]" } };
+        json& entities = root["entities"] = json::array();
+        for (int i = 0; i < count; ++i)
+        {
+            entities.push_back({
+                { "id", i },
+                { "name", "entity_" + std::to_string(i) + (i % 7 == 0 ? " {\"quoted\"} [x]\\\\" : "") },
+                { "position", { i * 0.5, -i * 0.25, i % 13 } },
+                { "tags", i % 3 == 0 ? json::array({ "a", "b]" }) : json::array() },
+                { "components", { { "health", 100 - i % 50 }, { "visible", i % 2 == 0 }, { "parent", i % 5 == 0 ? json() : json(i / 2) } } }
+            });
+        }
+        root["physics"] = { { "gravity", { 0.0, -9.81, 0.0 } }, { "substeps", 4 }, { "layers", { "world", "props" } } };
+        std::ofstream(path) << std::setw(2) << root;
+    }
+
+    std::size_t ElementIndex(std::string_view path)
+    {
+        std::size_t index = 0;
+        const std::string_view digits = path.substr(path.rfind('.') + 1);
+        std::from_chars(digits.data(), digits.data() + digits.size(), index);
+        return index;
+    }
+
+    // Delivered entities by index, so sequential and parallel compare alike
+    struct Collected
+    {
+        std::mutex mutex;
+        std::vector<json> entities;
+        std::map<std::string, json> members;
+    };
+
+    bool SameEntities(const Collected& collected, const json& document)
+    {
+        const json& expected = document["entities"];
+        if (collected.entities.size() != expected.size())
+            return false;
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            if (collected.entities[i] != expected[i])
+                return false;
+        }
+        return true;
+    }
+
+    bool LoadEntities(const std::string& path, const json& document, Aurum::ConfigStreamMode mode)
+    {
+        Collected collected;
+        collected.entities.resize(document["entities"].size());
+        Aurum::ConfigStreamLoader loader;
+        loader.SetParallelThreshold(1);
+        loader.SetWorkerCount(4);
+        loader.On("entities.*", [&](std::string_view elementPath, json& value)
+        {
+            const std::size_t index = ElementIndex(elementPath);
+            std::lock_guard<std::mutex> lock(collected.mutex);
+            if (index < collected.entities.size())
+                collected.entities[index] = std::move(value);
+        }, mode);
+        loader.On("physics", [&](std::string_view memberPath, json& value)
+        {
+            std::lock_guard<std::mutex> lock(collected.mutex);
+            collected.members[std::string(memberPath)] = std::move(value);
+        });
+
+        const Aurum::ConfigReport report = loader.Load(path);
+        return report.GetIssues().empty() && SameEntities(collected, document) &&
+               collected.members.size() == 1 && collected.members["physics"] == document["physics"];
+    }
+
+    bool LoadTopLevel(const std::string& path, const json& document)
+    {
+        Collected collected;
+        Aurum::ConfigStreamLoader loader;
+        loader.On("*", [&](std::string_view memberPath, json& value)
+        {
+            collected.members[std::string(memberPath)] = std::move(value);
+        });
+
+        const Aurum::ConfigReport report = loader.Load(path);
+        if (!report.GetIssues().empty() || collected.members.size() != document.size())
+            return false;
+        for (auto it = document.begin(); it != document.end(); ++it)
+        {
+            const auto found = collected.members.find(it.key());
+            if (found == collected.members.end() || found->second != it.value())
+                return false;
+        }
+        return true;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    int count = 100000;
+    int runs = 5;
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        const std::string arg = argv[i];
+        if (arg == "--count") count = std::max(1, std::atoi(argv[i + 1]));
+        else if (arg == "--runs") runs = std::max(1, std::atoi(argv[i + 1]));
+    }
+
+    const auto directory = std::filesystem::temp_directory_path() / "aurum_bench_configstream";
+    std::filesystem::create_directories(directory);
+    const std::string path = (directory / "world.json").string();
+    WriteData(path, count);
+
+    std::string text;
+    {
+        std::ifstream file(path, std::ios::binary);
+        text.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    const json document = json::parse(text);
+
+    // --- Output must match the full parse ---
+    const bool sequential = LoadEntities(path, document, Aurum::ConfigStreamMode::Sequential);
+    const bool parallel = LoadEntities(path, document, Aurum::ConfigStreamMode::Parallel);
+    const bool topLevel = LoadTopLevel(path, document);
+
+    // --- Timing: every entity handed to a handler that only counts ---
+    auto timeStream = [&](Aurum::ConfigStreamMode mode)
+    {
+        return MedianMs(runs, [&]
+        {
+            std::atomic<std::size_t> seen{0};
+            Aurum::ConfigStreamLoader loader;
+            loader.On("entities.*", [&](std::string_view, json&) { seen.fetch_add(1, std::memory_order_relaxed); }, mode);
+            loader.Load(path);
+        });
+    };
+    const double parseMs = MedianMs(runs, [&] { json parsed = json::parse(text); });
+    const double sequentialMs = timeStream(Aurum::ConfigStreamMode::Sequential);
+    const double parallelMs = timeStream(Aurum::ConfigStreamMode::Parallel);
+
+    std::printf("Config stream benchmark: %d entities, %.1f MiB JSON, median of %d runs\n",
+                count, text.size() / (1024.0 * 1024.0), runs);
+    std::printf("  %-28s %10s %8s\n", "path", "time (ms)", "output");
+    std::printf("  %-28s %10.2f %8s\n", "json::parse (whole file)", parseMs, "-");
+    std::printf("  %-28s %10.2f %8s\n", "stream, sequential", sequentialMs, sequential ? "match" : "DIFFER");
+    std::printf("  %-28s %10.2f %8s\n", "stream, parallel chunks", parallelMs, parallel ? "match" : "DIFFER");
+    std::printf("  %-28s %10s %8s\n", "stream, \"*\" route", "-", topLevel ? "match" : "DIFFER");
+
+    std::filesystem::remove_all(directory);
+    return (sequential && parallel && topLevel) ? 0 : 1;
+}
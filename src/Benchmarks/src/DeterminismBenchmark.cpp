@@ -0,0 +1,220 @@
+// --- aurum-bench-determinism ---
+// Cross-build check for lockstep math. Runs the same rigid-body style
+// simulation (integration, FromAxisAngle, quaternion products, Normalize,
+// Transform::ToMatrix, TransformPoint) in float and in Fixed, hashing every
+// intermediate result. Run it from two builds (compilers, CPUs, SIMD
+// settings) and compare the hashes: Fixed must always agree, float only
+// with AURUM_MATH_DETERMINISTIC=ON. Also reports the accuracy and cost of
+// the software sin / cos. With the default steps and bodies the Fixed hash
+// is checked against the known value unless --expect-fixed overrides it.
+//
+// Usage: aurum-bench-determinism [--steps N] [--bodies N]
+//                                [--expect-float HEX] [--expect-fixed HEX]
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <Framework/Math/Math.hpp>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+    using namespace Aurum;
+
+    volatile double g_sink = 0.0;
+
+    // Fixed hash for the default run; any build that disagrees is broken
+    constexpr int kDefaultSteps = 10000;
+    constexpr int kDefaultBodies = 64;
+    constexpr const char* kDefaultFixedHash = "7663c8bdf5a44c4e";
+
+    // FNV-1a over the bit patterns of every value mixed in
+    struct Hash
+    {
+        std::uint64_t value = 14695981039346656037ull;
+
+        template<typename T>
+        void Mix(const T& v)
+        {
+            unsigned char bytes[sizeof(T)];
+            std::memcpy(bytes, &v, sizeof(T));
+            for (unsigned char b : bytes)
+                value = (value ^ b) * 1099511628211ull;
+        }
+
+        template<typename T>
+        void Mix(const BasicVector3<T>& v) { Mix(v.x); Mix(v.y); Mix(v.z); }
+        template<typename T>
+        void Mix(const BasicQuaternion<T>& q) { Mix(q.w); Mix(q.x); Mix(q.y); Mix(q.z); }
+    };
+
+    // Integer generator: std distributions differ between standard libraries
+    struct Lcg
+    {
+        std::uint64_t state = 0x9E3779B97F4A7C15ull;
+
+        int Next(int lo, int hi)
+        {
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+            return lo + static_cast<int>((state >> 33) % static_cast<std::uint64_t>(hi - lo + 1));
+        }
+    };
+
+    template<typename T>
+    T Ratio(int num, int den) { return T(num) / T(den); }
+
+    template<typename T>
+    struct Body
+    {
+        BasicVector3<T> position, velocity, axis;
+        BasicQuaternion<T> rotation;
+        T spin;
+    };
+
+    // Kept within a few tens of units so Fixed's squared lengths fit
+    template<typename T>
+    std::uint64_t Simulate(int steps, int bodyCount)
+    {
+        Lcg rng;
+        std::vector<Body<T>> bodies(bodyCount);
+        for (Body<T>& b : bodies)
+        {
+            b.position = {Ratio<T>(rng.Next(-1000, 1000), 100), Ratio<T>(rng.Next(100, 1000), 100), Ratio<T>(rng.Next(-1000, 1000), 100)};
+            b.velocity = {Ratio<T>(rng.Next(-300, 300), 100), T(0), Ratio<T>(rng.Next(-300, 300), 100)};
+            b.axis = BasicVector3<T>(Ratio<T>(rng.Next(-100, 100), 100), T(1), Ratio<T>(rng.Next(-100, 100), 100)).Normalized();
+            b.spin = Ratio<T>(rng.Next(-600, 600), 100);
+        }
+
+        const T dt = Ratio<T>(1, 60);
+        const T bounce = Ratio<T>(8, 10);
+        const T pull = Ratio<T>(2, 1);
+        const BasicVector3<T> gravity(T(0), Ratio<T>(-98, 10), T(0));
+        const BasicVector3<T> scale(T(1), Ratio<T>(1, 2), T(1));
+        const BasicVector3<T> tipLocal(T(1), T(0), T(0));
+
+        Hash hash;
+        for (int step = 0; step < steps; ++step)
+        {
+            for (Body<T>& b : bodies)
+            {
+                b.velocity += gravity * dt;
+                b.position += b.velocity * dt;
+                if (b.position.y < T(0))
+                {
+                    b.position.y = -b.position.y;
+                    b.velocity.y = -b.velocity.y * bounce;
+                }
+
+                const BasicQuaternion<T> delta = BasicQuaternion<T>::FromAxisAngle(b.axis, b.spin * dt);
+                b.rotation = BasicQuaternion<T>::Multiply(b.rotation, delta).Normalized();
+
+                // Steer the rotated tip back toward the centre column
+                const BasicVector3<T> tip = BasicTransform<T>(b.position, b.rotation, scale).ToMatrix().TransformPoint(tipLocal);
+                const BasicVector3<T> toCentre = BasicVector3<T>(-tip.x, T(0), -tip.z).Normalized();
+                b.velocity += toCentre * (pull * dt);
+
+                hash.Mix(tip);
+                hash.Mix(b.rotation);
+            }
+            for (const Body<T>& b : bodies)
+            {
+                hash.Mix(b.position);
+                hash.Mix(b.velocity);
+            }
+        }
+        return hash.value;
+    }
+
+    template<typename Fn>
+    double Seconds(Fn&& fn)
+    {
+        const auto start = Clock::now();
+        fn();
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    bool Check(const char* name, std::uint64_t hash, const char* expected)
+    {
+        if (!expected)
+            return true;
+        const std::uint64_t want = std::strtoull(expected, nullptr, 16);
+        if (want == hash)
+            return true;
+        std::printf("  MISMATCH %s: expected %016" PRIx64 ", got %016" PRIx64 "\n", name, want, hash);
+        return false;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    int steps = kDefaultSteps;
+    int bodies = kDefaultBodies;
+    const char* expectFloat = nullptr;
+    const char* expectFixed = nullptr;
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        const std::string arg = argv[i];
+        if (arg == "--steps") steps = std::max(1, std::atoi(argv[i + 1]));
+        else if (arg == "--bodies") bodies = std::max(1, std::atoi(argv[i + 1]));
+        else if (arg == "--expect-float") expectFloat = argv[i + 1];
+        else if (arg == "--expect-fixed") expectFixed = argv[i + 1];
+    }
+    if (!expectFixed && steps == kDefaultSteps && bodies == kDefaultBodies)
+        expectFixed = kDefaultFixedHash;
+
+    std::printf("Deterministic float: %s, SIMD kernels: %s\n",
+                AURUM_MATH_DETERMINISTIC ? "ON" : "OFF", MathSimd::GetBackendName());
+
+    // --- Simulation hashes ---
+    std::uint64_t floatHash = 0, fixedHash = 0;
+    const double floatSeconds = Seconds([&] { floatHash = Simulate<float>(steps, bodies); });
+    const double fixedSeconds = Seconds([&] { fixedHash = Simulate<Fixed>(steps, bodies); });
+    const double bodySteps = double(steps) * bodies;
+
+    std::printf("\n  %-8s %-18s %14s\n", "Scalar", "Hash", "ns/body step");
+    std::printf("  %-8s %016" PRIx64 "   %14.1f\n", "float", floatHash, floatSeconds * 1e9 / bodySteps);
+    std::printf("  %-8s %016" PRIx64 "   %14.1f\n", "Fixed", fixedHash, fixedSeconds * 1e9 / bodySteps);
+
+    // --- Software sin / cos against the C library ---
+    constexpr int kSamples = 2000000;
+    double sinError = 0.0, fixedError = 0.0;
+    for (int i = 0; i < kSamples; ++i)
+    {
+        const double x = (i - kSamples / 2) * 1e-4;   // [-100, 100]
+        sinError = std::max({sinError, std::abs(DeterministicMath::Sin(x) - std::sin(x)),
+                             std::abs(DeterministicMath::Cos(x) - std::cos(x))});
+        const Fixed f(x);
+        fixedError = std::max({fixedError, std::abs(static_cast<double>(Fixed::Sin(f)) - std::sin(static_cast<double>(f))),
+                               std::abs(static_cast<double>(Fixed::Cos(f)) - std::cos(static_cast<double>(f)))});
+    }
+
+    double sum = 0.0;
+    const double libSeconds = Seconds([&] {
+        for (int i = 0; i < kSamples; ++i)
+            sum += std::sin((i - kSamples / 2) * 1e-4);
+    });
+    const double softSeconds = Seconds([&] {
+        for (int i = 0; i < kSamples; ++i)
+            sum += DeterministicMath::Sin((i - kSamples / 2) * 1e-4);
+    });
+    const double fixedSinSeconds = Seconds([&] {
+        for (int i = 0; i < kSamples; ++i)
+            sum += static_cast<double>(Fixed::Sin(Fixed::FromRaw((i - kSamples / 2) * 7)));
+    });
+    g_sink = g_sink + sum;
+
+    std::printf("\n  %-26s %14s %10s\n", "sin / cos on [-100, 100]", "max error", "ns/call");
+    std::printf("  %-26s %14s %10.1f\n", "C library (double)", "-", libSeconds * 1e9 / kSamples);
+    std::printf("  %-26s %14.3g %10.1f\n", "DeterministicMath (double)", sinError, softSeconds * 1e9 / kSamples);
+    std::printf("  %-26s %14.3g %10.1f\n", "Fixed", fixedError, fixedSinSeconds * 1e9 / kSamples);
+
+    bool ok = Check("float", floatHash, expectFloat);
+    ok &= Check("Fixed", fixedHash, expectFixed);
+    return ok ? 0 : 1;
+}
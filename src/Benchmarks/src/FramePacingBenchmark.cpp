@@ -0,0 +1,125 @@
+// --- aurum-bench-pacing ---
+// Runs the frame limiter in both pacing modes and reports process CPU
+// usage and frame-time jitter against the target.
+//
+// Usage: aurum-bench-pacing [--fps N] [--frames N] [--work-us N]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <string>
+#include <vector>
+#include <Framework/FramePacer.hpp>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    struct Result
+    {
+        double cpuPercent = 0.0;
+        double meanMs = 0.0;
+        double stddevUs = 0.0;
+        double p99ErrorUs = 0.0; // |interval - target|
+        double maxErrorUs = 0.0;
+        std::uint64_t missed = 0;
+    };
+
+    // Simulated frame work that actually uses the CPU
+    void Work(std::chrono::microseconds duration)
+    {
+        const auto end = Clock::now() + duration;
+        volatile double sink = 0.0;
+        while (Clock::now() < end)
+            sink = sink + 1.0;
+    }
+
+    Result Run(Aurum::FramePacingMode mode, double fps, int frames, std::chrono::microseconds work)
+    {
+        Aurum::FramePacer pacer;
+        pacer.SetMode(mode);
+        pacer.SetTargetFrameTime(1.0 / fps);
+
+        // Let the lateness estimate settle before measuring
+        for (int i = 0; i < 30; ++i)
+            pacer.Wait();
+        pacer.ResetStats();
+
+        std::vector<double> intervals;
+        intervals.reserve(static_cast<std::size_t>(frames));
+
+        const std::clock_t cpuStart = std::clock();
+        const auto wallStart = Clock::now();
+        auto last = wallStart;
+        for (int i = 0; i < frames; ++i)
+        {
+            Work(work);
+            pacer.Wait();
+            const auto now = Clock::now();
+            intervals.push_back(std::chrono::duration<double>(now - last).count());
+            last = now;
+        }
+        const double wall = std::chrono::duration<double>(Clock::now() - wallStart).count();
+        const double cpu = double(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+
+        Result result;
+        result.cpuPercent = 100.0 * cpu / wall;
+        result.missed = pacer.GetStats().missed;
+
+        double mean = 0.0;
+        for (double t : intervals)
+            mean += t;
+        mean /= intervals.size();
+
+        double variance = 0.0;
+        std::vector<double> errors;
+        for (double t : intervals)
+        {
+            variance += (t - mean) * (t - mean);
+            errors.push_back(std::abs(t - 1.0 / fps) * 1e6);
+        }
+        std::sort(errors.begin(), errors.end());
+
+        result.meanMs = mean * 1e3;
+        result.stddevUs = std::sqrt(variance / intervals.size()) * 1e6;
+        result.p99ErrorUs = errors[errors.size() * 99 / 100];
+        result.maxErrorUs = errors.back();
+        return result;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    double fps = 120.0;
+    int frames = 600;
+    int workUs = 2000;
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        const std::string arg = argv[i];
+        if (arg == "--fps") fps = std::max(1.0, std::atof(argv[i + 1]));
+        else if (arg == "--frames") frames = std::max(1, std::atoi(argv[i + 1]));
+        else if (arg == "--work-us") workUs = std::max(0, std::atoi(argv[i + 1]));
+    }
+
+    std::printf("Frame pacing benchmark: %.1f FPS target, %d frames, %d us work per frame\n", fps, frames, workUs);
+    if (!Aurum::FramePacer::IsPreciseSupported())
+        std::printf("  No high-resolution sleep on this system: precise runs as spin\n");
+    std::printf("  %-8s %8s %10s %12s %14s %14s %7s\n",
+                "mode", "cpu (%)", "mean (ms)", "stddev (us)", "p99 err (us)", "max err (us)", "missed");
+
+    const struct { const char* name; Aurum::FramePacingMode mode; } modes[] = {
+        { "spin",    Aurum::FramePacingMode::Spin },
+        { "precise", Aurum::FramePacingMode::Precise },
+    };
+    for (const auto& m : modes)
+    {
+        const Result r = Run(m.mode, fps, frames, std::chrono::microseconds(workUs));
+        std::printf("  %-8s %8.1f %10.3f %12.1f %14.1f %14.1f %7llu\n",
+                    m.name, r.cpuPercent, r.meanMs, r.stddevUs, r.p99ErrorUs, r.maxErrorUs,
+                    static_cast<unsigned long long>(r.missed));
+    }
+    return 0;
+}
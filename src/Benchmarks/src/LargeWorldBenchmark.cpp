@@ -0,0 +1,273 @@
+// --- aurum-bench-largeworld ---
+// Precision and cost of large-world coordinates. At world scales up to
+// 1e12 m, compares camera-relative positions computed three ways against
+// an exact reference: absolute float positions (the naive path), Vector3d
+// with a FloatingOrigin, and SectorPosition with a FloatingOrigin. Checks
+// re-centring and SectorPosition::Move across sector boundaries in both
+// directions, then times the per-frame batch pass and float vs double
+// TransformPoint.
+//
+// Usage: aurum-bench-largeworld [--count N] [--iterations N]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+#include <Framework/Math/Math.hpp>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+    using namespace Aurum;
+
+    volatile float g_sink = 0.0f;
+
+    struct Scene
+    {
+        Vector3d camera;
+        std::vector<double> x, y, z;                // Vector3d storage, SoA
+        std::vector<std::int64_t> sx, sy, sz;       // SectorPosition storage, SoA
+        std::vector<float> ox, oy, oz;
+        std::vector<Vector3> absolute;              // Naive float world positions
+    };
+
+    // Objects within +-2 km of a camera placed at the given distance from zero
+    Scene MakeScene(double scale, std::size_t count)
+    {
+        std::mt19937_64 rng(7);
+        std::uniform_real_distribution<double> near(-2000.0, 2000.0);
+        Scene scene;
+        scene.camera = Vector3d(scale * 0.8, scale * -0.5, scale * 0.3);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const Vector3d p = scene.camera + Vector3d(near(rng), near(rng), near(rng));
+            const SectorPosition s = SectorPosition::FromDouble(p);
+            scene.x.push_back(p.x); scene.y.push_back(p.y); scene.z.push_back(p.z);
+            scene.sx.push_back(s.sx); scene.sy.push_back(s.sy); scene.sz.push_back(s.sz);
+            scene.ox.push_back(s.offset.x); scene.oy.push_back(s.offset.y); scene.oz.push_back(s.offset.z);
+            scene.absolute.push_back(Vector3(p));
+        }
+        return scene;
+    }
+
+    // Largest error of camera-relative float positions, in metres
+    struct Errors
+    {
+        double naive = 0.0, origin = 0.0, sector = 0.0;
+    };
+
+    Errors MeasureErrors(const Scene& scene)
+    {
+        const std::size_t count = scene.x.size();
+        FloatingOrigin origin;
+        origin.Update(scene.camera);
+
+        Float3Buffer fromDouble(count), fromSector(count);
+        origin.ToLocal(ConstDouble3Stream{scene.x.data(), scene.y.data(), scene.z.data()}, fromDouble.Stream(), count);
+        origin.ToLocal(ConstSectorStream{scene.sx.data(), scene.sy.data(), scene.sz.data(),
+                                         {scene.ox.data(), scene.oy.data(), scene.oz.data()}}, fromSector.Stream(), count);
+
+        // Camera-relative as the shaders would see it: position - eye, in float
+        const Vector3 eyeNaive(scene.camera);
+        const Vector3 eyeLocal = origin.ToLocal(scene.camera);
+        const SectorPosition cameraSector = SectorPosition::FromDouble(scene.camera);
+        const Vector3 eyeSector = origin.ToLocal(cameraSector);
+
+        // Reference: the sector form is exact in double here (int * 4096 + float)
+        auto error = [](const Vector3& got, const Vector3d& exact) {
+            return std::max({std::abs(got.x - exact.x), std::abs(got.y - exact.y), std::abs(got.z - exact.z)});
+        };
+
+        Errors errors;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const Vector3d world(scene.x[i], scene.y[i], scene.z[i]);
+            const Vector3d exact = world - scene.camera;
+            errors.naive = std::max(errors.naive, error(scene.absolute[i] - eyeNaive, exact));
+            errors.origin = std::max(errors.origin, error(fromDouble.Get(i) - eyeLocal, exact));
+
+            SectorPosition s;
+            s.sx = scene.sx[i]; s.sy = scene.sy[i]; s.sz = scene.sz[i];
+            s.offset = Vector3(scene.ox[i], scene.oy[i], scene.oz[i]);
+            errors.sector = std::max(errors.sector, error(fromSector.Get(i) - eyeSector, s.ToDouble() - cameraSector.ToDouble()));
+        }
+        return errors;
+    }
+
+    // Flies the camera out and back across many sector boundaries on every
+    // axis. Each re-centre must move the origin by whole sectors, report
+    // old - new as the shift (a float position carried over with it must
+    // match a fresh ToLocal), leave the camera within half a sector, and a
+    // frame without one must leave the origin alone.
+    bool CheckRebasing(double rebaseDistance)
+    {
+        FloatingOrigin origin(rebaseDistance);
+        const double half = SectorPosition::kSectorSize * 0.5;
+        const Vector3d landmark(1000.0, -500.0, 250.0);
+        Vector3 landmarkLocal = origin.ToLocal(landmark);
+        std::uint64_t rebases = 0;
+        bool ok = true;
+
+        auto step = [&](const Vector3d& camera) {
+            const Vector3d before = origin.GetOrigin();
+            if (origin.Update(camera))
+            {
+                ++rebases;
+                const Vector3d after = origin.GetOrigin();
+                const Vector3d shift = origin.GetLastShift();
+                ok &= shift.x == before.x - after.x && shift.y == before.y - after.y && shift.z == before.z - after.z;
+                ok &= std::fmod(after.x, SectorPosition::kSectorSize) == 0.0 && std::fmod(after.y, SectorPosition::kSectorSize) == 0.0 &&
+                      std::fmod(after.z, SectorPosition::kSectorSize) == 0.0;
+                ok &= std::abs(camera.x - after.x) <= half && std::abs(camera.y - after.y) <= half && std::abs(camera.z - after.z) <= half;
+
+                landmarkLocal = landmarkLocal + Vector3(shift);
+                const Vector3 fresh = origin.ToLocal(landmark);
+                ok &= std::abs(landmarkLocal.x - fresh.x) < 1e-3f && std::abs(landmarkLocal.y - fresh.y) < 1e-3f &&
+                      std::abs(landmarkLocal.z - fresh.z) < 1e-3f;
+            }
+            else
+            {
+                ok &= origin.GetOrigin().x == before.x && origin.GetOrigin().y == before.y && origin.GetOrigin().z == before.z;
+                ok &= origin.GetLastShift().x == 0.0 && origin.GetLastShift().y == 0.0 && origin.GetLastShift().z == 0.0;
+            }
+        };
+
+        for (double d = 0.0; d <= 30000.0; d += 97.0)
+            step(Vector3d(d, -0.5 * d, 0.25 * d));
+        for (double d = 30000.0; d >= -30000.0; d -= 97.0)
+            step(Vector3d(d, -0.5 * d, 0.25 * d));
+
+        // Standing still must not keep re-centring
+        const std::uint64_t settled = origin.GetRebaseCount();
+        for (int i = 0; i < 10; ++i)
+            step(Vector3d(-30000.0 + 3000.0, 3000.0, 3000.0));
+        ok &= origin.GetRebaseCount() <= settled + 1;
+        return ok && rebases == origin.GetRebaseCount() && rebases > 10;
+    }
+
+    // Moves by quarter-metre deltas (exact in float) across sector boundaries
+    // in both directions: the carried sector + offset must equal the exact
+    // double position, with the offset kept inside one sector
+    bool CheckMove()
+    {
+        const Vector3d start(-5000.25, 12345.5, 4095.75);
+        SectorPosition p = SectorPosition::FromDouble(start);
+        Vector3d exact = start;
+        bool ok = true;
+        for (int i = 0; i < 400; ++i)
+        {
+            const float phase = (i / 100) % 2 == 0 ? 1.0f : -1.0f;
+            const Vector3 delta(phase * 1500.25f, -phase * 2300.5f, phase * (i % 7) * 700.75f);
+            p.Move(delta);
+            exact = exact + Vector3d(delta);
+
+            const Vector3d got = p.ToDouble();
+            ok &= got.x == exact.x && got.y == exact.y && got.z == exact.z;
+            ok &= p.offset.x >= 0.0f && p.offset.x < SectorPosition::kSectorSize &&
+                  p.offset.y >= 0.0f && p.offset.y < SectorPosition::kSectorSize &&
+                  p.offset.z >= 0.0f && p.offset.z < SectorPosition::kSectorSize;
+        }
+        return ok;
+    }
+
+    template <typename Fn>
+    double PointsPerSecond(std::size_t count, int iterations, Fn&& fn)
+    {
+        std::vector<double> samples;
+        for (int it = 0; it < iterations; ++it)
+        {
+            const auto start = Clock::now();
+            fn();
+            samples.push_back(double(count) / std::chrono::duration<double>(Clock::now() - start).count());
+        }
+        std::sort(samples.begin(), samples.end());
+        return samples[samples.size() / 2];
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t count = 1 << 20;
+    int iterations = 20;
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        const std::string arg = argv[i];
+        if (arg == "--count") count = std::max<std::size_t>(1, std::strtoull(argv[i + 1], nullptr, 10));
+        else if (arg == "--iterations") iterations = std::max(1, std::atoi(argv[i + 1]));
+    }
+
+    // --- Precision ---
+    std::printf("Camera-relative error, objects within 2 km of the camera (max, metres)\n");
+    std::printf("  %-12s %14s %14s %14s\n", "world scale", "float world", "double+origin", "sector+origin");
+    bool precise = true;
+    for (double scale : {1e3, 1e6, 1e9, 1e12})
+    {
+        const Errors errors = MeasureErrors(MakeScene(scale, std::min<std::size_t>(count, 100000)));
+        std::printf("  %-12.0e %14.6g %14.6g %14.6g\n", scale, errors.naive, errors.origin, errors.sector);
+        // Both schemes stay within float rounding of a few km, at any scale
+        precise &= errors.origin < 1e-3 && errors.sector < 1e-3;
+    }
+
+    // --- Re-centring and sector carry ---
+    const bool rebasing = CheckRebasing(SectorPosition::kSectorSize) && CheckRebasing(1000.0);
+    const bool carry = CheckMove();
+    std::printf("\nRe-centring across sectors: %s\n", rebasing ? "ok" : "FAILED");
+    std::printf("SectorPosition::Move carry: %s\n", carry ? "ok" : "FAILED");
+
+    // Double math at 1e9 m: the same TRS applied to a far point in float and double
+    {
+        const Transformd td(Vector3d(1e9, -2e9, 5e8), Quaterniond::FromAxisAngle(Vector3d(0.0, 1.0, 0.0), 0.3), Vector3d(1.0, 1.0, 1.0));
+        const Vector3d local(12.345, 6.789, -3.21);
+        const Vector3d exact = td.ToMatrix().TransformPoint(local);
+        const Vector3 single = Transform(td).ToMatrix().TransformPoint(Vector3(local));
+        std::printf("\nTRS at 1e9 m: Transform (float) is off by %.6g m from Transformd\n", (Vector3d(single) - exact).Length());
+    }
+
+    // --- Throughput ---
+    const Scene scene = MakeScene(1e9, count);
+    FloatingOrigin origin;
+    origin.Update(scene.camera);
+    Float3Buffer out(count);
+    const ConstDouble3Stream doubles{scene.x.data(), scene.y.data(), scene.z.data()};
+    const ConstSectorStream sectors{scene.sx.data(), scene.sy.data(), scene.sz.data(), {scene.ox.data(), scene.oy.data(), scene.oz.data()}};
+
+    const double batchDouble = PointsPerSecond(count, iterations, [&] { origin.ToLocal(doubles, out.Stream(), count); });
+    const double batchSector = PointsPerSecond(count, iterations, [&] { origin.ToLocal(sectors, out.Stream(), count); });
+    const double perPoint = PointsPerSecond(count, iterations, [&] {
+        for (std::size_t i = 0; i < count; ++i)
+            out.Set(i, origin.ToLocal(Vector3d(scene.x[i], scene.y[i], scene.z[i])));
+    });
+    g_sink = g_sink + out.Get(count / 2).x;
+
+    std::vector<Vector3> floats(count);
+    std::vector<Vector3d> doublesAos(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        doublesAos[i] = Vector3d(scene.x[i], scene.y[i], scene.z[i]);
+        floats[i] = Vector3(doublesAos[i] - scene.camera);
+    }
+    const Transform t(Vector3(1, 2, 3), Quaternion::FromAxisAngle(Vector3(0, 1, 0), 0.3f), Vector3(1, 1, 1));
+    const Matrix4x4 mf = t.ToMatrix();
+    const Matrix4x4d md = Transformd(t).ToMatrix();
+    const double xfFloat = PointsPerSecond(count, iterations, [&] {
+        for (std::size_t i = 0; i < count; ++i)
+            floats[i] = mf.TransformPoint(floats[i]);
+    });
+    const double xfDouble = PointsPerSecond(count, iterations, [&] {
+        for (std::size_t i = 0; i < count; ++i)
+            doublesAos[i] = md.TransformPoint(doublesAos[i]);
+    });
+    g_sink = g_sink + floats[count / 2].x + static_cast<float>(doublesAos[count / 2].x);
+
+    std::printf("\n  %-34s %10s\n", "Throughput, one core", "Mpoints/s");
+    std::printf("  %-34s %10.1f\n", "Batch ToLocal, Vector3d streams", batchDouble * 1e-6);
+    std::printf("  %-34s %10.1f\n", "Batch ToLocal, sector streams", batchSector * 1e-6);
+    std::printf("  %-34s %10.1f\n", "Per-point ToLocal, Vector3d", perPoint * 1e-6);
+    std::printf("  %-34s %10.1f\n", "TransformPoint, float", xfFloat * 1e-6);
+    std::printf("  %-34s %10.1f\n", "TransformPoint, double", xfDouble * 1e-6);
+    return (precise && rebasing && carry) ? 0 : 1;
+}
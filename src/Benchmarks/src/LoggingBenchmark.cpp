@@ -0,0 +1,342 @@
+// --- aurum-bench-logging ---
+// Logs engine-style lines from several threads into a text sink and a
+// BinaryLogSink at once, decodes the binary file again and checks every
+// message matches its text line, then reports the size of both outputs.
+// Also checks format specs render the way std::format renders them, and
+// that an async Flush() covers every record its caller logged before it,
+// and that thread staging writes records in timestamp order across merges.
+//
+// Usage: aurum-bench-logging [--records N] [--threads N]
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <Framework/Logger.hpp>
+#include <Framework/Logging/BinaryLog.hpp>
+
+namespace
+{
+    // Keeps the message part of every text line (after "[time] [LEVEL]: ")
+    class CaptureSink : public Aurum::LogSink
+    {
+    public:
+        void Write(const Aurum::LogRecord&, std::string_view line) override
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            bytes_ += line.size();
+            const std::size_t start = line.find("]: ");
+            messages_.emplace_back(line.substr(start + 3, line.size() - start - 4));
+        }
+
+        std::size_t GetBytes() const { return bytes_; }
+        const std::vector<std::string>& GetMessages() const { return messages_; }
+
+    private:
+        std::mutex mutex_;
+        std::size_t bytes_ = 0;
+        std::vector<std::string> messages_;
+    };
+
+    // The per-frame and gameplay lines a soak run is made of
+    void LogEngineLines(int records, int thread)
+    {
+        for (int i = 0; i < records; ++i)
+        {
+            if (i % 2 == 0)
+            {
+                const float dt = 0.0166f + 0.0001f * static_cast<float>((i * 7 + thread) % 13);
+                const double fps = 1.0 / dt;
+                AURUM_LOG_INFO("Δt: {:.6f}s | FPS: {:.2f}", dt, fps);
+            }
+            else
+            {
+                AURUM_LOG_INFO("Entity {} moved to sector {} chunk {}", (i * 37 + thread * 1000) % 20000, (i / 64) % 40 - 20, i % 16);
+            }
+        }
+    }
+
+    // Specs outside the supported grammar are compile errors in AURUM_LOG
+    static_assert(Aurum::IsValidLogFormat("{:*^+#010.3f} {:>8.2} {{}}"));
+    static_assert(!Aurum::IsValidLogFormat("{0}"));
+    static_assert(!Aurum::IsValidLogFormat("{:{}}"));
+    static_assert(!Aurum::IsValidLogFormat("{:L}"));
+    static_assert(!Aurum::IsValidLogFormat("{:.}"));
+    static_assert(!Aurum::IsValidLogFormat("unmatched }"));
+
+    template<typename T>
+    std::string FormatOne(std::string_view format, const T& value)
+    {
+        std::string args;
+        Aurum::EncodeLogArg(args, value);
+        std::string out;
+        Aurum::FormatLogMessage(out, format, args);
+        return out;
+    }
+
+    // Expected text is what std::format produces for the same spec
+    bool CheckFormatSpecs()
+    {
+        struct Case
+        {
+            const char* format;
+            std::string actual;
+            const char* expected;
+        };
+        const Case cases[] = {
+            { "{:8.2f}",  FormatOne("{:8.2f}", 3.14159),   "    3.14" },
+            { "{:>6}",    FormatOne("{:>6}", 42),          "    42" },
+            { "{:X}",     FormatOne("{:X}", 255),          "FF" },
+            { "{:04}",    FormatOne("{:04}", 7),           "0007" },
+            { "{:.3}",    FormatOne("{:.3}", "abcdef"),    "abc" },
+            { "{:<6}|",   FormatOne("{:<6}|", 42),         "42    |" },
+            { "{:*^9}",   FormatOne("{:*^9}", "mid"),      "***mid***" },
+            { "{:^6}",    FormatOne("{:^6}", "ab"),        "  ab  " },
+            { "{:>8.2}",  FormatOne("{:>8.2}", "abcdef"),  "      ab" },
+            { "{:>4}",    FormatOne("{:>4}", "Δ"),         "   Δ" },
+            { "{:+d}",    FormatOne("{:+d}", 5),           "+5" },
+            { "{: d}",    FormatOne("{: d}", 5),           " 5" },
+            { "{:#010x}", FormatOne("{:#010x}", 255u),     "0x000000ff" },
+            { "{:x}",     FormatOne("{:x}", -255),         "-ff" },
+            { "{:b}",     FormatOne("{:b}", 5),            "101" },
+            { "{:#o}",    FormatOne("{:#o}", 8),           "010" },
+            { "{:08.3f}", FormatOne("{:08.3f}", -3.14159), "-003.142" },
+            { "{:010}",   FormatOne("{:010}", -1.5),       "-0000001.5" },
+            { "{:08}",    FormatOne("{:08}", INFINITY),    "     inf" },
+            { "{:e}",     FormatOne("{:e}", 12345.678),    "1.234568e+04" },
+            { "{:G}",     FormatOne("{:G}", 1e20),         "1E+20" },
+            { "{:g}",     FormatOne("{:g}", 3.14159265),   "3.14159" },
+            { "{:#.0f}",  FormatOne("{:#.0f}", 3.0),       "3." },
+            { "{:.1f}",   FormatOne("{:.1f}", 1e20),       "100000000000000000000.0" },
+            { "{}",       FormatOne("{}", 0.1f),           "0.1" },
+            { "{:d}",     FormatOne("{:d}", true),         "1" },
+            { "{:>5}",    FormatOne("{:>5}", true),        " true" },
+            { "{:3}",     FormatOne("{:3}", 'c'),          "c  " },
+            { "{:d}",     FormatOne("{:d}", 'A'),          "65" },
+        };
+
+        bool ok = true;
+        for (const Case& c : cases)
+        {
+            if (c.actual != c.expected)
+            {
+                std::printf("  format %-10s gave \"%s\", expected \"%s\"\n", c.format, c.actual.c_str(), c.expected);
+                ok = false;
+            }
+        }
+        return ok;
+    }
+
+    // Remembers which "flush check #N" records have reached the sinks
+    class FlushSink : public Aurum::LogSink
+    {
+    public:
+        explicit FlushSink(std::size_t count) : seen_(count, false) {}
+
+        void Write(const Aurum::LogRecord&, std::string_view line) override
+        {
+            const std::size_t start = line.find('#');
+            std::size_t id = 0;
+            if (start == std::string_view::npos ||
+                std::from_chars(line.data() + start + 1, line.data() + line.size(), id).ec != std::errc() ||
+                id >= seen_.size())
+                return;
+            std::lock_guard<std::mutex> lock(mutex_);
+            seen_[id] = true;
+        }
+
+        bool Seen(std::size_t id)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return seen_[id];
+        }
+
+    private:
+        std::mutex mutex_;
+        std::vector<bool> seen_;
+    };
+
+    // Each thread logs a record and flushes; the record must be written by
+    // the time Flush() returns. Other threads keep the queue busy meanwhile.
+    std::size_t CountLateFlushes(int iterations, int threads, Aurum::LogOverflowPolicy policy)
+    {
+        auto& logger = Aurum::Logger::Get();
+        auto sink = std::make_shared<FlushSink>(static_cast<std::size_t>(iterations) * threads);
+        logger.AddSink("flush", sink);
+
+        Aurum::AsyncLogConfig config;
+        config.queueCapacity = 64;
+        config.maxBatchSize = 16;
+        config.overflowPolicy = policy;
+        logger.StartAsync(config);
+
+        std::atomic<std::size_t> late{0};
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; ++t)
+        {
+            workers.emplace_back([&, t]
+            {
+                for (int i = 0; i < iterations; ++i)
+                {
+                    const std::size_t id = static_cast<std::size_t>(t) * iterations + i;
+                    AURUM_LOG_INFO("flush check #{}", id);
+                    logger.Flush();
+                    if (policy == Aurum::LogOverflowPolicy::Block && !sink->Seen(id))
+                        late.fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+        }
+        for (std::thread& worker : workers)
+            worker.join();
+
+        logger.StopAsync();
+        logger.RemoveSink("flush");
+        return late.load();
+    }
+
+    // Counts records written with an earlier timestamp than the one before
+    class OrderSink : public Aurum::LogSink
+    {
+    public:
+        void Write(const Aurum::LogRecord& record, std::string_view) override
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            inversions_ += record.timestamp < last_;
+            last_ = std::max(last_, record.timestamp);
+            ++records_;
+        }
+
+        std::size_t GetInversions() const { return inversions_; }
+        std::size_t GetRecords() const { return records_; }
+
+    private:
+        std::mutex mutex_;
+        std::uint64_t last_ = 0;
+        std::size_t inversions_ = 0;
+        std::size_t records_ = 0;
+    };
+
+    // Small staging thresholds so the threads trigger many merges while
+    // the others are still logging
+    bool CheckStagingOrder(int records, int threads)
+    {
+        auto& logger = Aurum::Logger::Get();
+        auto sink = std::make_shared<OrderSink>();
+        logger.AddSink("order", sink);
+
+        Aurum::ThreadStagingConfig config;
+        config.flushThresholdRecords = 64;
+        config.maxLatency = std::chrono::milliseconds(1);
+        logger.EnableThreadStaging(config);
+
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; ++t)
+            workers.emplace_back(LogEngineLines, records / threads, t);
+        for (std::thread& worker : workers)
+            worker.join();
+
+        logger.DisableThreadStaging();
+        logger.RemoveSink("order");
+        std::printf("  staging order: %zu of %zu records out of order: %s\n", sink->GetInversions(),
+                    sink->GetRecords(), sink->GetInversions() == 0 ? "ok" : "FAILED");
+        return sink->GetInversions() == 0 && sink->GetRecords() == static_cast<std::size_t>(records / threads) * threads;
+    }
+
+    struct SizeResult
+    {
+        std::size_t textBytes = 0;
+        std::size_t binaryBytes = 0;
+        std::size_t records = 0;
+        bool roundTrip = false;
+    };
+
+    SizeResult MeasureSizes(const std::string& path, int records, int threads)
+    {
+        auto& logger = Aurum::Logger::Get();
+        auto text = std::make_shared<CaptureSink>();
+        logger.AddSink("capture", text);
+        logger.AddSink("binary", std::make_shared<Aurum::BinaryLogSink>(path));
+
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; ++t)
+            workers.emplace_back(LogEngineLines, records / threads, t);
+        for (std::thread& worker : workers)
+            worker.join();
+
+        logger.RemoveSink("binary");   // Flushes and closes the file
+        logger.RemoveSink("capture");
+
+        SizeResult result;
+        result.textBytes = text->GetBytes();
+        result.binaryBytes = static_cast<std::size_t>(std::filesystem::file_size(path));
+        result.records = text->GetMessages().size();
+
+        // Every decoded message must match the text line, in order
+        Aurum::BinaryLogReader reader;
+        Aurum::BinaryLogEntry entry;
+        std::string message;
+        std::size_t matched = 0;
+        if (reader.Open(path))
+        {
+            while (reader.Next(entry) && matched < result.records)
+            {
+                message.clear();
+                Aurum::BinaryLogReader::FormatMessage(entry, message);
+                if (message != text->GetMessages()[matched])
+                    break;
+                ++matched;
+            }
+        }
+        result.roundTrip = matched == result.records && reader.GetError().empty();
+        return result;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    int records = 200000;
+    int threads = 4;
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        const std::string arg = argv[i];
+        if (arg == "--records") records = std::max(1, std::atoi(argv[i + 1]));
+        else if (arg == "--threads") threads = std::max(1, std::atoi(argv[i + 1]));
+    }
+
+    Aurum::Logger::Get().SetConsoleEnabled(false);
+    const auto directory = std::filesystem::temp_directory_path() / "aurum_bench_logging";
+    std::filesystem::create_directories(directory);
+
+    const bool formatOk = CheckFormatSpecs();
+
+    // --- Async Flush() must cover the caller's own records ---
+    // With DropNewest a dropped record is never written; Flush() only has
+    // to return, so that run just must not hang.
+    const std::size_t lateFlushes = CountLateFlushes(20000, threads, Aurum::LogOverflowPolicy::Block);
+    CountLateFlushes(20000, threads, Aurum::LogOverflowPolicy::DropNewest);
+
+    // --- Output volume: text lines vs binary records ---
+    const SizeResult size = MeasureSizes((directory / "engine.alog").string(), records, threads);
+    std::printf("Logging benchmark: %zu records from %d threads\n", size.records, threads);
+    std::printf("  %-22s %12s %10s\n", "output", "bytes", "B/record");
+    std::printf("  %-22s %12zu %10.1f\n", "text lines", size.textBytes, double(size.textBytes) / size.records);
+    std::printf("  %-22s %12zu %10.1f\n", "binary log", size.binaryBytes, double(size.binaryBytes) / size.records);
+    std::printf("  reduction: %.2fx, decoded messages: %s\n",
+                double(size.textBytes) / size.binaryBytes, size.roundTrip ? "match" : "DIFFER");
+    std::printf("  format specs: %s\n", formatOk ? "ok" : "FAILED");
+    std::printf("  async flush: %zu records still queued after Flush(): %s\n", lateFlushes, lateFlushes == 0 ? "ok" : "FAILED");
+    const bool orderOk = CheckStagingOrder(records, threads);
+
+    std::filesystem::remove_all(directory);
+    return (size.roundTrip && formatOk && lateFlushes == 0 && orderOk) ? 0 : 1;
+}
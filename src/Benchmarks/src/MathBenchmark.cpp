@@ -0,0 +1,239 @@
+// --- aurum-bench-math ---
+// Checks that the dispatched SIMD math kernels match the scalar reference
+// bit for bit on random inputs, then times both. Also checks the direct
+// TRS / inverse / normal matrices and CachedTransform's parent updates
+// against plain matrix products, and times Transform::ToMatrix (matrix
+// products vs direct TRS vs CachedTransform).
+//
+// Usage: aurum-bench-math [--count N] [--iterations N]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+#include <Framework/Math/Math.hpp>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+    using namespace Aurum;
+
+    volatile float g_sink = 0.0f;
+
+    struct Inputs
+    {
+        std::vector<float> matrices;    // 16 floats each
+        std::vector<float> vectors;     // 4 floats each (xyz used for 3-vectors)
+    };
+
+    Inputs MakeInputs(std::size_t count)
+    {
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> value(-100.0f, 100.0f);
+        Inputs inputs;
+        inputs.matrices.resize(count * 16);
+        inputs.vectors.resize(count * 4 + 4);
+        for (float& f : inputs.matrices)
+            f = value(rng);
+        for (float& f : inputs.vectors)
+            f = (rng() % 16 == 0) ? 0.0f : value(rng); // Some zeros for the edge cases
+        return inputs;
+    }
+
+    template <typename ScalarFn, typename SimdFn>
+    bool Compare(const char* name, std::size_t count, std::size_t outFloats, ScalarFn&& scalar, SimdFn&& simd)
+    {
+        std::vector<float> expected(outFloats, 0.0f), actual(outFloats, 0.0f);
+        std::size_t mismatches = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            std::fill(expected.begin(), expected.end(), 0.0f);
+            std::fill(actual.begin(), actual.end(), 0.0f);
+            scalar(i, expected.data());
+            simd(i, actual.data());
+            if (std::memcmp(expected.data(), actual.data(), outFloats * sizeof(float)) != 0)
+                mismatches++;
+        }
+        std::printf("  %-20s %s (%zu / %zu differ)\n", name, mismatches ? "MISMATCH" : "bit-exact", mismatches, count);
+        return mismatches == 0;
+    }
+
+    template <typename Fn>
+    double NanosecondsPerCall(std::size_t count, int iterations, Fn&& fn)
+    {
+        // Every result is stored and summed afterwards so no call is dead
+        std::vector<float> results(count * 16, 0.0f);
+        std::vector<double> samples;
+        for (int it = 0; it < iterations; ++it)
+        {
+            const auto start = Clock::now();
+            for (std::size_t i = 0; i < count; ++i)
+                fn(i, results.data() + 16 * i);
+            samples.push_back(std::chrono::duration<double, std::nano>(Clock::now() - start).count() / double(count));
+
+            float sum = 0.0f;
+            for (std::size_t i = 0; i < count; i += 7)
+                sum += results[i];
+            g_sink = g_sink + sum;
+        }
+        std::sort(samples.begin(), samples.end());
+        return samples[samples.size() / 2];
+    }
+
+    // Largest element difference, relative to the larger magnitude when
+    // that is above one (translations run to a few hundred)
+    float MatrixError(const Matrix4x4& a, const Matrix4x4& b)
+    {
+        float error = 0.0f;
+        for (int i = 0; i < 4; ++i)
+        {
+            for (int j = 0; j < 4; ++j)
+            {
+                const float scale = std::max({1.0f, std::abs(a.m[i][j]), std::abs(b.m[i][j])});
+                error = std::max(error, std::abs(a.m[i][j] - b.m[i][j]) / scale);
+            }
+        }
+        return error;
+    }
+
+    bool Report(const char* name, float error, float tolerance)
+    {
+        const bool ok = error <= tolerance;
+        std::printf("  %-28s %s (max error %.3g)\n", name, ok ? "ok" : "FAILED", error);
+        return ok;
+    }
+
+    // The direct constructions must agree with the matrix products they
+    // replace, and CachedTransform must not serve a stale world matrix
+    bool CheckTransforms(const std::vector<Transform>& transforms)
+    {
+        float trsError = 0.0f, inverseError = 0.0f, normalError = 0.0f;
+        for (std::size_t i = 0; i < transforms.size(); ++i)
+        {
+            const Transform& t = transforms[i];
+            const Matrix4x4 m = t.ToMatrix();
+            const Matrix4x4 composed = Matrix4x4::Scale(t.scale) * Matrix4x4::Rotation(t.rotation) * Matrix4x4::Translation(t.position);
+            trsError = std::max(trsError, MatrixError(m, composed));
+            inverseError = std::max(inverseError, MatrixError(m * t.ToInverseMatrix(), Matrix4x4::Identity()));
+
+            // A surface normal stays perpendicular to the transformed surface
+            const Vector3 tangent = transforms[(i + 1) % transforms.size()].position;
+            const Vector3 normal = Vector3::Cross(tangent, t.position);
+            if (tangent.LengthSq() == 0.0f || normal.LengthSq() == 0.0f)
+                continue;
+            const Vector3 movedTangent = m.TransformDirection(tangent).Normalized();
+            const Vector3 movedNormal = t.ToNormalMatrix().TransformDirection(normal).Normalized();
+            normalError = std::max(normalError, std::abs(Vector3::Dot(movedTangent, movedNormal)));
+        }
+
+        // Parent -> child -> grandchild, moving the root after the first read
+        CachedTransform root, child, grandchild;
+        root.SetLocal(transforms[0]);
+        child.SetLocal(transforms[1]);
+        grandchild.SetLocal(transforms[2]);
+        child.SetParent(&root);
+        grandchild.SetParent(&child);
+        const Matrix4x4 before = grandchild.GetWorldMatrix();
+        root.SetPosition(root.GetPosition() + Vector3(10.0f, -5.0f, 2.5f));
+        root.SetRotation(Quaternion::FromAxisAngle(Vector3(0.0f, 1.0f, 0.0f), 0.5f));
+        const Matrix4x4 expected = transforms[2].ToMatrix() * transforms[1].ToMatrix() * root.GetLocal().ToMatrix();
+        const float staleError = MatrixError(grandchild.GetWorldMatrix(), expected);
+        const bool moved = MatrixError(before, expected) > 1e-3f;
+
+        bool ok = true;
+        ok &= Report("TRS == S * R * T", trsError, 1e-5f);
+        ok &= Report("TRS * InverseTRS == I", inverseError, 1e-4f);
+        ok &= Report("Normals perpendicular", normalError, 1e-4f);
+        ok &= Report("World follows parent", moved ? staleError : 1.0f, 1e-5f);
+        return ok;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t count = 100000;
+    int iterations = 20;
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        const std::string arg = argv[i];
+        if (arg == "--count") count = std::max<std::size_t>(16, std::strtoull(argv[i + 1], nullptr, 10));
+        else if (arg == "--iterations") iterations = std::max(1, std::atoi(argv[i + 1]));
+    }
+
+    const Inputs in = MakeInputs(count);
+    const float* M = in.matrices.data();
+    const float* V = in.vectors.data();
+    const std::size_t n = count - 1;
+
+    // Kernel pairs: scalar reference, dispatched
+    auto mulScalar = [&](std::size_t i, float* out) { MathScalar::MultiplyMatrix(M + 16 * i, M + 16 * (i + 1), out); };
+    auto mulSimd = [&](std::size_t i, float* out) { MathSimd::MultiplyMatrix(M + 16 * i, M + 16 * (i + 1), out); };
+    auto xfScalar = [&](std::size_t i, float* out) { MathScalar::TransformPoint(M + 16 * i, V + 4 * i, out); };
+    auto xfSimd = [&](std::size_t i, float* out) { MathSimd::TransformPoint(M + 16 * i, V + 4 * i, out); };
+    auto dotScalar = [&](std::size_t i, float* out) { out[0] = MathScalar::Dot3(V + 4 * i, V + 4 * (i + 1)); };
+    auto dotSimd = [&](std::size_t i, float* out) { out[0] = MathSimd::Dot3(V + 4 * i, V + 4 * (i + 1)); };
+    auto dot4Scalar = [&](std::size_t i, float* out) { out[0] = MathScalar::Dot4(V + 4 * i, V + 4 * (i + 1)); };
+    auto dot4Simd = [&](std::size_t i, float* out) { out[0] = MathSimd::Dot4(V + 4 * i, V + 4 * (i + 1)); };
+    auto crossScalar = [&](std::size_t i, float* out) { MathScalar::Cross(V + 4 * i, V + 4 * (i + 1), out); };
+    auto crossSimd = [&](std::size_t i, float* out) { MathSimd::Cross(V + 4 * i, V + 4 * (i + 1), out); };
+    auto normScalar = [&](std::size_t i, float* out) { MathScalar::Normalize3(V + 4 * i, out); };
+    auto normSimd = [&](std::size_t i, float* out) { MathSimd::Normalize3(V + 4 * i, out); };
+    auto quatScalar = [&](std::size_t i, float* out) { MathScalar::MultiplyQuaternion(V + 4 * i, V + 4 * (i + 1), out); };
+    auto quatSimd = [&](std::size_t i, float* out) { MathSimd::MultiplyQuaternion(V + 4 * i, V + 4 * (i + 1), out); };
+
+    std::printf("Math kernels: %s backend, %zu random inputs\n", MathSimd::GetBackendName(), n);
+    bool exact = true;
+    exact &= Compare("Matrix multiply", n, 16, mulScalar, mulSimd);
+    exact &= Compare("TransformPoint", n, 3, xfScalar, xfSimd);
+    exact &= Compare("Dot3", n, 1, dotScalar, dotSimd);
+    exact &= Compare("Dot4", n, 1, dot4Scalar, dot4Simd);
+    exact &= Compare("Cross", n, 3, crossScalar, crossSimd);
+    exact &= Compare("Normalize", n, 3, normScalar, normSimd);
+    exact &= Compare("Quaternion multiply", n, 4, quatScalar, quatSimd);
+
+    std::printf("\n  %-20s %10s %10s\n", "kernel (ns/call)", "scalar", "dispatched");
+    auto time = [&](const char* name, auto& scalar, auto& simd) {
+        std::printf("  %-20s %10.2f %10.2f\n", name,
+                    NanosecondsPerCall(n, iterations, scalar), NanosecondsPerCall(n, iterations, simd));
+    };
+    time("Matrix multiply", mulScalar, mulSimd);
+    time("TransformPoint", xfScalar, xfSimd);
+    time("Dot3", dotScalar, dotSimd);
+    time("Cross", crossScalar, crossSimd);
+    time("Normalize", normScalar, normSimd);
+    time("Quaternion multiply", quatScalar, quatSimd);
+
+    // --- Transform to matrix: three matrices and two products vs direct TRS ---
+    std::vector<Transform> transforms(n);
+    std::vector<CachedTransform> cached(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const float* v = V + 4 * i;
+        transforms[i] = Transform({v[0], v[1], v[2]}, Quaternion(v[3], v[0], v[1], v[2]).Normalized(), {1.0f, 2.0f, 3.0f});
+        cached[i].SetLocal(transforms[i]);
+    }
+    auto composed = [&](std::size_t i, float* out) {
+        const Transform& t = transforms[i];
+        const Matrix4x4 m = Matrix4x4::Scale(t.scale) * Matrix4x4::Rotation(t.rotation) * Matrix4x4::Translation(t.position);
+        std::memcpy(out, &m.m[0][0], sizeof(m));
+    };
+    auto direct = [&](std::size_t i, float* out) {
+        const Matrix4x4 m = transforms[i].ToMatrix();
+        std::memcpy(out, &m.m[0][0], sizeof(m));
+    };
+    auto unchanged = [&](std::size_t i, float* out) { std::memcpy(out, &cached[i].GetMatrix().m[0][0], sizeof(Matrix4x4)); };
+
+    std::printf("\nTransform matrices: %zu random transforms\n", n);
+    const bool transformsOk = CheckTransforms(transforms);
+
+    std::printf("\n  %-20s %10s %10s %10s\n", "ToMatrix (ns/call)", "products", "TRS", "cached");
+    std::printf("  %-20s %10.2f %10.2f %10.2f\n", "Transform",
+                NanosecondsPerCall(n, iterations, composed), NanosecondsPerCall(n, iterations, direct),
+                NanosecondsPerCall(n, iterations, unchanged));
+    return (exact && transformsOk) ? 0 : 1;
+}
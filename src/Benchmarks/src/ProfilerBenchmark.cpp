@@ -0,0 +1,157 @@
+// --- aurum-bench-profiler ---
+// Measures the cost of an AURUM_PROFILE_ZONE (begin + end) on the calling
+// thread and prints one collected frame as a call tree. Also overfills a
+// thread's event buffer and checks the collected tree stays balanced and
+// the buffer is released when the thread exits.
+//
+// Usage: aurum-bench-profiler [--zones N] [--frames N]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+#include <Framework/Profiler.hpp>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    volatile std::uint64_t g_sink = 0;
+
+    void Leaf(std::uint64_t i)
+    {
+        AURUM_PROFILE_ZONE("Leaf");
+        g_sink = g_sink + i;
+    }
+
+    void Inner(std::uint64_t i)
+    {
+        AURUM_PROFILE_ZONE("Inner");
+        Leaf(i);
+    }
+
+    void Bare(std::uint64_t i)
+    {
+        g_sink = g_sink + i;
+    }
+
+    void ReadClock(std::uint64_t)
+    {
+        g_sink = g_sink + Aurum::Profiler::Now();
+    }
+
+    void ReadCounter(std::uint64_t)
+    {
+        g_sink = g_sink + Aurum::TscClock::ReadTicks();
+    }
+
+    const Aurum::ProfileNode* FindRootChild(const Aurum::ProfileThreadTree& tree, const char* name)
+    {
+        for (std::uint32_t i = tree.nodes[0].firstChild; i != Aurum::ProfileNode::kNone; i = tree.nodes[i].nextSibling)
+            if (std::string(tree.nodes[i].site->name) == name)
+                return &tree.nodes[i];
+        return nullptr;
+    }
+
+    const Aurum::ProfileThreadTree* FindThread(const Aurum::ProfileFrame& frame, const char* name)
+    {
+        for (const Aurum::ProfileThreadTree& tree : frame.threads)
+            if (tree.name == name)
+                return &tree;
+        return nullptr;
+    }
+
+    // One zone holding more events than the ring: it must still close at
+    // the root with the overflow counted as dropped, and a zone recorded
+    // after the next drain must not nest under it. Once the thread exits
+    // its buffer is reported one last time and then released.
+    bool CheckOverfill()
+    {
+        std::atomic<int> stage{0};
+        std::thread worker([&] {
+            AURUM_PROFILE_THREAD("Overfill");
+            {
+                AURUM_PROFILE_ZONE("Flood");
+                for (std::size_t i = 0; i < Aurum::ProfileThreadBuffer::kCapacity; ++i)
+                    Inner(i);
+            }
+            stage = 1;
+            while (stage != 2)
+                std::this_thread::yield();
+            AURUM_PROFILE_ZONE("After");
+        });
+
+        while (stage != 1)
+            std::this_thread::yield();
+        AURUM_PROFILE_FRAME();
+        const Aurum::ProfileFrame& flooded = Aurum::Profiler::Get().GetLastFrame();
+        const Aurum::ProfileThreadTree* tree = FindThread(flooded, "Overfill");
+        const Aurum::ProfileNode* flood = tree ? FindRootChild(*tree, "Flood") : nullptr;
+        bool balanced = flooded.dropped > 0 && flood && flood->calls == 1;
+
+        stage = 2;
+        worker.join();
+        AURUM_PROFILE_FRAME();
+        tree = FindThread(Aurum::Profiler::Get().GetLastFrame(), "Overfill");
+        const Aurum::ProfileNode* after = tree ? FindRootChild(*tree, "After") : nullptr;
+        balanced &= after && after->calls == 1;
+
+        // The exited thread showed up one last time above and is freed now
+        AURUM_PROFILE_FRAME();
+        balanced &= FindThread(Aurum::Profiler::Get().GetLastFrame(), "Overfill") == nullptr;
+        return balanced;
+    }
+
+    template<typename Fn>
+    double NanosecondsPerCall(int zones, int frames, Fn&& body)
+    {
+        std::vector<double> samples;
+        for (int frame = 0; frame < frames; ++frame)
+        {
+            const auto start = Clock::now();
+            for (int i = 0; i < zones; ++i)
+                body(static_cast<std::uint64_t>(i));
+            samples.push_back(std::chrono::duration<double, std::nano>(Clock::now() - start).count() / zones);
+            AURUM_PROFILE_FRAME();
+        }
+        std::sort(samples.begin(), samples.end());
+        return samples[samples.size() / 2];
+    }
+}
+
+int main(int argc, char** argv)
+{
+    int zones = 10000; // Two zones per call: must stay below the buffer capacity
+    int frames = 200;
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        const std::string arg = argv[i];
+        if (arg == "--zones") zones = std::clamp(std::atoi(argv[i + 1]), 1, 16000);
+        else if (arg == "--frames") frames = std::max(1, std::atoi(argv[i + 1]));
+    }
+
+    AURUM_PROFILE_THREAD("Benchmark");
+
+    const double bare = NanosecondsPerCall(zones, frames, Bare);
+    const double clock = NanosecondsPerCall(zones, frames, ReadClock) - bare;
+    const double counter = NanosecondsPerCall(zones, frames, ReadCounter) - bare;
+    const double profiled = NanosecondsPerCall(zones, frames, Inner);
+    const std::string tree = Aurum::Profiler::Get().GetLastFrame().ToString(); // Last frame of the zone pass
+
+    std::printf("Profiler benchmark: %d calls x 2 zones per frame, median of %d frames\n", zones, frames);
+    std::printf("  bare call:        %7.2f ns\n", bare);
+    std::printf("  2 nested zones:   %7.2f ns\n", profiled);
+    std::printf("  per zone:         %7.2f ns\n", (profiled - bare) / 2.0);
+    std::printf("  of which clock:   %7.2f ns (2 reads of Profiler::Now)\n", 2.0 * clock);
+    std::printf("  of which counter: %7.2f ns (2 raw counter reads; the floor on this machine)\n", 2.0 * counter);
+
+    std::printf("\n%s", tree.c_str());
+
+    const bool balanced = CheckOverfill();
+    std::printf("\nOverfilled buffer: %s\n", balanced ? "tree balanced, overflow dropped, buffer released" : "FAILED, unbalanced tree");
+    return balanced ? 0 : 1;
+}
@@ -1,8 +1,13 @@
 #pragma once
 #include <memory>
 #include <Framework/Logger.hpp>
+#include <Framework/Logging/BinaryLog.hpp>
 #include <Framework/Config.hpp>
 #include <Framework/Timer.hpp>
+#include <Framework/MemoryTracker.hpp>
+#include <Framework/FrameArena.hpp>
+#include <Framework/Profiler.hpp>
+#include <Framework/TraceRecorder.hpp>
 #include <Engine/Window.hpp>
 #include <Engine/Renderer.hpp>
 #include <Engine/EventDispatcher.hpp>
@@ -32,7 +37,8 @@ namespace Aurum
     protected:
         // Lifecycle methods for derived applications
         virtual void OnInitialize() {}
-        virtual void OnUpdate(float deltaTime) {}
+        virtual void OnFixedUpdate(float fixedDeltaTime) {}   // 0..N times per frame, at the simulation rate
+        virtual void OnUpdate(float deltaTime) {}            // Once per frame; interpolate with GetInterpolationAlpha()
         virtual void OnShutdown() {}
 
         TimeSystem timeSystem_;
@@ -49,7 +55,12 @@ namespace Aurum
         InputManager input_{ eventDispatcher_ };  // ✅ integrated InputManager tied to EventDispatcher
         FrameTimer timer_;
 
+        std::uint64_t configGeneration_ = 0;
+        std::string traceCapturePath_;
+
         void Initialize();
         void Shutdown();
+        void PollConfigChanges();
+        void ApplyTraceCapture();
     };
 }
@@ -1,6 +1,8 @@
 #pragma once
 #include <Framework/Logger.hpp>
 #include <Engine/TimeSystem.hpp>
+#include <array>
+#include <cstddef>
 #include <string>
 
 namespace Aurum
@@ -15,23 +17,53 @@ namespace Aurum
             Logger::Get().Log("DebugOverlay initialized.", LogLevel::Info);
         }
 
+        // Appends frame statistics to this CSV file at every report (empty = off)
+        void SetCsvExport(const std::string& path) { csvPath_ = path; }
+
         void Update(const TimeSystem& timeSystem, bool logFrameStats = false)
         {
-            double delta = timeSystem.GetDeltaTime();
-            double fps   = timeSystem.GetFPS();
-
             if (logFrameStats)
             {
-                Logger::Get().Log(
-                    "Δt: " + std::to_string(delta) + "s | FPS: " + std::to_string(fps),
-                    LogLevel::Debug
-                );
+                AURUM_LOG_DEBUG("Δt: {:.6f}s | FPS: {:.2f}", timeSystem.GetDeltaTime(), timeSystem.GetFPS());
             }
+
+            // --- Frame stats report, once per interval ---
+            sinceReport_ += timeSystem.GetDeltaTime();
+            if (sinceReport_ < kReportInterval)
+                return;
+            sinceReport_ = 0.0;
+
+            if (logFrameStats)
+                DumpFrameStats(timeSystem);
+            if (!csvPath_.empty())
+                timeSystem.GetFrameStats().ExportCsv(csvPath_, kWindows);
+        }
+
+        // Logs min/mean/percentiles/max and hitches for each window
+        void DumpFrameStats(const TimeSystem& timeSystem) const
+        {
+            const FrameStats& stats = timeSystem.GetFrameStats();
+            auto dump = [](const char* label, const FrameStatsSummary& s)
+            {
+                AURUM_LOG_INFO("Frame stats [{}] n={} | min {:.2f} | mean {:.2f} | p50 {:.2f} | p95 {:.2f} | p99 {:.2f} | max {:.2f} ms | hitches {}",
+                               label, s.frames, s.min * 1e3, s.mean * 1e3, s.p50 * 1e3, s.p95 * 1e3, s.p99 * 1e3, s.max * 1e3, s.hitches);
+            };
+
+            dump("last 120", stats.Summarize(120));
+            dump("last 1000", stats.Summarize(1000));
+            dump("lifetime", stats.SummarizeLifetime());
         }
 
         void Shutdown()
         {
             Logger::Get().Log("DebugOverlay shut down.", LogLevel::Info);
         }
+
+    private:
+        static constexpr double kReportInterval = 1.0;
+        static constexpr std::array<std::size_t, 2> kWindows = { 120, 1000 };
+
+        std::string csvPath_;
+        double sinceReport_ = 0.0;
     };
 }
@@ -1,5 +1,7 @@
 #pragma once
 #include <Framework/Config.hpp>
+#include <Framework/ConfigSchema.hpp>
+#include <Framework/FramePacer.hpp>
 #include <Framework/Logger.hpp>
 
 namespace Aurum
@@ -20,13 +22,7 @@ namespace Aurum
                 return false;
             }
 
-            width_       = cfg.GetInt("window.width", 1280);
-            height_      = cfg.GetInt("window.height", 720);
-            fullscreen_  = cfg.GetBool("window.fullscreen", false);
-            targetFPS_   = cfg.GetFloat("render.target_fps", 60.0f);
-            vsync_       = cfg.GetBool("render.vsync", true);
-            debugLayer_  = cfg.GetBool("render.debug_layer", false);
-            showFPS_     = cfg.GetBool("debug.show_fps_overlay", false);
+            Refresh();
 
             Logger::Get().Log(
                 "Runtime Config Loaded: " + std::to_string(width_) + "x" +
@@ -38,14 +34,90 @@ namespace Aurum
             return true;
         }
 
+        // Re-reads every value from the current config snapshot, e.g. after
+        // ConfigManager hot-reloaded the file. Bad values are reported
+        // together and fall back to their defaults.
+        void Refresh();
+
         // --- Accessors ---
         int  GetWidth()        const { return width_; }
         int  GetHeight()       const { return height_; }
         bool IsFullscreen()    const { return fullscreen_; }
         float GetTargetFPS()   const { return targetFPS_; }
         bool IsVSyncEnabled()  const { return vsync_; }
+        FramePacingMode GetFramePacing() const { return framePacing_; }
+        double GetSimulationRate()     const { return simulationRate_; }
+        int  GetMaxSimulationSteps()   const { return maxSimulationSteps_; }
         bool IsDebugLayer()    const { return debugLayer_; }
         bool ShouldShowFPS()   const { return showFPS_; }
+        const std::string& GetFrameStatsCsvPath() const { return frameStatsCsv_; }
+        const std::string& GetTraceCapturePath() const { return traceCapture_; }
+        std::uint64_t GetTraceCaptureFrames() const { return traceFrames_; }
+        bool IsHotReload()     const { return hotReload_; }
+        bool IsAsyncLogging()  const { return asyncLogging_; }
+        const AsyncLogConfig& GetAsyncLogConfig() const { return logConfig_; }
+        bool IsThreadStagedLogging() const { return threadStaging_; }
+        bool IsConsoleLogging() const { return logToConsole_; }
+        const std::string& GetBinaryLogPath() const { return binaryLogPath_; }
+        const std::string& GetLogFilePath() const { return logFilePath_; }
+        std::uint64_t GetLogRotateBytes() const { return logRotateBytes_; }
+        std::size_t GetLogRotateBackups() const { return logRotateBackups_; }
+        const LogRateLimitConfig& GetLogRateLimit() const { return rateLimit_; }
+
+    private:
+        static constexpr std::pair<std::string_view, LogOverflowPolicy> kOverflowPolicyNames[] = {
+            { "block",       LogOverflowPolicy::Block },
+            { "drop_oldest", LogOverflowPolicy::DropOldest },
+            { "drop_newest", LogOverflowPolicy::DropNewest },
+        };
+
+        static constexpr std::pair<std::string_view, FramePacingMode> kFramePacingNames[] = {
+            { "spin",    FramePacingMode::Spin },
+            { "precise", FramePacingMode::Precise },
+        };
+
+        // --- Key paths, defaults and valid ranges ---
+        static constexpr auto Schema()
+        {
+            using Self = EngineRuntimeConfig;
+            return MakeConfigSchema<Self>(
+                ConfigField<Self>("window.width",           &Self::width_,       1280).Range(1, 16384),
+                ConfigField<Self>("window.height",          &Self::height_,      720).Range(1, 16384),
+                ConfigField<Self>("window.fullscreen",      &Self::fullscreen_,  false),
+                ConfigField<Self>("render.target_fps",      &Self::targetFPS_,   60.0f).Range(0.0f, 1000.0f),
+                ConfigField<Self>("render.vsync",           &Self::vsync_,       true),
+                ConfigField<Self>("render.frame_pacing",    &Self::framePacing_, kDefaultFramePacingMode)
+                    .Names(kFramePacingNames),
+                ConfigField<Self>("render.debug_layer",     &Self::debugLayer_,  false),
+                ConfigField<Self>("simulation.rate_hz",     &Self::simulationRate_, 60.0).Range(1.0, 1000.0),
+                ConfigField<Self>("simulation.max_steps",   &Self::maxSimulationSteps_, 5).Range(1, 64),
+                ConfigField<Self>("debug.show_fps_overlay", &Self::showFPS_,     false),
+                ConfigField<Self>("debug.frame_stats_csv",  &Self::frameStatsCsv_, ""),
+                ConfigField<Self>("debug.trace_capture",    &Self::traceCapture_,  ""),
+                ConfigField<Self>("debug.trace_frames",     &Self::traceFrames_,   0),
+                ConfigField<Self>("config.hot_reload",      &Self::hotReload_,   false),
+
+                ConfigField<Self>("logging.async",          &Self::asyncLogging_, false),
+                ConfigField<Self>("logging.queue_capacity",
+                    [](Self& c) -> auto& { return c.logConfig_.queueCapacity; }, 8192).Range(2, 1 << 24),
+                ConfigField<Self>("logging.overflow_policy",
+                    [](Self& c) -> auto& { return c.logConfig_.overflowPolicy; }, LogOverflowPolicy::Block)
+                    .Names(kOverflowPolicyNames),
+                ConfigField<Self>("logging.thread_staging", &Self::threadStaging_, false),
+                ConfigField<Self>("logging.console",        &Self::logToConsole_,  true),
+                ConfigField<Self>("logging.binary_file",    &Self::binaryLogPath_, ""),
+                ConfigField<Self>("logging.file",           &Self::logFilePath_,   ""),
+                ConfigField<Self>("logging.rotate_max_bytes", &Self::logRotateBytes_, 0),
+                ConfigField<Self>("logging.rotate_backups", &Self::logRotateBackups_, 3).Range(0, 100),
+                ConfigField<Self>("logging.rate_limit",
+                    [](Self& c) -> auto& { return c.rateLimit_.enabled; }, false),
+                ConfigField<Self>("logging.rate_limit_burst",
+                    [](Self& c) -> auto& { return c.rateLimit_.burst; }, 10),
+                ConfigField<Self>("logging.rate_limit_window_ms",
+                    [](Self& c) -> auto& { return c.rateLimit_.window; }, std::chrono::milliseconds(1000))
+                    .Range(std::chrono::milliseconds(1), std::chrono::milliseconds(60000))
+            );
+        }
 
     private:
         int   width_       = 1280;
@@ -53,7 +125,32 @@ namespace Aurum
         bool  fullscreen_  = false;
         float targetFPS_   = 60.0f;
         bool  vsync_       = true;
+        FramePacingMode framePacing_ = kDefaultFramePacingMode;
+        double simulationRate_ = 60.0;
+        int   maxSimulationSteps_ = 5;
         bool  debugLayer_  = false;
         bool  showFPS_     = false;
+        std::string frameStatsCsv_;
+        std::string traceCapture_;          // Chrome trace output; empty = no capture
+        std::uint64_t traceFrames_ = 0;     // 0 = until trace_capture is cleared
+        bool  hotReload_   = false;
+
+        bool  asyncLogging_ = false;
+        AsyncLogConfig logConfig_;
+        bool  threadStaging_ = false;
+        bool  logToConsole_ = true;
+        std::string binaryLogPath_;
+        std::string logFilePath_;
+        std::uint64_t logRotateBytes_ = 0;   // 0 = never rotate
+        std::size_t logRotateBackups_ = 3;
+        LogRateLimitConfig rateLimit_;
     };
+
+    // Defined after the class so Schema()'s return type is known
+    inline void EngineRuntimeConfig::Refresh()
+    {
+        static constexpr auto kSchema = Schema();
+        kSchema.Load(*ConfigManager::Get().Snapshot(), *this).Log("Runtime config");
+        rateLimit_.enabled = rateLimit_.enabled && rateLimit_.burst > 0;
+    }
 }
@@ -1,6 +1,7 @@
 #pragma once
 #include <string>
 #include <sstream>
+#include <cstdint>
 
 namespace Aurum
 {
@@ -16,7 +17,9 @@ namespace Aurum
         KeyReleased,
         MouseMoved,
         MouseButtonPressed,
-        MouseButtonReleased
+        MouseButtonReleased,
+        ConfigChanged,
+        TraceCapture
     };
 
     // ---------------------------------
@@ -110,4 +113,62 @@ namespace Aurum
     private:
         int keyCode_;
     };
+
+    // ---------------------------------
+    // Config Events
+    // ---------------------------------
+    // Published on the main thread after ConfigManager swapped in a new
+    // snapshot (hot reload or SetValue).
+    class ConfigChangedEvent : public Event
+    {
+    public:
+        explicit ConfigChangedEvent(std::uint64_t generation)
+            : generation_(generation) {}
+
+        std::uint64_t GetGeneration() const { return generation_; }
+
+        EventType GetType() const override { return EventType::ConfigChanged; }
+
+        std::string ToString() const override
+        {
+            std::stringstream ss;
+            ss << "ConfigChangedEvent: generation " << generation_;
+            return ss.str();
+        }
+
+    private:
+        std::uint64_t generation_;
+    };
+
+    // ---------------------------------
+    // Trace Capture Request
+    // ---------------------------------
+    // Starts (non-empty path) or stops (empty path) a Chrome trace capture.
+    // frames = 0 records until the next stop request.
+    class TraceCaptureEvent : public Event
+    {
+    public:
+        explicit TraceCaptureEvent(std::string path = {}, std::uint64_t frames = 0)
+            : path_(std::move(path)), frames_(frames) {}
+
+        const std::string& GetPath() const { return path_; }
+        std::uint64_t GetFrames() const { return frames_; }
+        bool IsStart() const { return !path_.empty(); }
+
+        EventType GetType() const override { return EventType::TraceCapture; }
+
+        std::string ToString() const override
+        {
+            std::stringstream ss;
+            if (IsStart())
+                ss << "TraceCaptureEvent: start " << path_ << " (" << frames_ << " frames)";
+            else
+                ss << "TraceCaptureEvent: stop";
+            return ss.str();
+        }
+
+    private:
+        std::string path_;
+        std::uint64_t frames_;
+    };
 }
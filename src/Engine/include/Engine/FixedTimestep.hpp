@@ -0,0 +1,80 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+
+namespace Aurum
+{
+    // ---------------------------------------
+    // Fixed Timestep: simulation step scheduler
+    // ---------------------------------------
+    // Turns variable frame times into a whole number of fixed simulation
+    // steps. Time is accumulated in integer nanoseconds, so the same frame
+    // times always produce the same step sequence.
+    //
+    // Spiral-of-death protection: a single frame contributes at most
+    // maxFrameTime, and at most maxSteps steps run per frame. Time beyond
+    // that is dropped (the simulation slows down instead of falling further
+    // behind) and counted in GetDroppedSteps().
+    class FixedTimestep
+    {
+    public:
+        using Nanoseconds = std::chrono::nanoseconds;
+
+        FixedTimestep() { SetRate(60.0); }
+
+        // Simulation steps per second
+        void SetRate(double hz)
+        {
+            const double rate = (hz > 0.0) ? hz : 60.0;
+            step_ = std::max<std::int64_t>(1, std::llround(1e9 / rate));
+            accumulator_ = std::min(accumulator_, step_ - 1);
+        }
+
+        void SetMaxSteps(int steps) { maxSteps_ = std::max(1, steps); }
+        void SetMaxFrameTime(double seconds) { maxFrameTime_ = std::llround(std::max(0.0, seconds) * 1e9); }
+
+        // Adds one frame's elapsed time; returns how many fixed steps to run
+        int Advance(double frameSeconds)
+        {
+            std::int64_t frame = std::llround(std::max(0.0, frameSeconds) * 1e9);
+            if (maxFrameTime_ > 0)
+                frame = std::min(frame, maxFrameTime_);
+
+            accumulator_ += frame;
+            std::int64_t steps = accumulator_ / step_;
+            accumulator_ -= steps * step_;
+
+            if (steps > maxSteps_)
+            {
+                droppedSteps_ += static_cast<std::uint64_t>(steps - maxSteps_);
+                steps = maxSteps_;
+            }
+
+            stepIndex_ += static_cast<std::uint64_t>(steps);
+            return static_cast<int>(steps);
+        }
+
+        // --- Accessors ---
+        double GetStep() const { return step_ * 1e-9; }
+        double GetRate() const { return 1e9 / step_; }
+        int GetMaxSteps() const { return maxSteps_; }
+
+        // Fraction of a step left over, for interpolating between the
+        // previous and current simulation state when rendering
+        double GetAlpha() const { return static_cast<double>(accumulator_) / static_cast<double>(step_); }
+
+        // Total steps run so far (the simulation tick number)
+        std::uint64_t GetStepIndex() const { return stepIndex_; }
+        std::uint64_t GetDroppedSteps() const { return droppedSteps_; }
+
+    private:
+        std::int64_t step_ = 0;
+        std::int64_t accumulator_ = 0;
+        std::int64_t maxFrameTime_ = 250'000'000; // 0.25 s
+        int maxSteps_ = 5;
+        std::uint64_t stepIndex_ = 0;
+        std::uint64_t droppedSteps_ = 0;
+    };
+}
@@ -1,8 +1,10 @@
 #pragma once
 #include <Framework/Timer.hpp>
+#include <Framework/FramePacer.hpp>
+#include <Framework/FrameStats.hpp>
+#include <Framework/Profiler.hpp>
 #include <Framework/Logger.hpp>
-#include <thread>
-#include <chrono>
+#include <Engine/FixedTimestep.hpp>
 
 namespace Aurum
 {
@@ -21,17 +23,45 @@ namespace Aurum
         // Initialize with optional target FPS (0 disables frame limiting)
         void Initialize(double targetFPS = 0.0)
         {
-            if (targetFPS > 0.0)
-                targetFrameTime_ = 1.0 / targetFPS;
+            SetTargetFPS(targetFPS);
+        }
+
+        // Can be changed at runtime, e.g. on config reload
+        void SetTargetFPS(double targetFPS)
+        {
+            targetFrameTime_ = (targetFPS > 0.0) ? 1.0 / targetFPS : 0.0;
+            pacer_.SetTargetFrameTime(targetFrameTime_);
+
+            // A hitch is a frame that took more than twice its budget
+            frameStats_.SetHitchThreshold(targetFrameTime_ > 0.0 ? 2.0 * targetFrameTime_ : 1.0 / 30.0);
+        }
+
+        void SetFramePacing(FramePacingMode mode) { pacer_.SetMode(mode); }
+
+        // Fixed simulation rate, independent of the frame rate
+        void SetSimulationRate(double hz, int maxStepsPerFrame)
+        {
+            fixedStep_.SetRate(hz);
+            fixedStep_.SetMaxSteps(maxStepsPerFrame);
         }
 
         void Tick()
         {
+            // --- Frame Limiter: wait for this frame's deadline ---
+            {
+                AURUM_PROFILE_ZONE("Frame Pacing");
+                pacer_.Wait();
+            }
+
             double dt = frameTimer_.Tick();
             deltaTime_ = dt;
             totalTime_ += dt; // ✅ accumulate total elapsed time
             accumulator_ += dt;
             frameCount_++;
+            frameStats_.Record(dt);
+
+            // --- Fixed-step simulation budget for this frame ---
+            fixedSteps_ = fixedStep_.Advance(dt);
 
             // --- FPS Calculation (once per second) ---
             if (accumulator_ >= 1.0)
@@ -40,36 +70,31 @@ namespace Aurum
                 frameCount_ = 0;
                 accumulator_ = 0.0;
             }
-
-            // --- Frame Limiter (Hybrid Sleep + Spin) ---
-            if (targetFrameTime_ > 0.0)
-            {
-                using namespace std::chrono;
-
-                double elapsed = frameTimer_.ElapsedSeconds();
-
-                // Coarse sleep until near target
-                while (elapsed < targetFrameTime_ - 0.002)
-                {
-                    std::this_thread::sleep_for(milliseconds(1));
-                    elapsed = frameTimer_.ElapsedSeconds();
-                }
-
-                // Fine busy-wait for last few microseconds
-                while (frameTimer_.ElapsedSeconds() < targetFrameTime_) {}
-            }
         }
 
         // --- Accessors ---
         double GetDeltaTime() const { return deltaTime_; }
         double GetFPS() const { return fps_; }
         double GetTargetFrameTime() const { return targetFrameTime_; }
+        const FramePacer& GetPacer() const { return pacer_; }
+
+        const FrameStats& GetFrameStats() const { return frameStats_; }
+
+        // --- Fixed-step simulation ---
+        int GetFixedSteps() const { return fixedSteps_; }
+        double GetFixedDeltaTime() const { return fixedStep_.GetStep(); }
+        double GetInterpolationAlpha() const { return fixedStep_.GetAlpha(); }
+        const FixedTimestep& GetFixedTimestep() const { return fixedStep_; }
 
         // ✅ Added for animated color / global timing
         double GetTotalTime() const { return totalTime_; }
 
     private:
         FrameTimer frameTimer_;
+        FramePacer pacer_;
+        FixedTimestep fixedStep_;
+        FrameStats frameStats_{ 4096 };
+        int fixedSteps_ = 0;
         double deltaTime_;
         double fps_;
         double targetFrameTime_;
@@ -21,11 +21,50 @@ namespace Aurum
     {
         Logger::Get().Log("Initializing Application...", LogLevel::Info);
 
-        // --- Load runtime configuration ---
+        // --- Load runtime configuration (mapped from config/*.json.bin when current) ---
+        ConfigManager::Get().SetBinaryCache(true);
         runtimeConfig_.Load("config/engine_runtime.json");
 
+        // --- Move log output off the main thread if requested ---
+        if (runtimeConfig_.IsAsyncLogging())
+            Logger::Get().StartAsync(runtimeConfig_.GetAsyncLogConfig());
+        else if (runtimeConfig_.IsThreadStagedLogging())
+            Logger::Get().EnableThreadStaging();
+
+        // --- Optional compact binary log (decode with aurum-logdecode) ---
+        if (!runtimeConfig_.GetBinaryLogPath().empty())
+            Logger::Get().AddSink("binary", std::make_shared<BinaryLogSink>(runtimeConfig_.GetBinaryLogPath()));
+
+        // --- Text log file, rotated by size when a limit is configured ---
+        const std::string& logFile = runtimeConfig_.GetLogFilePath();
+        if (!logFile.empty() && runtimeConfig_.GetLogRotateBytes() > 0)
+            Logger::Get().AddSink("file", std::make_shared<RotatingFileLogSink>(
+                logFile, runtimeConfig_.GetLogRotateBytes(), runtimeConfig_.GetLogRotateBackups()));
+        else if (!logFile.empty())
+            Logger::Get().SetLogFile(logFile);
+
+        Logger::Get().SetConsoleEnabled(runtimeConfig_.IsConsoleLogging());
+        Logger::Get().SetRateLimit(runtimeConfig_.GetLogRateLimit());
+
+        // --- Pick up edits to the config file without a restart ---
+        configGeneration_ = ConfigManager::Get().GetGeneration();
+        if (runtimeConfig_.IsHotReload())
+            ConfigManager::Get().StartWatching();
+
         // --- Initialize time system with configured target FPS ---
         timeSystem_.Initialize(runtimeConfig_.GetTargetFPS());
+        timeSystem_.SetFramePacing(runtimeConfig_.GetFramePacing());
+        timeSystem_.SetSimulationRate(runtimeConfig_.GetSimulationRate(), runtimeConfig_.GetMaxSimulationSteps());
+
+        // --- Chrome trace capture: debug.trace_capture or a TraceCaptureEvent ---
+        eventDispatcher_.Subscribe<TraceCaptureEvent>([](const TraceCaptureEvent& e)
+        {
+            if (e.IsStart())
+                TraceRecorder::Get().Start(e.GetPath(), e.GetFrames());
+            else
+                TraceRecorder::Get().Stop();
+        });
+        ApplyTraceCapture();
 
         // --- Create the main application window ---
         window_ = std::make_unique<Window>(
@@ -60,10 +99,20 @@ namespace Aurum
 
         OnShutdown();
 
+        ConfigManager::Get().StopWatching();
+        TraceRecorder::Get().Stop();
         renderer_.reset();
         window_.reset();
 
+#if AURUM_MEMORY_TRACKING
+        MemoryTracker::Get().Report();
+        MemoryTracker::Get().ReportTags();
+        MemoryTracker::Get().ReportSites();
+#endif
+
         Logger::Get().Log("Application shutdown complete.", LogLevel::Info);
+        Logger::Get().StopAsync();
+        Logger::Get().Flush();
     }
 
     // ------------------------------------------------------------
@@ -75,6 +124,7 @@ namespace Aurum
         MSG msg = {};
         timer_.Tick();    // Prime timer
         timeSystem_.Tick();
+        AURUM_PROFILE_THREAD("Main");
 
         while (running_)
         {
@@ -94,28 +144,93 @@ namespace Aurum
 
             if (!running_) break;
 
+            // --- Per-frame scratch memory ---
+            FrameArena::Get().BeginFrame();
+
+            // --- Config hot reload ---
+            PollConfigChanges();
+
             // --- Frame timing ---
             timeSystem_.Tick();
             const float dt = static_cast<float>(timeSystem_.GetDeltaTime());
+            AURUM_TRACE_COUNTER("Frame Time (ms)", dt * 1000.0f);
+            AURUM_TRACE_COUNTER("Fixed Steps", timeSystem_.GetFixedSteps());
+
+            // --- Fixed-step simulation ---
+            {
+                AURUM_PROFILE_ZONE("Fixed Update");
+                const float fixedDt = static_cast<float>(timeSystem_.GetFixedDeltaTime());
+                for (int step = 0; step < timeSystem_.GetFixedSteps(); ++step)
+                    OnFixedUpdate(fixedDt);
+            }
 
             // --- Game / Engine update ---
-            OnUpdate(dt);
+            {
+                AURUM_PROFILE_ZONE("Update");
+                AURUM_MEMORY_TAG("Game");
+                OnUpdate(dt);
+            }
 
             // --- Rendering ---
             if (renderer_)
             {
+                AURUM_PROFILE_ZONE("Render");
+                AURUM_MEMORY_TAG("Renderer");
                 renderer_->Clear(0.1f, 0.1f, 0.3f); // Default clear color
                 renderer_->Present();
             }
 
             // --- Debug logging ---
-            Logger::Get().Log(
-                "Δt: " + std::to_string(dt) +
-                "s | FPS: " + std::to_string(timeSystem_.GetFPS()),
-                LogLevel::Debug
-            );
+            AURUM_LOG_DEBUG("Δt: {:.6f}s | FPS: {:.2f}", dt, timeSystem_.GetFPS());
+            Logger::Get().PollStaging();
+
+            // --- Close the profiler and memory frames ---
+            AURUM_PROFILE_FRAME();
+#if AURUM_MEMORY_TRACKING
+            MemoryTracker::Get().EndFrame();
+            AURUM_TRACE_COUNTER("Allocations", MemoryTracker::Get().GetStats().frameAllocations);
+#endif
         }
 
         Shutdown();
     }
+
+    // ------------------------------------------------------------
+    // Applies a config snapshot swapped in by the watcher thread. Runs on
+    // the main thread so subscribers never see events from other threads.
+    void Application::PollConfigChanges()
+    {
+        AURUM_PROFILE_FUNCTION();
+        AURUM_MEMORY_TAG("Config");
+        const std::uint64_t generation = ConfigManager::Get().GetGeneration();
+        if (generation == configGeneration_)
+            return;
+        configGeneration_ = generation;
+
+        runtimeConfig_.Refresh();
+        timeSystem_.SetTargetFPS(runtimeConfig_.GetTargetFPS());
+        timeSystem_.SetFramePacing(runtimeConfig_.GetFramePacing());
+        timeSystem_.SetSimulationRate(runtimeConfig_.GetSimulationRate(), runtimeConfig_.GetMaxSimulationSteps());
+        ApplyTraceCapture();
+        Logger::Get().SetRateLimit(runtimeConfig_.GetLogRateLimit());
+
+        Logger::Get().Log("Runtime config updated | FPS=" + std::to_string(runtimeConfig_.GetTargetFPS()), LogLevel::Info);
+        eventDispatcher_.Publish(ConfigChangedEvent(generation));
+    }
+
+    // ------------------------------------------------------------
+    // Starts or stops a capture when debug.trace_capture changes. Acting
+    // only on changes lets a finished fixed-length capture stay finished.
+    void Application::ApplyTraceCapture()
+    {
+        const std::string& path = runtimeConfig_.GetTraceCapturePath();
+        if (path == traceCapturePath_)
+            return;
+        traceCapturePath_ = path;
+
+        if (path.empty())
+            TraceRecorder::Get().Stop();
+        else
+            TraceRecorder::Get().Start(path, runtimeConfig_.GetTraceCaptureFrames());
+    }
 }
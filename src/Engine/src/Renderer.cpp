@@ -3,6 +3,7 @@
 // Adds RenderFrame() for a full per-frame clear + present cycle
 
 #include <Engine/Renderer.hpp>
+#include <Framework/Profiler.hpp>
 #include <directx/d3dx12.h>
 
 using namespace Aurum;
@@ -225,6 +226,7 @@ void Renderer::WaitForGPU()
 
     if (fence_->GetCompletedValue() < fenceToWaitFor)
     {
+        AURUM_PROFILE_ZONE("WaitForGPU");
         fence_->SetEventOnCompletion(fenceToWaitFor, fenceEvent_);
         WaitForSingleObject(fenceEvent_, INFINITE);
     }
@@ -0,0 +1,27 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Aurum
+{
+    // ---------------------------------------
+    // Call Stack: capture and symbolize return addresses
+    // ---------------------------------------
+    // Capture() never touches the C++ heap, so it is safe inside the global
+    // operator new hook. Symbolize() allocates and is meant for reports.
+    namespace CallStack
+    {
+        constexpr std::size_t kMaxFrames = 16;
+
+        // Fills frames with up to maxFrames return addresses of the caller,
+        // skipping the innermost skip frames; returns the count captured
+        std::size_t Capture(void** frames, std::size_t maxFrames, std::size_t skip = 0);
+
+        // FNV-1a over the frame addresses
+        std::uint64_t Hash(void* const* frames, std::size_t count);
+
+        // "function (module+0x1a2b)" or the raw address if unknown
+        std::string Symbolize(void* address);
+    }
+}
@@ -4,15 +4,257 @@
 #include <fstream>
 #include <sstream>
 #include <iostream>
+#include <iomanip>
 #include <stdexcept>
+#include <string_view>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <type_traits>
 
 #include <thirdparty/nlohmann/json.hpp>
+#include <Framework/ConfigBlob.hpp>
+#include <Framework/ConfigKey.hpp>
+#include <Framework/ConfigWatcher.hpp>
 #include <Framework/Logger.hpp>
 
 namespace Aurum
 {
-    using json = nlohmann::json;
+    // ------------------------------------------------------------
+    // Config Snapshot
+    // ------------------------------------------------------------
+    // An immutable parsed config. ConfigManager publishes a new snapshot
+    // for every load, reload or edit, so a reader holding one sees a
+    // consistent view even while the file is reloaded on another thread.
+    //
+    // A snapshot is backed either by a json tree or by a mapped ConfigBlob.
+    // Blob-backed snapshots answer scalar lookups straight from the blob
+    // and only build the json tree when Data() or Find() is called.
+    class ConfigSnapshot
+    {
+    public:
+        ConfigSnapshot(json data, std::string sourcePath, std::uint64_t sourceHash, std::uint64_t generation)
+            : data_(std::move(data)), sourcePath_(std::move(sourcePath)),
+              sourceHash_(sourceHash), generation_(generation) {}
+
+        ConfigSnapshot(std::shared_ptr<const ConfigBlob> blob, std::string sourcePath, std::uint64_t generation)
+            : blob_(std::move(blob)), sourcePath_(std::move(sourcePath)),
+              sourceHash_(blob_->GetSourceHash()), generation_(generation) {}
+
+        const json& Data() const
+        {
+            if (blob_)
+                std::call_once(materialized_, [this]() { data_ = json::parse(blob_->GetDocument(), nullptr, false); });
+            return data_;
+        }
+
+        const std::string& GetSourcePath() const { return sourcePath_; }
+        std::uint64_t GetSourceHash() const { return sourceHash_; } // 0 after SetValue
+        std::uint64_t GetGeneration() const { return generation_; }
+        bool IsBlobBacked() const { return blob_ != nullptr; }
+        const ConfigBlob* GetBlob() const { return blob_.get(); }
+
+        // -----------------------------
+        // Path Lookup
+        // -----------------------------
+        // Keys are dotted paths ("window.width") or JSON pointers
+        // ("/window/width"). Returns nullptr when the path does not exist.
+        const json* Find(std::string_view path) const
+        {
+            if (const json* node = ConfigPath::Resolve(Data(), path))
+                return node;
+            return FindFlat(path);
+        }
+
+        // Allocation-free lookup through a pre-parsed handle
+        const json* Find(const ConfigKey& key) const
+        {
+            if (const json* node = key.Resolve(Data()))
+                return node;
+            return FindFlat(key.Path());
+        }
+
+        bool Contains(std::string_view path) const { return blob_ ? blob_->Find(path) != nullptr : Find(path) != nullptr; }
+        bool Contains(const ConfigKey& key) const { return blob_ ? blob_->Find(key) != nullptr : Find(key) != nullptr; }
+
+        // -----------------------------
+        // Typed Accessors
+        // -----------------------------
+        template<typename T>
+        T GetValue(std::string_view key, const T& defaultValue = T{}) const
+        {
+            return Read(key, key, defaultValue);
+        }
+
+        template<typename T>
+        T GetValue(const ConfigKey& key, const T& defaultValue = T{}) const
+        {
+            return Read(key, key.Path(), defaultValue);
+        }
+
+        int GetInt(std::string_view key, int defaultValue = 0) const { return GetValue<int>(key, defaultValue); }
+        int GetInt(const ConfigKey& key, int defaultValue = 0) const { return GetValue<int>(key, defaultValue); }
+
+        float GetFloat(std::string_view key, float defaultValue = 0.0f) const { return GetValue<float>(key, defaultValue); }
+        float GetFloat(const ConfigKey& key, float defaultValue = 0.0f) const { return GetValue<float>(key, defaultValue); }
+
+        bool GetBool(std::string_view key, bool defaultValue = false) const { return ReadBoolAt(key, key, defaultValue); }
+        bool GetBool(const ConfigKey& key, bool defaultValue = false) const { return ReadBoolAt(key, key.Path(), defaultValue); }
+
+        std::string GetString(std::string_view key, const std::string& defaultValue = "") const
+        {
+            return GetValue<std::string>(key, defaultValue);
+        }
+
+        std::string GetString(const ConfigKey& key, const std::string& defaultValue = "") const
+        {
+            return GetValue<std::string>(key, defaultValue);
+        }
+
+    private:
+        template<typename T>
+        static constexpr bool kBlobReadable = std::is_arithmetic_v<T> || std::is_same_v<T, std::string>;
+
+        // Older configs spelled nested keys as literal top-level names
+        const json* FindFlat(std::string_view path) const
+        {
+            const json& data = Data();
+            if (ConfigPath::IsPointer(path) || path.find('.') == std::string_view::npos || !data.is_object())
+                return nullptr;
+
+            const auto it = data.find(path);
+            return it != data.end() ? &*it : nullptr;
+        }
+
+        template<typename T, typename Key>
+        T Read(const Key& key, std::string_view name, const T& defaultValue) const
+        {
+            if constexpr (kBlobReadable<T>)
+            {
+                if (blob_)
+                    return ReadBlobValue(blob_->Find(key), name, defaultValue);
+            }
+            return ReadValue(Find(key), name, defaultValue);
+        }
+
+        template<typename Key>
+        bool ReadBoolAt(const Key& key, std::string_view name, bool defaultValue) const
+        {
+            return blob_ ? ReadBlobBool(blob_->Find(key), name, defaultValue)
+                         : ReadBool(Find(key), name, defaultValue);
+        }
+
+        // Same conversions as json::get<T>() for the scalar types
+        template<typename T>
+        T ReadBlobValue(const ConfigBlob::Entry* entry, std::string_view key, const T& defaultValue) const
+        {
+            if (!entry)
+                return defaultValue;
+
+            if constexpr (std::is_same_v<T, std::string>)
+            {
+                if (entry->type == ConfigValueType::String)
+                    return std::string(blob_->AsString(*entry));
+            }
+            else if constexpr (std::is_same_v<T, bool>)
+            {
+                if (entry->type == ConfigValueType::Bool)
+                    return ConfigBlob::AsBool(*entry);
+            }
+            else
+            {
+                switch (entry->type)
+                {
+                    case ConfigValueType::Int:    return static_cast<T>(ConfigBlob::AsInt(*entry));
+                    case ConfigValueType::Double: return static_cast<T>(ConfigBlob::AsDouble(*entry));
+                    case ConfigValueType::Bool:   return static_cast<T>(ConfigBlob::AsBool(*entry));
+                    default: break;
+                }
+            }
+
+            Logger::Get().Log("Config key type mismatch: " + std::string(key), LogLevel::Warning);
+            return defaultValue;
+        }
+
+        bool ReadBlobBool(const ConfigBlob::Entry* entry, std::string_view, bool defaultValue) const
+        {
+            if (!entry)
+                return defaultValue;
+
+            switch (entry->type)
+            {
+                case ConfigValueType::Bool: return ConfigBlob::AsBool(*entry);
+                case ConfigValueType::Int:  return static_cast<int>(ConfigBlob::AsInt(*entry)) != 0;
+                case ConfigValueType::String:
+                {
+                    const std::string_view val = blob_->AsString(*entry);
+                    return (val == "1" || val == "true" || val == "True" || val == "TRUE");
+                }
+                default: return defaultValue;
+            }
+        }
+
+        template<typename T>
+        static T ReadValue(const json* node, std::string_view key, const T& defaultValue)
+        {
+            if (!node)
+                return defaultValue;
+
+            try
+            {
+                return node->get<T>();
+            }
+            catch (...)
+            {
+                Logger::Get().Log("Config key type mismatch: " + std::string(key), LogLevel::Warning);
+                return defaultValue;
+            }
+        }
+
+        static bool ReadBool(const json* node, std::string_view key, bool defaultValue)
+        {
+            if (!node)
+                return defaultValue;
+
+            try
+            {
+                if (node->is_boolean())
+                    return node->get<bool>();
+
+                if (node->is_number_integer())
+                    return node->get<int>() != 0;
+
+                if (node->is_string())
+                {
+                    const auto& val = node->get_ref<const std::string&>();
+                    return (val == "1" || val == "true" || val == "True" || val == "TRUE");
+                }
+
+                return defaultValue;
+            }
+            catch (...)
+            {
+                Logger::Get().Log("Config key parse failed for bool: " + std::string(key), LogLevel::Warning);
+                return defaultValue;
+            }
+        }
 
+        std::shared_ptr<const ConfigBlob> blob_;
+        mutable json data_;
+        mutable std::once_flag materialized_;
+        const std::string sourcePath_;
+        const std::uint64_t sourceHash_ = 0;
+        const std::uint64_t generation_;
+    };
+
+    // ------------------------------------------------------------
+    // Config Manager
+    // ------------------------------------------------------------
+    // Readers never lock: they take the current snapshot through an atomic
+    // shared pointer, and a reload only swaps that pointer (RCU-style).
+    // Writers (Load, Reload, SetValue) are serialized among themselves.
+    // Code that reads several keys per frame should hold one Snapshot()
+    // for the whole frame instead of going through the Get* helpers.
     class ConfigManager
     {
     public:
@@ -28,30 +270,50 @@ namespace Aurum
         // -----------------------------
         bool Load(const std::string& path)
         {
-            std::ifstream file(path);
-            if (!file.is_open())
-            {
-                Logger::Get().Log("Failed to open config file: " + path, LogLevel::Error);
+            std::lock_guard<std::mutex> lock(writeMutex_);
+            if (!ParseAndPublish(path))
                 return false;
-            }
 
-            try
-            {
-                file >> data_;
-                filePath_ = path;
-                Logger::Get().Log("Config loaded successfully: " + path, LogLevel::Info);
-                return true;
-            }
-            catch (const std::exception& e)
-            {
-                Logger::Get().Log(std::string("Config parse error: ") + e.what(), LogLevel::Error);
+            filePath_ = path;
+            Logger::Get().Log("Config loaded successfully: " + path, LogLevel::Info);
+            return true;
+        }
+
+        // -----------------------------
+        // Binary Cache
+        // -----------------------------
+        // When enabled, Load() and Reload() map "<path>.bin" instead of
+        // parsing JSON if the blob was compiled from identical source bytes,
+        // and (re)compile the blob after every real parse.
+        void SetBinaryCache(bool enabled) { binaryCache_.store(enabled, std::memory_order_relaxed); }
+        bool IsBinaryCacheEnabled() const { return binaryCache_.load(std::memory_order_relaxed); }
+        static std::string GetCachePath(const std::string& path) { return path + ".bin"; }
+
+        // Re-reads the last loaded file. A parse error keeps the current
+        // snapshot; an unchanged file does not publish a new one.
+        bool Reload()
+        {
+            std::lock_guard<std::mutex> lock(writeMutex_);
+            if (filePath_.empty())
                 return false;
-            }
+
+            const std::uint64_t before = GetGeneration();
+            if (!ParseAndPublish(filePath_, true))
+                return false;
+
+            if (GetGeneration() != before)
+                Logger::Get().Log("Config reloaded: " + filePath_, LogLevel::Info);
+            return true;
         }
 
         bool Save(const std::string& path = "")
         {
-            std::string outPath = path.empty() ? filePath_ : path;
+            std::string outPath;
+            {
+                std::lock_guard<std::mutex> lock(writeMutex_);
+                outPath = path.empty() ? filePath_ : path;
+            }
+
             if (outPath.empty())
             {
                 Logger::Get().Log("Config save failed: No file path specified.", LogLevel::Error);
@@ -65,92 +327,203 @@ namespace Aurum
                 return false;
             }
 
-            file << std::setw(4) << data_;
+            file << std::setw(4) << Snapshot()->Data();
             Logger::Get().Log("Config saved: " + outPath, LogLevel::Info);
             return true;
         }
 
+        // -----------------------------
+        // Snapshots
+        // -----------------------------
+        std::shared_ptr<const ConfigSnapshot> Snapshot() const
+        {
+            return snapshot_.load(std::memory_order_acquire);
+        }
+
+        // Bumped every time a new snapshot is published. Cheap enough to
+        // poll once per frame to detect reloads.
+        std::uint64_t GetGeneration() const { return generation_.load(std::memory_order_acquire); }
+
+        // -----------------------------
+        // Hot Reload
+        // -----------------------------
+        // Watches the loaded file and reloads it on a background thread
+        // whenever it is saved.
+        bool StartWatching()
+        {
+            std::string path;
+            {
+                std::lock_guard<std::mutex> lock(writeMutex_);
+                path = filePath_;
+            }
+            if (path.empty())
+                return false;
+
+            return watcher_.Start(path, [this]() { Reload(); });
+        }
+
+        void StopWatching() { watcher_.Stop(); }
+        bool IsWatching() const { return watcher_.IsRunning(); }
+
         // -----------------------------
         // Generic JSON Accessors
         // -----------------------------
-        template<typename T>
-        T GetValue(const std::string& key, const T& defaultValue = T{}) const
+        template<typename T, typename Key>
+        T GetValue(const Key& key, const T& defaultValue = T{}) const
         {
-            if (!data_.contains(key))
-                return defaultValue;
+            return Snapshot()->template GetValue<T>(key, defaultValue);
+        }
 
+        // Copy-on-write: publishes a new snapshot with the value replaced.
+        // Intermediate objects are created as needed.
+        template<typename T>
+        void SetValue(std::string_view key, const T& value)
+        {
+            std::lock_guard<std::mutex> lock(writeMutex_);
+            json data = Snapshot()->Data();
             try
             {
-                return data_.at(key).get<T>();
+                data[json::json_pointer(ToPointer(key))] = value;
             }
-            catch (...)
+            catch (const std::exception& e)
             {
-                Logger::Get().Log("Config key type mismatch: " + key, LogLevel::Warning);
-                return defaultValue;
+                Logger::Get().Log("Config set failed for " + std::string(key) + ": " + e.what(), LogLevel::Warning);
+                return;
             }
+            Publish(std::move(data), 0, Snapshot()->GetSourcePath());
         }
 
-        template<typename T>
-        void SetValue(const std::string& key, const T& value)
-        {
-            data_[key] = value;
-        }
+        bool Contains(std::string_view path) const { return Snapshot()->Contains(path); }
+        bool Contains(const ConfigKey& key) const { return Snapshot()->Contains(key); }
 
         // -----------------------------
         // Strongly Typed Helpers
         // -----------------------------
-        int GetInt(const std::string& key, int defaultValue = 0) const
-        {
-            return GetValue<int>(key, defaultValue);
-        }
+        template<typename Key>
+        int GetInt(const Key& key, int defaultValue = 0) const { return Snapshot()->GetInt(key, defaultValue); }
+
+        template<typename Key>
+        float GetFloat(const Key& key, float defaultValue = 0.0f) const { return Snapshot()->GetFloat(key, defaultValue); }
+
+        template<typename Key>
+        bool GetBool(const Key& key, bool defaultValue = false) const { return Snapshot()->GetBool(key, defaultValue); }
 
-        float GetFloat(const std::string& key, float defaultValue = 0.0f) const
+        template<typename Key>
+        std::string GetString(const Key& key, const std::string& defaultValue = "") const
         {
-            return GetValue<float>(key, defaultValue);
+            return Snapshot()->GetString(key, defaultValue);
         }
 
-        bool GetBool(const std::string& key, bool defaultValue = false) const
-        {
-            if (!data_.contains(key))
-                return defaultValue;
+    private:
+        // Private Constructor (Singleton)
+        ConfigManager() = default;
+        ~ConfigManager() { StopWatching(); }
 
-            try
+        ConfigManager(const ConfigManager&) = delete;
+        ConfigManager& operator=(const ConfigManager&) = delete;
+
+        // Caller must hold writeMutex_
+        bool ParseAndPublish(const std::string& path, bool skipIfUnchanged = false)
+        {
+            std::string text;
+            if (!ReadFile(path, text))
             {
-                if (data_.at(key).is_boolean())
-                    return data_.at(key).get<bool>();
+                Logger::Get().Log("Failed to open config file: " + path, LogLevel::Error);
+                return false;
+            }
 
-                if (data_.at(key).is_number_integer())
-                    return data_.at(key).get<int>() != 0;
+            const std::uint64_t sourceHash = ConfigBlob::HashContent(text);
+            if (skipIfUnchanged && sourceHash == Snapshot()->GetSourceHash())
+                return true;
 
-                if (data_.at(key).is_string())
+            // --- Fast path: compiled blob that still matches the source ---
+            const bool useCache = binaryCache_.load(std::memory_order_relaxed);
+            if (useCache)
+            {
+                auto blob = std::make_shared<ConfigBlob>();
+                if (blob->Open(GetCachePath(path)) && blob->Matches(sourceHash, text.size()))
                 {
-                    std::string val = data_.at(key).get<std::string>();
-                    return (val == "1" || val == "true" || val == "True" || val == "TRUE");
+                    PublishBlob(std::move(blob), path);
+                    return true;
                 }
+            }
 
-                return defaultValue;
+            json data;
+            try
+            {
+                data = json::parse(text);
             }
-            catch (...)
+            catch (const std::exception& e)
             {
-                Logger::Get().Log("Config key parse failed for bool: " + key, LogLevel::Warning);
-                return defaultValue;
+                Logger::Get().Log(std::string("Config parse error: ") + e.what(), LogLevel::Error);
+                return false;
             }
+
+            if (useCache && !ConfigBlob::Compile(data, sourceHash, text.size(), GetCachePath(path)))
+                Logger::Get().Log("Config cache not written for " + path, LogLevel::Debug);
+
+            Publish(std::move(data), sourceHash, path);
+            return true;
         }
 
-        std::string GetString(const std::string& key, const std::string& defaultValue = "") const
+        static bool ReadFile(const std::string& path, std::string& out)
         {
-            return GetValue<std::string>(key, defaultValue);
+            std::ifstream file(path, std::ios::binary | std::ios::ate);
+            if (!file.is_open())
+                return false;
+
+            out.resize(static_cast<std::size_t>(file.tellg()));
+            file.seekg(0);
+            file.read(out.data(), static_cast<std::streamsize>(out.size()));
+            return file.good() || file.eof();
         }
 
-    private:
-        // Private Constructor (Singleton)
-        ConfigManager() = default;
-        ~ConfigManager() = default;
+        // Caller must hold writeMutex_
+        void Publish(json data, std::uint64_t sourceHash, const std::string& sourcePath)
+        {
+            const std::uint64_t generation = generation_.load(std::memory_order_relaxed) + 1;
+            snapshot_.store(std::make_shared<const ConfigSnapshot>(
+                std::move(data), sourcePath, sourceHash, generation), std::memory_order_release);
+            generation_.store(generation, std::memory_order_release);
+        }
 
-        ConfigManager(const ConfigManager&) = delete;
-        ConfigManager& operator=(const ConfigManager&) = delete;
+        // Caller must hold writeMutex_
+        void PublishBlob(std::shared_ptr<const ConfigBlob> blob, const std::string& sourcePath)
+        {
+            const std::uint64_t generation = generation_.load(std::memory_order_relaxed) + 1;
+            snapshot_.store(std::make_shared<const ConfigSnapshot>(
+                std::move(blob), sourcePath, generation), std::memory_order_release);
+            generation_.store(generation, std::memory_order_release);
+        }
+
+        static std::string ToPointer(std::string_view path)
+        {
+            if (ConfigPath::IsPointer(path))
+                return std::string(path);
+
+            std::string pointer;
+            std::string scratch;
+            ConfigPath::ForEachSegment(path, scratch, [&](std::string_view segment)
+            {
+                pointer += '/';
+                for (char c : segment)
+                {
+                    if (c == '~')      pointer += "~0";
+                    else if (c == '/') pointer += "~1";
+                    else               pointer += c;
+                }
+                return true;
+            });
+            return pointer;
+        }
+
+        std::atomic<std::shared_ptr<const ConfigSnapshot>> snapshot_{
+            std::make_shared<const ConfigSnapshot>(json::object(), std::string(), 0, 0) };
+        std::atomic<std::uint64_t> generation_{0};
+        std::atomic<bool> binaryCache_{false};
 
-        json data_;
-        std::string filePath_;
+        std::mutex writeMutex_;
+        std::string filePath_; // Guarded by writeMutex_
+        ConfigWatcher watcher_;
     };
 }
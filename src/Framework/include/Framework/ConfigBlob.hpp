@@ -0,0 +1,128 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <Framework/ConfigKey.hpp>
+#include <Framework/MappedFile.hpp>
+
+namespace Aurum
+{
+    enum class ConfigValueType : std::uint32_t
+    {
+        Null = 0,
+        Bool,
+        Int,    // Signed 64-bit
+        Double,
+        String, // Offset/length into the string pool
+        Array,  // length = element count
+        Object  // length = member count
+    };
+
+    // ------------------------------------------------------------
+    // Compiled Config Blob
+    // ------------------------------------------------------------
+    // A JSON config flattened into a file that is mapped read-only and
+    // used in place, without parsing:
+    //
+    //   Header   magic "AURUMCFG", version, entry count, source hash/size,
+    //            string pool and document locations
+    //   Entries  one 32-byte record per node, sorted by key hash
+    //   Pool     string values and dotted key paths, then the minified
+    //            source document
+    //
+    // Keys are ConfigKey hashes, so dotted paths, JSON pointers and
+    // pre-built handles all look up with one binary search; the stored
+    // path is compared on a hash match, so a missing key never returns
+    // another key's value. The embedded document is only parsed if someone
+    // asks for the full json tree. Little-endian, native layout.
+    class ConfigBlob
+    {
+    public:
+        static constexpr std::uint32_t kVersion = 3;
+
+        struct Header
+        {
+            char magic[8];
+            std::uint32_t version;
+            std::uint32_t entryCount;
+            std::uint64_t sourceHash;
+            std::uint64_t sourceSize;
+            std::uint64_t poolOffset;
+            std::uint64_t poolSize;
+            std::uint64_t documentOffset; // Relative to the pool
+            std::uint64_t documentSize;
+        };
+
+        struct Entry
+        {
+            std::uint64_t keyHash;
+            ConfigValueType type;
+            std::uint32_t length;
+            std::uint64_t value; // Bool / int64 / double bits / pool offset
+            std::uint32_t keyOffset; // Dotted path in the pool
+            std::uint32_t keyLength;
+        };
+
+        static_assert(sizeof(Header) == 64 && sizeof(Entry) == 32, "ConfigBlob layout changed; bump kVersion");
+
+        // Hash stored in the header to detect a stale blob
+        static std::uint64_t HashContent(std::string_view bytes)
+        {
+            return ConfigPath::HashAppend(ConfigPath::kHashSeed, bytes);
+        }
+
+        // Flattens data and writes it to path (via a temp file + rename).
+        // Keys that only share a hash are both kept. A path spelled twice
+        // ({"a.b": 1, "a": {"b": 2}}) keeps the value a json tree lookup
+        // would find, nested before flat, and logs the duplicate.
+        static bool Compile(const json& data, std::uint64_t sourceHash, std::uint64_t sourceSize,
+                            const std::string& path);
+
+        // Maps and validates a blob; false if missing, corrupt or from another version
+        bool Open(const std::string& path);
+        void Close();
+
+        bool IsOpen() const { return header_ != nullptr; }
+        bool Matches(std::uint64_t sourceHash, std::uint64_t sourceSize) const
+        {
+            return header_ && header_->sourceHash == sourceHash && header_->sourceSize == sourceSize;
+        }
+
+        // -----------------------------
+        // Lookup
+        // -----------------------------
+        // dottedPath must hash to keyHash (ConfigPath::HashDotted)
+        const Entry* Find(std::uint64_t keyHash, std::string_view dottedPath) const;
+        const Entry* Find(std::string_view path) const;
+        const Entry* Find(const ConfigKey& key) const;
+
+        std::size_t GetEntryCount() const { return count_; }
+        std::uint64_t GetSourceHash() const { return header_ ? header_->sourceHash : 0; }
+
+        static bool AsBool(const Entry& entry) { return entry.value != 0; }
+        static std::int64_t AsInt(const Entry& entry) { return static_cast<std::int64_t>(entry.value); }
+        static double AsDouble(const Entry& entry);
+        std::string_view AsString(const Entry& entry) const
+        {
+            return std::string_view(pool_ + entry.value, entry.length);
+        }
+        std::string_view GetKey(const Entry& entry) const
+        {
+            return std::string_view(pool_ + entry.keyOffset, entry.keyLength);
+        }
+
+        // Minified source document, for building the full json tree on demand
+        std::string_view GetDocument() const
+        {
+            return std::string_view(pool_ + header_->documentOffset, static_cast<std::size_t>(header_->documentSize));
+        }
+
+    private:
+        MappedFile file_;
+        const Header* header_ = nullptr;
+        const Entry* entries_ = nullptr;
+        const char* pool_ = nullptr;
+        std::size_t count_ = 0;
+    };
+}
@@ -0,0 +1,233 @@
+#pragma once
+#include <charconv>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <thirdparty/nlohmann/json.hpp>
+
+namespace Aurum
+{
+    using json = nlohmann::json;
+
+    // ------------------------------------------------------------
+    // Config Path Helpers
+    // ------------------------------------------------------------
+    // Two spellings address the same node:
+    //   dotted        "render.target_fps", "layers.2.name"
+    //   JSON pointer  "/render/target_fps", "/layers/2/name" (RFC 6901)
+    // Numeric segments index arrays and are plain keys on objects.
+    namespace ConfigPath
+    {
+        inline constexpr std::size_t kNoIndex = std::numeric_limits<std::size_t>::max();
+
+        inline bool IsPointer(std::string_view path) { return !path.empty() && path.front() == '/'; }
+
+        inline std::size_t ParseIndex(std::string_view segment)
+        {
+            if (segment.empty() || (segment.size() > 1 && segment.front() == '0'))
+                return kNoIndex;
+
+            std::size_t value = 0;
+            const auto [end, ec] = std::from_chars(segment.data(), segment.data() + segment.size(), value);
+            return (ec == std::errc() && end == segment.data() + segment.size()) ? value : kNoIndex;
+        }
+
+        // FNV-1a, fed segment by segment with '.' between them, so both
+        // spellings of a path hash to the same value.
+        inline constexpr std::uint64_t kHashSeed = 14695981039346656037ull;
+
+        constexpr std::uint64_t HashAppend(std::uint64_t hash, std::string_view bytes)
+        {
+            for (char c : bytes)
+                hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+            return hash;
+        }
+
+        // A dotted path hashes as its own text, so this equals Hash(path)
+        // for dotted paths and can be evaluated at compile time.
+        constexpr std::uint64_t HashDotted(std::string_view path)
+        {
+            return HashAppend(kHashSeed, path);
+        }
+
+        // Calls fn(segment) for each segment until it returns false.
+        // Pointer segments containing ~0 / ~1 are unescaped into scratch;
+        // every other segment is a view into path.
+        template<typename Fn>
+        bool ForEachSegment(std::string_view path, std::string& scratch, Fn&& fn)
+        {
+            const bool pointer = IsPointer(path);
+            const char separator = pointer ? '/' : '.';
+            if (pointer)
+                path.remove_prefix(1);
+            else if (path.empty())
+                return true;
+
+            while (true)
+            {
+                const std::size_t end = path.find(separator);
+                std::string_view segment = path.substr(0, end);
+
+                if (pointer && segment.find('~') != std::string_view::npos)
+                {
+                    scratch.clear();
+                    for (std::size_t i = 0; i < segment.size(); ++i)
+                    {
+                        if (segment[i] == '~' && i + 1 < segment.size() && (segment[i + 1] == '0' || segment[i + 1] == '1'))
+                        {
+                            scratch += (segment[i + 1] == '0') ? '~' : '/';
+                            ++i;
+                        }
+                        else
+                        {
+                            scratch += segment[i];
+                        }
+                    }
+                    segment = scratch;
+                }
+
+                if (!fn(segment))
+                    return false;
+                if (end == std::string_view::npos)
+                    return true;
+                path.remove_prefix(end + 1);
+            }
+        }
+
+        // Hash of a path in either spelling; equals ConfigKey(path).Hash()
+        inline std::uint64_t Hash(std::string_view path)
+        {
+            std::uint64_t hash = kHashSeed;
+            bool first = true;
+            std::string scratch;
+            ForEachSegment(path, scratch, [&](std::string_view segment)
+            {
+                if (!first)
+                    hash = HashAppend(hash, ".");
+                first = false;
+                hash = HashAppend(hash, segment);
+                return true;
+            });
+            return hash;
+        }
+
+        // One step down the tree; nullptr if the child does not exist
+        inline const json* Step(const json* node, std::string_view name, std::size_t index)
+        {
+            if (node->is_object())
+            {
+                const auto it = node->find(name);
+                return it != node->end() ? &*it : nullptr;
+            }
+            if (node->is_array() && index < node->size())
+                return &(*node)[index];
+            return nullptr;
+        }
+
+        // Resolves a path without building a handle. Allocates only for
+        // pointer segments that need unescaping.
+        inline const json* Resolve(const json& root, std::string_view path)
+        {
+            const json* node = &root;
+            std::string scratch;
+            ForEachSegment(path, scratch, [&](std::string_view segment)
+            {
+                node = Step(node, segment, ParseIndex(segment));
+                return node != nullptr;
+            });
+            return node;
+        }
+    }
+
+    // ------------------------------------------------------------
+    // Config Key Handle
+    // ------------------------------------------------------------
+    // Parses and hashes a config path once. Resolving a handle walks the
+    // tree in O(depth) and never allocates, so systems can keep handles as
+    // statics or members and read config every frame:
+    //   static const ConfigKey kTargetFps("render.target_fps");
+    //   float fps = ConfigManager::Get().GetFloat(kTargetFps, 60.0f);
+    class ConfigKey
+    {
+    public:
+        ConfigKey() = default;
+
+        explicit ConfigKey(std::string_view path)
+            : path_(path)
+        {
+            std::string scratch;
+            hash_ = ConfigPath::kHashSeed;
+            ConfigPath::ForEachSegment(path_, scratch, [&](std::string_view segment)
+            {
+                if (!segments_.empty())
+                    hash_ = ConfigPath::HashAppend(hash_, ".");
+                hash_ = ConfigPath::HashAppend(hash_, segment);
+
+                segments_.push_back({ names_.size(), segment.size(), ConfigPath::ParseIndex(segment) });
+                names_.append(segment);
+                return true;
+            });
+        }
+
+        const std::string& Path() const { return path_; }
+        std::uint64_t Hash() const { return hash_; }
+        std::size_t Depth() const { return segments_.size(); }
+        bool IsPointer() const { return ConfigPath::IsPointer(path_); }
+
+        std::string_view Segment(std::size_t i) const
+        {
+            return std::string_view(names_).substr(segments_[i].offset, segments_[i].length);
+        }
+
+        const json* Resolve(const json& root) const
+        {
+            const json* node = &root;
+            for (std::size_t i = 0; i < segments_.size() && node; ++i)
+                node = ConfigPath::Step(node, Segment(i), segments_[i].index);
+            return node;
+        }
+
+        // Keys are equal when they address the same node, whichever spelling was used
+        bool operator==(const ConfigKey& other) const
+        {
+            return hash_ == other.hash_ && names_ == other.names_ && SameSplit(other);
+        }
+
+    private:
+        struct SegmentInfo
+        {
+            std::size_t offset;
+            std::size_t length;
+            std::size_t index; // Array index, or kNoIndex
+        };
+
+        bool SameSplit(const ConfigKey& other) const
+        {
+            if (segments_.size() != other.segments_.size())
+                return false;
+            for (std::size_t i = 0; i < segments_.size(); ++i)
+            {
+                if (segments_[i].length != other.segments_[i].length)
+                    return false;
+            }
+            return true;
+        }
+
+        std::string path_;                  // As written, for diagnostics
+        std::string names_;                 // Unescaped segments back to back
+        std::vector<SegmentInfo> segments_;
+        std::uint64_t hash_ = ConfigPath::kHashSeed;
+    };
+}
+
+template<>
+struct std::hash<Aurum::ConfigKey>
+{
+    std::size_t operator()(const Aurum::ConfigKey& key) const noexcept
+    {
+        return static_cast<std::size_t>(key.Hash());
+    }
+};
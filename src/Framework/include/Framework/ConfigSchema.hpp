@@ -0,0 +1,563 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <Framework/Config.hpp>
+
+namespace Aurum
+{
+    // ------------------------------------------------------------
+    // Config Report
+    // ------------------------------------------------------------
+    // Every problem found while binding a schema, so a bad config file is
+    // reported in one go instead of one warning per lookup.
+    struct ConfigIssue
+    {
+        std::string path;
+        std::string message;
+    };
+
+    class ConfigReport
+    {
+    public:
+        void Add(std::string_view path, std::string message)
+        {
+            issues_.push_back({ std::string(path), std::move(message) });
+        }
+
+        bool Ok() const { return issues_.empty(); }
+        const std::vector<ConfigIssue>& GetIssues() const { return issues_; }
+
+        std::string ToString() const
+        {
+            std::string text;
+            for (const auto& issue : issues_)
+                text += "  " + issue.path + ": " + issue.message + "\n";
+            return text;
+        }
+
+        // One warning line per issue, under a single heading
+        void Log(std::string_view what) const
+        {
+            if (issues_.empty())
+                return;
+
+            Logger::Get().Log(std::string(what) + ": " + std::to_string(issues_.size()) +
+                              " config issue(s), defaults kept", LogLevel::Warning);
+            for (const auto& issue : issues_)
+                Logger::Get().Log("  " + issue.path + ": " + issue.message, LogLevel::Warning);
+        }
+
+    private:
+        std::vector<ConfigIssue> issues_;
+    };
+
+    // ------------------------------------------------------------
+    // Config Value Reference
+    // ------------------------------------------------------------
+    // A scalar read from either a json node or a compiled blob entry, so
+    // both snapshot backends go through the same conversion code.
+    struct ConfigValueRef
+    {
+        ConfigValueType type = ConfigValueType::Null;
+        bool b = false;
+        std::int64_t i = 0;
+        double d = 0.0;
+        std::string_view s;
+
+        static ConfigValueRef From(const json& node)
+        {
+            ConfigValueRef ref;
+            switch (node.type())
+            {
+                case json::value_t::boolean:
+                    ref.type = ConfigValueType::Bool;
+                    ref.b = node.get<bool>();
+                    break;
+                case json::value_t::number_integer:
+                    ref.type = ConfigValueType::Int;
+                    ref.i = node.get<std::int64_t>();
+                    break;
+                case json::value_t::number_unsigned:
+                {
+                    const auto u = node.get<std::uint64_t>();
+                    if (u <= static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max()))
+                    {
+                        ref.type = ConfigValueType::Int;
+                        ref.i = static_cast<std::int64_t>(u);
+                    }
+                    else
+                    {
+                        ref.type = ConfigValueType::Double;
+                        ref.d = static_cast<double>(u);
+                    }
+                    break;
+                }
+                case json::value_t::number_float:
+                    ref.type = ConfigValueType::Double;
+                    ref.d = node.get<double>();
+                    break;
+                case json::value_t::string:
+                    ref.type = ConfigValueType::String;
+                    ref.s = node.get_ref<const std::string&>();
+                    break;
+                case json::value_t::array:
+                    ref.type = ConfigValueType::Array;
+                    break;
+                case json::value_t::object:
+                    ref.type = ConfigValueType::Object;
+                    break;
+                default:
+                    break;
+            }
+            return ref;
+        }
+
+        static ConfigValueRef From(const ConfigBlob& blob, const ConfigBlob::Entry& entry)
+        {
+            ConfigValueRef ref;
+            ref.type = entry.type;
+            switch (entry.type)
+            {
+                case ConfigValueType::Bool:   ref.b = ConfigBlob::AsBool(entry); break;
+                case ConfigValueType::Int:    ref.i = ConfigBlob::AsInt(entry); break;
+                case ConfigValueType::Double: ref.d = ConfigBlob::AsDouble(entry); break;
+                case ConfigValueType::String: ref.s = blob.AsString(entry); break;
+                default: break;
+            }
+            return ref;
+        }
+
+        const char* TypeName() const
+        {
+            switch (type)
+            {
+                case ConfigValueType::Null:   return "null";
+                case ConfigValueType::Bool:   return "bool";
+                case ConfigValueType::Int:    return "integer";
+                case ConfigValueType::Double: return "number";
+                case ConfigValueType::String: return "string";
+                case ConfigValueType::Array:  return "array";
+                case ConfigValueType::Object: return "object";
+            }
+            return "unknown";
+        }
+    };
+
+    // ------------------------------------------------------------
+    // Field Descriptors
+    // ------------------------------------------------------------
+    template<typename T>
+    struct IsConfigDuration : std::false_type {};
+
+    template<typename Rep, typename Period>
+    struct IsConfigDuration<std::chrono::duration<Rep, Period>> : std::true_type {};
+
+    // Strings are declared with string_view defaults so descriptors stay constexpr
+    template<typename T>
+    using ConfigDefault = std::conditional_t<std::is_same_v<T, std::string>, std::string_view, T>;
+
+    template<typename T>
+    inline constexpr bool kConfigRangeable = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+
+    template<typename Owner, typename T, typename Accessor>
+    struct ConfigFieldDesc
+    {
+        using Value = T;
+        using NameEntry = std::pair<std::string_view, ConfigDefault<T>>;
+
+        constexpr ConfigFieldDesc(std::string_view fieldPath, Accessor fieldAccessor, ConfigDefault<T> fieldDefault)
+            : path(fieldPath), hash(ConfigPath::HashDotted(fieldPath)),
+              accessor(fieldAccessor), defaultValue(fieldDefault) {}
+
+        // Inclusive bounds for numbers and durations
+        constexpr ConfigFieldDesc Range(ConfigDefault<T> lo, ConfigDefault<T> hi) const
+        {
+            static_assert(kConfigRangeable<T> || IsConfigDuration<T>::value, "Range() needs a numeric field");
+            ConfigFieldDesc copy = *this;
+            copy.minValue = lo;
+            copy.maxValue = hi;
+            copy.hasRange = true;
+            return copy;
+        }
+
+        // Missing key becomes an issue instead of silently using the default
+        constexpr ConfigFieldDesc Required() const
+        {
+            ConfigFieldDesc copy = *this;
+            copy.required = true;
+            return copy;
+        }
+
+        // String spellings for an enum field
+        template<std::size_t N>
+        constexpr ConfigFieldDesc Names(const NameEntry (&table)[N]) const
+        {
+            static_assert(std::is_enum_v<T>, "Names() needs an enum field");
+            ConfigFieldDesc copy = *this;
+            copy.names = table;
+            copy.nameCount = N;
+            return copy;
+        }
+
+        T& Access(Owner& owner) const { return std::invoke(accessor, owner); }
+
+        std::string_view path;     // Dotted path
+        std::uint64_t hash;        // ConfigKey hash of path
+        Accessor accessor;         // Member pointer or Owner& -> T& lambda
+        ConfigDefault<T> defaultValue;
+        ConfigDefault<T> minValue{};
+        ConfigDefault<T> maxValue{};
+        bool hasRange = false;
+        bool required = false;
+        const NameEntry* names = nullptr;
+        std::size_t nameCount = 0;
+    };
+
+    template<typename Owner, typename Accessor>
+    using ConfigFieldType = std::remove_cvref_t<std::invoke_result_t<const Accessor&, Owner&>>;
+
+    // Accessor is &Owner::member, or a lambda returning a reference for
+    // members of nested structs.
+    template<typename Owner, typename Accessor>
+    constexpr auto ConfigField(std::string_view path, Accessor accessor,
+                               ConfigDefault<ConfigFieldType<Owner, Accessor>> defaultValue)
+    {
+        return ConfigFieldDesc<Owner, ConfigFieldType<Owner, Accessor>, Accessor>(path, accessor, defaultValue);
+    }
+
+    namespace ConfigConvert
+    {
+        template<typename T>
+        std::string Describe(const T& value)
+        {
+            if constexpr (IsConfigDuration<T>::value)
+                return std::to_string(value.count());
+            else
+                return std::to_string(value);
+        }
+
+        // Converts ref into out; returns an error message on failure
+        template<typename Field>
+        std::string Read(const ConfigValueRef& ref, const Field& field, typename Field::Value& out)
+        {
+            using T = typename Field::Value;
+            const std::string got = std::string(", got ") + ref.TypeName();
+
+            if constexpr (std::is_same_v<T, bool>)
+            {
+                if (ref.type == ConfigValueType::Bool)  { out = ref.b; return {}; }
+                if (ref.type == ConfigValueType::Int)   { out = ref.i != 0; return {}; }
+                if (ref.type == ConfigValueType::String)
+                {
+                    if (ref.s == "1" || ref.s == "true" || ref.s == "True" || ref.s == "TRUE")  { out = true; return {}; }
+                    if (ref.s == "0" || ref.s == "false" || ref.s == "False" || ref.s == "FALSE") { out = false; return {}; }
+                    return "expected bool, got \"" + std::string(ref.s) + "\"";
+                }
+                return "expected bool" + got;
+            }
+            else if constexpr (std::is_same_v<T, std::string>)
+            {
+                if (ref.type != ConfigValueType::String)
+                    return "expected string" + got;
+                out.assign(ref.s);
+                return {};
+            }
+            else if constexpr (std::is_enum_v<T>)
+            {
+                std::string options;
+                for (std::size_t n = 0; n < field.nameCount; ++n)
+                {
+                    if (ref.type == ConfigValueType::String && ref.s == field.names[n].first)
+                    {
+                        out = field.names[n].second;
+                        return {};
+                    }
+                    options += (n ? ", " : "") + std::string(field.names[n].first);
+                }
+                if (ref.type != ConfigValueType::String)
+                    return "expected one of [" + options + "]" + got;
+                return "unknown value \"" + std::string(ref.s) + "\", expected one of [" + options + "]";
+            }
+            else if constexpr (std::is_floating_point_v<T>)
+            {
+                if (ref.type == ConfigValueType::Int)    { out = static_cast<T>(ref.i); return {}; }
+                if (ref.type == ConfigValueType::Double) { out = static_cast<T>(ref.d); return {}; }
+                return "expected number" + got;
+            }
+            else
+            {
+                // Integers and durations (integer count). 60.0 is accepted as 60.
+                using Count = std::conditional_t<IsConfigDuration<T>::value, std::int64_t, T>;
+                std::int64_t whole = 0;
+                if (ref.type == ConfigValueType::Int)
+                    whole = ref.i;
+                else if (ref.type == ConfigValueType::Double && std::trunc(ref.d) == ref.d &&
+                         std::abs(ref.d) < 9.0e18)
+                    whole = static_cast<std::int64_t>(ref.d);
+                else
+                    return "expected integer" + got;
+
+                if constexpr (!IsConfigDuration<T>::value)
+                {
+                    if (!std::in_range<Count>(whole))
+                        return "integer " + std::to_string(whole) + " does not fit the field";
+                    out = static_cast<T>(whole);
+                }
+                else
+                {
+                    out = T(static_cast<typename T::rep>(whole));
+                }
+                return {};
+            }
+        }
+    }
+
+    // ------------------------------------------------------------
+    // Config Schema
+    // ------------------------------------------------------------
+    // Binds a struct to config paths once:
+    //
+    //   static constexpr auto Schema()
+    //   {
+    //       using Self = WindowSettings;
+    //       return MakeConfigSchema<Self>(
+    //           ConfigField<Self>("window.width", &Self::width, 1280).Range(1, 16384),
+    //           ConfigField<Self>("window.title", &Self::title, "Aurum"));
+    //   }
+    //
+    //   ConfigReport report = Schema().Load(*ConfigManager::Get().Snapshot(), settings);
+    //
+    // Load() resets every field to its default, then fills the struct in
+    // one walk over the json tree (descending only into objects that lead
+    // to a declared path), or with one lookup per field on a blob-backed
+    // snapshot. Keys resolve as ConfigSnapshot::Find does: the nested
+    // spelling first, a flat top-level "a.b" name only when there is no
+    // nested one. Fields with bad values keep their default and are listed
+    // in the returned report.
+    template<typename Owner, typename... Fields>
+    class ConfigSchema
+    {
+    public:
+        constexpr explicit ConfigSchema(Fields... fields) : fields_(fields...) {}
+
+        static constexpr std::size_t Size() { return sizeof...(Fields); }
+
+        void ApplyDefaults(Owner& owner) const
+        {
+            std::apply([&](const auto&... field) { (AssignDefault(field, owner), ...); }, fields_);
+        }
+
+        ConfigReport Load(const ConfigSnapshot& snapshot, Owner& owner) const
+        {
+            if (const ConfigBlob* blob = snapshot.GetBlob())
+                return Load(*blob, owner);
+            return Load(snapshot.Data(), owner);
+        }
+
+        ConfigReport Load(const json& root, Owner& owner) const
+        {
+            ConfigReport report;
+            ApplyDefaults(owner);
+
+            const Index index = BuildIndex();
+            bool seen[Size() > 0 ? Size() : 1] = {};
+            Walk(root, ConfigPath::kHashSeed, true, index, owner, seen, report);
+            ApplyFlat(root, index, owner, seen, report);
+
+            CheckRequired(seen, report);
+            return report;
+        }
+
+        ConfigReport Load(const ConfigBlob& blob, Owner& owner) const
+        {
+            ConfigReport report;
+            ApplyDefaults(owner);
+
+            bool seen[Size() > 0 ? Size() : 1] = {};
+            ForEachField([&](std::size_t n, const auto& field)
+            {
+                if (const ConfigBlob::Entry* entry = blob.Find(field.hash, field.path))
+                {
+                    seen[n] = true;
+                    Apply(field, ConfigValueRef::From(blob, *entry), owner, report);
+                }
+            });
+
+            CheckRequired(seen, report);
+            return report;
+        }
+
+    private:
+        struct Index
+        {
+            std::vector<std::pair<std::uint64_t, std::size_t>> fields; // hash -> field, sorted
+            std::vector<std::uint64_t> prefixes;                       // Hashes of every parent path, sorted
+        };
+
+        template<typename Fn>
+        void ForEachField(Fn&& fn) const
+        {
+            [&]<std::size_t... I>(std::index_sequence<I...>)
+            {
+                (fn(I, std::get<I>(fields_)), ...);
+            }(std::index_sequence_for<Fields...>{});
+        }
+
+        template<typename Fn>
+        void WithField(std::size_t n, Fn&& fn) const
+        {
+            ForEachField([&](std::size_t i, const auto& field)
+            {
+                if (i == n)
+                    fn(field);
+            });
+        }
+
+        Index BuildIndex() const
+        {
+            Index index;
+            ForEachField([&](std::size_t n, const auto& field)
+            {
+                index.fields.emplace_back(field.hash, n);
+                for (std::size_t dot = field.path.find('.'); dot != std::string_view::npos;
+                     dot = field.path.find('.', dot + 1))
+                {
+                    index.prefixes.push_back(ConfigPath::HashDotted(field.path.substr(0, dot)));
+                }
+            });
+            std::sort(index.fields.begin(), index.fields.end());
+            std::sort(index.prefixes.begin(), index.prefixes.end());
+            return index;
+        }
+
+        // Nested keys only. Dotted names cannot be reached by the dotted
+        // lookup below the root, and at the root they are the flat fallback
+        // (ApplyFlat), the same precedence as ConfigSnapshot::Find.
+        void Walk(const json& node, std::uint64_t hash, bool isRoot, const Index& index,
+                  Owner& owner, bool* seen, ConfigReport& report) const
+        {
+            auto visit = [&](std::string_view segment, const json& child)
+            {
+                if (segment.find('.') != std::string_view::npos)
+                    return;
+
+                std::uint64_t childHash = isRoot ? ConfigPath::kHashSeed : ConfigPath::HashAppend(hash, ".");
+                childHash = ConfigPath::HashAppend(childHash, segment);
+
+                const auto field = std::lower_bound(index.fields.begin(), index.fields.end(),
+                                                    std::make_pair(childHash, std::size_t(0)));
+                if (field != index.fields.end() && field->first == childHash)
+                {
+                    seen[field->second] = true;
+                    WithField(field->second, [&](const auto& desc)
+                    {
+                        Apply(desc, ConfigValueRef::From(child), owner, report);
+                    });
+                }
+
+                if (child.is_structured() && std::binary_search(index.prefixes.begin(), index.prefixes.end(), childHash))
+                    Walk(child, childHash, false, index, owner, seen, report);
+            };
+
+            if (node.is_object())
+            {
+                for (auto it = node.begin(); it != node.end(); ++it)
+                    visit(it.key(), it.value());
+            }
+            else if (node.is_array())
+            {
+                for (std::size_t n = 0; n < node.size(); ++n)
+                    visit(std::to_string(n), node[n]);
+            }
+        }
+
+        // Older configs spelled nested keys as literal top-level names;
+        // those bind only fields the nested walk did not find
+        void ApplyFlat(const json& root, const Index& index, Owner& owner, bool* seen, ConfigReport& report) const
+        {
+            if (!root.is_object())
+                return;
+
+            for (auto it = root.begin(); it != root.end(); ++it)
+            {
+                const std::string& key = it.key();
+                if (key.find('.') == std::string::npos)
+                    continue;
+
+                const std::uint64_t hash = ConfigPath::HashAppend(ConfigPath::kHashSeed, key);
+                const auto field = std::lower_bound(index.fields.begin(), index.fields.end(),
+                                                    std::make_pair(hash, std::size_t(0)));
+                if (field == index.fields.end() || field->first != hash || seen[field->second])
+                    continue;
+
+                WithField(field->second, [&](const auto& desc)
+                {
+                    if (desc.path != key)
+                        return;
+                    seen[field->second] = true;
+                    Apply(desc, ConfigValueRef::From(it.value()), owner, report);
+                });
+            }
+        }
+
+        template<typename Field>
+        static void AssignDefault(const Field& field, Owner& owner)
+        {
+            if constexpr (std::is_same_v<typename Field::Value, std::string>)
+                field.Access(owner).assign(field.defaultValue);
+            else
+                field.Access(owner) = field.defaultValue;
+        }
+
+        template<typename Field>
+        static void Apply(const Field& field, const ConfigValueRef& ref, Owner& owner, ConfigReport& report)
+        {
+            using T = typename Field::Value;
+            T value{};
+            std::string error = ConfigConvert::Read(ref, field, value);
+
+            if constexpr (kConfigRangeable<T> || IsConfigDuration<T>::value)
+            {
+                if (error.empty() && field.hasRange && (value < field.minValue || value > field.maxValue))
+                {
+                    error = ConfigConvert::Describe(value) + " is outside [" + ConfigConvert::Describe(field.minValue) +
+                            ", " + ConfigConvert::Describe(field.maxValue) + "]";
+                }
+            }
+
+            if (!error.empty())
+            {
+                report.Add(field.path, std::move(error));
+                return;
+            }
+            field.Access(owner) = std::move(value);
+        }
+
+        void CheckRequired(const bool* seen, ConfigReport& report) const
+        {
+            ForEachField([&](std::size_t n, const auto& field)
+            {
+                if (field.required && !seen[n])
+                    report.Add(field.path, "required key is missing");
+            });
+        }
+
+        std::tuple<Fields...> fields_;
+    };
+
+    template<typename Owner, typename... Fields>
+    constexpr auto MakeConfigSchema(Fields... fields)
+    {
+        return ConfigSchema<Owner, Fields...>(fields...);
+    }
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <Framework/ConfigSchema.hpp>
+
+namespace Aurum
+{
+    enum class ConfigStreamMode
+    {
+        Sequential, // Handler runs on the loading thread, in document order
+        Parallel    // "<top-level key>.*" only: elements are parsed and handled on worker threads
+    };
+
+    // ------------------------------------------------------------
+    // Streaming Config Loader
+    // ------------------------------------------------------------
+    // Reads large data files (entity tables, prefabs, ...) through the
+    // nlohmann SAX interface straight from a memory-mapped file. Only the
+    // sub-trees that match a registered path are built as json values; each
+    // one is handed to its handler and freed, so peak memory follows the
+    // largest matched sub-tree rather than the whole document.
+    //
+    // Paths are dotted. "physics" delivers that whole sub-tree once;
+    // "entities.*" delivers every element of "entities" separately.
+    //
+    //   ConfigStreamLoader loader;
+    //   loader.On("entities.*", [&](std::string_view path, json& entity) { ... },
+    //             ConfigStreamMode::Parallel);
+    //   ConfigReport report = loader.Load("data/world.json");
+    //
+    // In Parallel mode a quick structural scan finds the element boundaries
+    // of the top-level array; chunks of elements are then parsed on worker
+    // threads while the rest of the document is streamed on the caller's
+    // thread. Parallel handlers are called concurrently and in no
+    // particular order. Arrays smaller than the parallel threshold, and
+    // anything the scan cannot split, fall back to Sequential.
+    class ConfigStreamLoader
+    {
+    public:
+        using Handler = std::function<void(std::string_view path, json& value)>;
+
+        void On(std::string_view path, Handler handler, ConfigStreamMode mode = ConfigStreamMode::Sequential);
+
+        // 0 = one worker per hardware thread
+        void SetWorkerCount(std::size_t workers) { workerCount_ = workers; }
+        void SetParallelThreshold(std::size_t bytes) { parallelThreshold_ = bytes; }
+
+        ConfigReport Load(const std::string& path) const;
+        ConfigReport LoadFromMemory(std::string_view text) const;
+
+    private:
+        struct Route
+        {
+            std::string path;          // Without the trailing ".*"
+            std::uint64_t hash;        // Hash of path
+            bool eachChild;            // Pattern ended in ".*"
+            ConfigStreamMode mode;
+            Handler handler;
+        };
+
+        std::vector<Route> routes_;
+        std::size_t workerCount_ = 0;
+        std::size_t parallelThreshold_ = 1024 * 1024;
+    };
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <thread>
+
+namespace Aurum
+{
+    // ------------------------------------------------------------
+    // Config File Watcher
+    // ------------------------------------------------------------
+    // Runs a background thread that calls onChange after the watched file
+    // has been rewritten. Linux uses inotify on the parent directory, so
+    // editors that save through a temp file + rename are caught as well;
+    // other platforms poll the modification time. Bursts of events from a
+    // single save are coalesced into one callback.
+    class ConfigWatcher
+    {
+    public:
+        using Callback = std::function<void()>;
+
+        ConfigWatcher() = default;
+        ~ConfigWatcher() { Stop(); }
+
+        ConfigWatcher(const ConfigWatcher&) = delete;
+        ConfigWatcher& operator=(const ConfigWatcher&) = delete;
+
+        bool Start(const std::string& path, Callback onChange,
+                   std::chrono::milliseconds pollInterval = std::chrono::milliseconds(500));
+        void Stop();
+
+        bool IsRunning() const { return thread_.joinable(); }
+        const std::string& GetPath() const { return path_; }
+
+    private:
+        void WatchLoop();
+
+        std::string path_;
+        Callback onChange_;
+        std::chrono::milliseconds pollInterval_{ 500 };
+
+        std::thread thread_;
+        std::atomic<bool> stop_{false};
+        int inotifyFd_ = -1;
+    };
+}
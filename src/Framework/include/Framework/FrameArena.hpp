@@ -0,0 +1,117 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Aurum
+{
+    // ---------------------------------------
+    // Frame Arena: bump allocation for per-frame data
+    // ---------------------------------------
+    // Reserves one large virtual range split into framesInFlight buffers and
+    // commits pages on demand. BeginFrame() rotates to the next buffer and
+    // resets it wholesale, so data allocated in frame N stays valid until
+    // frame N + framesInFlight starts (long enough for GPU uploads in flight).
+    // Nothing is freed individually and no destructors run.
+    //
+    // Owned by one thread (the main loop for FrameArena::Get()); workers
+    // should use their own arenas. Also a std::pmr::memory_resource:
+    //   std::pmr::vector<DrawItem> items(&FrameArena::Get());
+    //   std::pmr::string label("Frame ", &FrameArena::Get());
+    class FrameArena : public std::pmr::memory_resource
+    {
+    public:
+        static constexpr std::size_t kDefaultReserveBytes = std::size_t(256) << 20; // Per buffer
+        static constexpr std::uint32_t kDefaultFramesInFlight = 2;
+
+        // Engine-wide arena, reset by Application at the start of each frame
+        static FrameArena& Get()
+        {
+            static FrameArena instance("Frame Arena");
+            return instance;
+        }
+
+        explicit FrameArena(const char* name, std::size_t reserveBytes = kDefaultReserveBytes,
+                            std::uint32_t framesInFlight = kDefaultFramesInFlight);
+        ~FrameArena() override;
+
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+
+        // Moves to the next buffer, releases what that buffer held and
+        // reports the finished frame's usage to MemoryTracker
+        void BeginFrame();
+
+        void* Allocate(std::size_t size, std::size_t align = alignof(std::max_align_t))
+        {
+            Buffer& buffer = buffers_[current_];
+            const std::size_t offset = (buffer.used + align - 1) & ~(align - 1);
+            if (offset + size <= buffer.committed)
+            {
+                buffer.used = offset + size;
+                return buffer.base + offset;
+            }
+            return AllocateSlow(size, align);
+        }
+
+        // Only for types that need no destructor: the arena never runs one
+        template <typename T, typename... Args>
+        T* New(Args&&... args)
+        {
+            static_assert(std::is_trivially_destructible_v<T>, "FrameArena never runs destructors");
+            return ::new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        }
+
+        template <typename T>
+        T* NewArray(std::size_t count)
+        {
+            static_assert(std::is_trivially_destructible_v<T>, "FrameArena never runs destructors");
+            T* items = static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+            for (std::size_t i = 0; i < count; ++i)
+                ::new (items + i) T();
+            return items;
+        }
+
+        const char* GetName() const { return name_; }
+        std::uint32_t GetFramesInFlight() const { return static_cast<std::uint32_t>(buffers_.size()); }
+        std::size_t GetUsedBytes() const { return buffers_[current_].used + buffers_[current_].overflowBytes; }
+        std::size_t GetPeakBytes() const { return peakFrameBytes_; }
+        std::size_t GetCommittedBytes() const;
+        std::size_t GetReservedBytes() const { return reserveBytes_ * buffers_.size(); }
+
+    private:
+        struct OverflowBlock
+        {
+            void* memory;
+            std::size_t align;
+        };
+
+        struct Buffer
+        {
+            std::uint8_t* base = nullptr;
+            std::size_t used = 0;
+            std::size_t committed = 0;
+            std::size_t overflowBytes = 0;
+            std::vector<OverflowBlock> overflow; // Heap blocks once the reserve runs out
+        };
+
+        void* AllocateSlow(std::size_t size, std::size_t align);
+        void ReleaseOverflow(Buffer& buffer);
+
+        void* do_allocate(std::size_t bytes, std::size_t align) override { return Allocate(bytes, align); }
+        void do_deallocate(void*, std::size_t, std::size_t) override {}
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+        const char* name_;
+        std::uint8_t* reservation_ = nullptr;
+        std::size_t reserveBytes_ = 0;
+        std::vector<Buffer> buffers_;
+        std::size_t current_ = 0;
+        std::size_t peakFrameBytes_ = 0;
+        bool warnedOverflow_ = false;
+    };
+}
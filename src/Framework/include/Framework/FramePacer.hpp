@@ -0,0 +1,81 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+
+namespace Aurum
+{
+    enum class FramePacingMode
+    {
+        Spin,    // 1 ms sleep_for steps, then busy-wait the last 2 ms
+        Precise  // Absolute-deadline sleep to a calibrated margin, then spin the residual
+    };
+
+    // Precise needs a high-resolution sleep: clock_nanosleep on Linux, a
+    // high-resolution waitable timer on Windows 10 1803+. Without one it
+    // falls back to Spin, which is also the default on other platforms.
+#if defined(__linux__) || defined(_WIN32)
+    inline constexpr FramePacingMode kDefaultFramePacingMode = FramePacingMode::Precise;
+#else
+    inline constexpr FramePacingMode kDefaultFramePacingMode = FramePacingMode::Spin;
+#endif
+
+    struct FramePacerStats
+    {
+        std::uint64_t frames = 0;
+        std::uint64_t missed = 0;     // Frames that reached Wait() after their deadline
+        double spinSeconds = 0.0;     // Time spent busy-waiting
+        double maxLateness = 0.0;     // Worst observed wake-up lateness (Precise)
+    };
+
+    // ---------------------------------------
+    // Frame Pacer: waits for the next frame deadline
+    // ---------------------------------------
+    // Deadlines are absolute (previous deadline + period), so frame work does
+    // not add to the frame time. A frame that runs past its deadline restarts
+    // the schedule from now instead of bursting to catch up.
+    //
+    // Precise mode sleeps until shortly before the deadline with
+    // clock_nanosleep(TIMER_ABSTIME) on Linux or a high-resolution waitable
+    // timer on Windows. The margin follows the measured wake-up lateness
+    // (mean + 4 deviations), so only that residual is spent spinning.
+    class FramePacer
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        void SetMode(FramePacingMode mode) { mode_ = mode; }
+        FramePacingMode GetMode() const { return mode_; }
+
+        // Whether Precise can sleep precisely on this thread; if not, a
+        // Precise pacer waits as Spin does
+        static bool IsPreciseSupported();
+
+        // 0 disables pacing. Restarts the deadline schedule.
+        void SetTargetFrameTime(double seconds);
+        double GetTargetFrameTime() const { return std::chrono::duration<double>(period_).count(); }
+
+        // Blocks until the current frame's deadline
+        void Wait();
+
+        // Time left for spinning after a Precise sleep
+        double GetWakeMargin() const;
+        const FramePacerStats& GetStats() const { return stats_; }
+        void ResetStats() { stats_ = {}; }
+
+    private:
+        void WaitSpin();
+        void WaitPrecise();
+        void RecordLateness(double seconds);
+
+        FramePacingMode mode_ = kDefaultFramePacingMode;
+        Clock::duration period_{0};
+        Clock::time_point deadline_{};
+
+        // --- Wake-up lateness estimate (exponential moving averages) ---
+        double latenessMean_ = 100e-6;
+        double latenessDev_ = 50e-6;
+        bool threadPrepared_ = false;
+
+        FramePacerStats stats_;
+    };
+}
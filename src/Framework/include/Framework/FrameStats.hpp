@@ -0,0 +1,107 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Aurum
+{
+    struct FrameStatsSummary
+    {
+        std::size_t frames = 0;
+        double min = 0.0;   // All times in seconds
+        double mean = 0.0;
+        double p50 = 0.0;
+        double p95 = 0.0;
+        double p99 = 0.0;
+        double max = 0.0;
+        std::size_t hitches = 0;
+    };
+
+    // ---------------------------------------
+    // Frame Time Histogram (HDR-style)
+    // ---------------------------------------
+    // Log-linear buckets over microseconds: exact below 64 us, then 32
+    // sub-buckets per power of two (about 3% relative error) up to ~67 s.
+    // Fixed size, so recording never allocates.
+    class FrameTimeHistogram
+    {
+    public:
+        static constexpr int kSubBucketBits = 5;
+        static constexpr std::uint64_t kSubBuckets = 1ull << kSubBucketBits;
+        static constexpr std::uint64_t kMaxMicroseconds = (1ull << 26) - 1;
+        static constexpr std::size_t kBucketCount = 2 * kSubBuckets + 20 * kSubBuckets;
+
+        void Record(double seconds);
+        void Clear();
+
+        std::uint64_t GetCount() const { return count_; }
+        double GetMin() const;
+        double GetMax() const;
+        double GetMean() const;
+        double Percentile(double percent) const;     // 0..100
+
+        // Bucket range in microseconds, for export
+        static std::size_t BucketIndex(std::uint64_t microseconds);
+        static std::uint64_t BucketLow(std::size_t index);
+        static std::uint64_t BucketHigh(std::size_t index);
+        std::uint64_t GetBucket(std::size_t index) const { return buckets_[index]; }
+
+    private:
+        std::array<std::uint64_t, kBucketCount> buckets_{};
+        std::uint64_t count_ = 0;
+        std::uint64_t sum_ = 0;
+        std::uint64_t min_ = UINT64_MAX;
+        std::uint64_t max_ = 0;
+    };
+
+    // ---------------------------------------
+    // Frame Stats: rolling frame-time statistics
+    // ---------------------------------------
+    // Keeps the last N frame durations in a ring (for exact percentiles over
+    // any window up to N frames) and a lifetime histogram. All storage is
+    // allocated up front; Record() and Summarize() do not allocate.
+    class FrameStats
+    {
+    public:
+        explicit FrameStats(std::size_t capacity = 1024);
+
+        void Record(double seconds);
+        void Reset();
+
+        // Frames longer than this count as hitches
+        void SetHitchThreshold(double seconds) { hitchThreshold_ = seconds; }
+        double GetHitchThreshold() const { return hitchThreshold_; }
+
+        // Last `frames` frames (0 or more than recorded = the whole ring)
+        FrameStatsSummary Summarize(std::size_t frames = 0) const;
+
+        // Every frame since Reset(), from the histogram
+        FrameStatsSummary SummarizeLifetime() const;
+
+        const FrameTimeHistogram& GetHistogram() const { return histogram_; }
+        std::size_t GetCapacity() const { return ring_.size(); }
+        std::size_t GetCount() const { return count_; }
+
+        // --- CSV export ---
+        // One row per window plus a "lifetime" row, stamped with wall-clock
+        // milliseconds. Appends to an existing file; writes the header for a
+        // new one.
+        bool ExportCsv(const std::string& path, std::span<const std::size_t> windows) const;
+
+        // Lifetime histogram as bucket_low_us,bucket_high_us,count (non-empty buckets)
+        bool ExportHistogramCsv(const std::string& path) const;
+
+    private:
+        std::vector<double> ring_;
+        mutable std::vector<double> scratch_;
+        std::size_t head_ = 0;   // Next slot to write
+        std::size_t count_ = 0;  // Valid entries in ring_
+
+        FrameTimeHistogram histogram_;
+        std::uint64_t lifetimeHitches_ = 0;
+        double hitchThreshold_ = 1.0 / 30.0;
+    };
+}
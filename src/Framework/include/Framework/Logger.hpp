@@ -4,18 +4,41 @@
 #include <iostream>
 #include <mutex>
 #include <chrono>
-#include <iomanip>
-#include <sstream>
-#include <ctime>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <Framework/Logging/BoundedMpmcQueue.hpp>
+#include <Framework/Logging/LogFormat.hpp>
+#include <Framework/Logging/LogRecord.hpp>
+#include <Framework/Logging/LogRateLimiter.hpp>
+#include <Framework/Logging/LogSink.hpp>
+#include <Framework/Logging/LogSinks.hpp>
+#include <Framework/Logging/LogStaging.hpp>
 
 namespace Aurum
 {
-    enum class LogLevel
+    // What a producer does when the async queue is full
+    enum class LogOverflowPolicy
     {
-        Info,
-        Warning,
-        Error,
-        Debug
+        Block,      // Wait for the writer thread to free a slot
+        DropOldest, // Discard the oldest queued record to make room
+        DropNewest  // Discard the incoming record
+    };
+
+    struct AsyncLogConfig
+    {
+        std::size_t queueCapacity = 8192; // Rounded up to a power of two
+        std::size_t maxBatchSize  = 1024; // Records formatted per write
+        LogOverflowPolicy overflowPolicy = LogOverflowPolicy::Block;
+    };
+
+    struct ThreadStagingConfig
+    {
+        std::size_t flushThresholdBytes = 64 * 1024;  // Staged text per thread before a merge
+        std::size_t flushThresholdRecords = 4096;     // Staged records per thread before a merge
+        std::chrono::milliseconds maxLatency{ 100 };  // Age after which a record or PollStaging() triggers a merge
     };
 
     class Logger
@@ -27,55 +50,207 @@ namespace Aurum
             return instance;
         }
 
+        // Shorthand for the "file" sink
         void SetLogFile(const std::string& filename)
         {
-            std::lock_guard<std::mutex> lock(mutex_);
-            file_.open(filename, std::ios::out | std::ios::app);
+            AddSink("file", std::make_shared<FileLogSink>(filename));
+        }
+
+        // Shorthand for the "console" sink, which is registered by default
+        void SetConsoleEnabled(bool enabled)
+        {
+            if (enabled)
+            {
+                if (!GetSink("console"))
+                    AddSink("console", std::make_shared<ConsoleLogSink>());
+            }
+            else
+            {
+                RemoveSink("console");
+            }
         }
 
-        void Log(const std::string& message, LogLevel level = LogLevel::Info)
+        // -----------------------------
+        // Sink Registry
+        // -----------------------------
+        // Sinks are registered by name; adding a sink under an existing
+        // name replaces (and flushes) the previous one.
+        void AddSink(const std::string& name, std::shared_ptr<LogSink> sink);
+        bool RemoveSink(const std::string& name);
+        std::shared_ptr<LogSink> GetSink(const std::string& name) const;
+
+        // Repeated messages beyond the burst are collapsed into a summary
+        void SetRateLimit(const LogRateLimitConfig& config);
+
+        void Log(const std::string& message, LogLevel level = LogLevel::Info);
+
+        // Captures the arguments of an AURUM_LOG_* call; formatting is done
+        // only when the record is written (on the writer thread in async mode).
+        template<typename... Args>
+        void LogDeferred(const LogSite& site, const Args&... args)
         {
-            std::lock_guard<std::mutex> lock(mutex_);
-            const std::string prefix = "[" + Timestamp() + "] " + LevelToString(level) + ": ";
+            LogRecord record;
+            record.level = site.level;
+            record.timestamp = LogClock::Now();
+            record.threadId = CurrentLogThreadId();
+            record.site = &site;
+            (EncodeLogArg(record.payload, args), ...);
+            Submit(std::move(record));
+        }
 
-            // Console output
-            std::cout << prefix << message << std::endl;
+        // -----------------------------
+        // Runtime Level Filter
+        // -----------------------------
+        void SetLevel(LogLevel level) { level_.store(level, std::memory_order_relaxed); }
+        LogLevel GetLevel() const { return level_.load(std::memory_order_relaxed); }
 
-            // File output
-            if (file_.is_open())
-                file_ << prefix << message << std::endl;
+        bool ShouldLog(LogLevel level) const
+        {
+            return IsLogLevelCompiled(level) &&
+                   static_cast<int>(level) >= static_cast<int>(level_.load(std::memory_order_relaxed));
         }
 
+        // -----------------------------
+        // Async Mode
+        // -----------------------------
+        // Records are pushed into a bounded lock-free queue and written
+        // in batches by a dedicated writer thread.
+        void StartAsync(const AsyncLogConfig& config = {});
+
+        // Drains every queued record, then joins the writer thread.
+        void StopAsync();
+
+        // Blocks until every record logged before this call has been written.
+        void Flush();
+
+        bool IsAsync() const { return async_.load(std::memory_order_acquire); }
+
+        // -----------------------------
+        // Per-Thread Staging
+        // -----------------------------
+        // Synchronous records are formatted into a buffer owned by the
+        // calling thread instead of being written under the shared lock.
+        // Buffers are merged when one fills up, when maxLatency has passed,
+        // or on Flush(). A merge writes only records stamped before it
+        // started and holds newer ones for the next, so output is in
+        // timestamp order across merges, not just within one. Async mode
+        // takes precedence.
+        void EnableThreadStaging(const ThreadStagingConfig& config = {});
+        void DisableThreadStaging();
+        bool IsThreadStaging() const { return staging_.load(std::memory_order_acquire); }
+
+        // Merges staged records once maxLatency has passed since the last
+        // merge. A full buffer or a later record triggers merges on its own;
+        // call this once per frame so a thread that stops logging is still
+        // written within maxLatency.
+        void PollStaging();
+        std::uint64_t GetDroppedCount() const { return droppedTotal_.load(std::memory_order_relaxed); }
+
     private:
-        Logger() = default;
-        ~Logger() = default;
+        Logger();
+        ~Logger()
+        {
+            StopAsync();
+            FlushStaging(true);
+        }
 
         Logger(const Logger&) = delete;
         Logger& operator=(const Logger&) = delete;
 
-        std::string Timestamp()
+        void Submit(LogRecord&& record);
+        void Enqueue(LogRecord&& record);
+        void WakeWriter();
+        void WriterLoop();
+        void WriteRecords(const LogRecord* records, std::size_t count,
+                          const std::string* text = nullptr, const std::size_t* lineOffsets = nullptr);
+        void AppendRecord(std::string& out, const LogRecord& record, TimestampCache& timestamps);
+        void UpdateTextNeeded();
+
+        LogStagingBuffer& GetStagingBuffer();
+        void StageRecord(LogRecord&& record);
+        bool IsStagingDue(std::uint64_t now) const;
+        void FlushStaging(bool drainAll = false);
+
+        struct NamedSink
         {
-            using namespace std::chrono;
-            auto now = system_clock::now();
-            auto time = system_clock::to_time_t(now);
-            std::stringstream ss;
-            ss << std::put_time(std::localtime(&time), "%H:%M:%S");
-            return ss.str();
-        }
+            std::string name;
+            std::shared_ptr<LogSink> sink;
+        };
 
-        std::string LevelToString(LogLevel level)
+        // Where the text of a written record lives: the caller's pre-formatted
+        // text, or textBuffer_ when `local` is set.
+        struct LineRef
         {
-            switch (level)
-            {
-                case LogLevel::Info: return "[INFO]";
-                case LogLevel::Warning: return "[WARN]";
-                case LogLevel::Error: return "[ERROR]";
-                case LogLevel::Debug: return "[DEBUG]";
-                default: return "[UNKNOWN]";
-            }
-        }
+            bool local;
+            std::size_t begin;
+            std::size_t end;
+        };
+
+        mutable std::mutex mutex_;
+        const LogClock::Anchor anchor_ = LogClock::Anchor::Capture();
+        std::atomic<bool> textNeeded_{true};
+
+        // Guarded by mutex_
+        std::vector<NamedSink> sinks_;
+        std::string textBuffer_;
+        TimestampCache timestamps_;
+        LogRateLimiter rateLimiter_;
+        std::vector<std::size_t> admitted_;
+        std::vector<LogRecord> summaries_;
+        std::vector<LineRef> lines_;
+
+        // --- Staging state ---
+        std::atomic<bool> staging_{false};
+        ThreadStagingConfig stagingConfig_;
+        std::mutex stagingRegistryMutex_;
+        std::vector<std::shared_ptr<LogStagingBuffer>> stagingBuffers_;
+        std::mutex stagingFlushMutex_;
+        std::vector<LogStagedBatch> stagingHeld_;  // Guarded by stagingFlushMutex_
+        std::atomic<std::uint64_t> lastStagingFlush_{0};
 
-        std::ofstream file_;
-        std::mutex mutex_;
+        std::atomic<LogLevel> level_{ static_cast<LogLevel>(AURUM_LOG_MIN_LEVEL > 3 ? 3 : AURUM_LOG_MIN_LEVEL) };
+
+        // --- Async state ---
+        AsyncLogConfig asyncConfig_;
+        std::unique_ptr<BoundedMpmcQueue<LogRecord>> queue_;
+        std::thread writer_;
+        std::mutex asyncControlMutex_;
+
+        std::atomic<bool> async_{false};
+        std::atomic<bool> stopRequested_{false};
+        std::atomic<bool> writerSleeping_{false};
+        std::atomic<std::uint32_t> wakeSignal_{0};
+        std::atomic<std::uint32_t> activeProducers_{0};
+
+        std::atomic<std::uint64_t> enqueued_{0};  // Records handed to Enqueue
+        std::atomic<std::uint64_t> consumed_{0};  // Records written or discarded
+        std::atomic<std::uint64_t> droppedPending_{0};
+        std::atomic<std::uint64_t> droppedTotal_{0};
     };
 }
+
+// ------------------------------------------------------------
+// Logging Macros
+// ------------------------------------------------------------
+// Levels below AURUM_LOG_MIN_LEVEL compile to nothing, and arguments are
+// only evaluated when the runtime threshold lets the record through.
+// The format string is checked against LogFormatSpec at compile time.
+//   AURUM_LOG_DEBUG("dt: {:.4f}s | FPS: {:.1f}", dt, fps);
+#define AURUM_LOG(level, fmt, ...)                                                                \
+    do                                                                                            \
+    {                                                                                             \
+        static_assert(::Aurum::IsValidLogFormat(fmt), "Unsupported AURUM_LOG format spec");   \
+        if constexpr (::Aurum::IsLogLevelCompiled(level))                                         \
+        {                                                                                         \
+            if (::Aurum::Logger::Get().ShouldLog(level))                                          \
+            {                                                                                     \
+                static constinit ::Aurum::LogSite aurumLogSite{ level, fmt, __FILE__, __LINE__ }; \
+                ::Aurum::Logger::Get().LogDeferred(aurumLogSite __VA_OPT__(,) __VA_ARGS__);       \
+            }                                                                                     \
+        }                                                                                         \
+    } while (0)
+
+#define AURUM_LOG_DEBUG(fmt, ...) AURUM_LOG(::Aurum::LogLevel::Debug, fmt __VA_OPT__(,) __VA_ARGS__)
+#define AURUM_LOG_INFO(fmt, ...)  AURUM_LOG(::Aurum::LogLevel::Info, fmt __VA_OPT__(,) __VA_ARGS__)
+#define AURUM_LOG_WARN(fmt, ...)  AURUM_LOG(::Aurum::LogLevel::Warning, fmt __VA_OPT__(,) __VA_ARGS__)
+#define AURUM_LOG_ERROR(fmt, ...) AURUM_LOG(::Aurum::LogLevel::Error, fmt __VA_OPT__(,) __VA_ARGS__)
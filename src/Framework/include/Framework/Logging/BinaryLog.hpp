@@ -0,0 +1,147 @@
+#pragma once
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <Framework/Logging/LogFormat.hpp>
+#include <Framework/Logging/LogRecord.hpp>
+#include <Framework/Logging/LogSink.hpp>
+
+namespace Aurum
+{
+    // ------------------------------------------------------------
+    // Binary Log Format
+    // ------------------------------------------------------------
+    // File layout (little-endian):
+    //   Header  : "AURUMLOG" | u16 version | u16 reserved | u32 reserved
+    //             | u64 anchor steady ns | i64 anchor wall ns
+    //   Entries : u8 head (kind in the low nibble) then kind-specific fields
+    //
+    //   Format  : varint id | u8 level | varint line
+    //             | varint fileLen | file | varint formatLen | format
+    //   Record  : level in the head's high nibble | varint threadId
+    //             | varint formatId | zigzag varint timestamp delta
+    //             | varint argLen | args
+    //
+    // A format string is written once, the first time a record refers
+    // to it. Format id 0 is reserved for plain Logger::Log() messages,
+    // whose args are the raw message text. Record args use the varint
+    // encoding from LogFormat.hpp. Timestamp deltas are taken against the
+    // same thread's previous record (the header anchor for its first),
+    // so interleaved threads do not turn them into large jumps.
+    namespace BinaryLog
+    {
+        constexpr char kMagic[8] = { 'A', 'U', 'R', 'U', 'M', 'L', 'O', 'G' };
+        constexpr std::uint16_t kVersion = 2;
+        constexpr std::size_t kHeaderSize = 32;
+        constexpr std::uint32_t kPlainFormatId = 0;
+
+        enum class EntryKind : std::uint8_t
+        {
+            Format = 1,
+            Record = 2
+        };
+
+        using LogDetail::ZigZagDecode;
+        using LogDetail::ZigZagEncode;
+
+        inline void WriteVarint(std::string& out, std::uint64_t value) { LogDetail::AppendVarint(out, value); }
+
+        // Previous timestamp per thread id (ids are small and sequential)
+        class ThreadTimestamps
+        {
+        public:
+            explicit ThreadTimestamps(std::uint64_t anchor = 0) : anchor_(anchor) {}
+
+            std::uint64_t& operator[](std::uint32_t threadId)
+            {
+                if (threadId >= last_.size())
+                    last_.resize(threadId + 1, anchor_);
+                return last_[threadId];
+            }
+
+        private:
+            std::uint64_t anchor_;
+            std::vector<std::uint64_t> last_;
+        };
+    }
+
+    // ------------------------------------------------------------
+    // Binary Log Sink
+    // ------------------------------------------------------------
+    class BinaryLogSink : public LogSink
+    {
+    public:
+        explicit BinaryLogSink(const std::string& path);
+        ~BinaryLogSink() override;
+
+        bool IsOpen() const { return file_.is_open(); }
+
+        void Write(const LogRecord& record, std::string_view line) override;
+        void Flush() override;
+        bool WantsText() const override { return false; }
+
+    private:
+        void WriteFormat(std::uint32_t id, const LogSite& site);
+
+        std::ofstream file_;
+        std::string buffer_;
+        std::vector<bool> writtenFormats_;
+        BinaryLog::ThreadTimestamps lastTimestamps_;
+    };
+
+    // ------------------------------------------------------------
+    // Binary Log Reader
+    // ------------------------------------------------------------
+    // Streams a binary log back in fixed-size chunks, so files of any
+    // size decode with bounded memory.
+    struct BinaryLogFormat
+    {
+        LogLevel level = LogLevel::Info;
+        std::uint32_t line = 0;
+        std::string file;
+        std::string format;
+    };
+
+    struct BinaryLogEntry
+    {
+        LogLevel level = LogLevel::Info;
+        std::uint64_t timestamp = 0;  // LogClock nanoseconds
+        std::int64_t wallNs = 0;      // Nanoseconds since the Unix epoch
+        std::uint32_t threadId = 0;
+        const BinaryLogFormat* format = nullptr; // nullptr for plain messages
+        std::string_view args;        // Valid until the next call to Next()
+    };
+
+    class BinaryLogReader
+    {
+    public:
+        bool Open(const std::string& path);
+
+        // Returns false at end of file or on a malformed entry (see GetError)
+        bool Next(BinaryLogEntry& out);
+
+        // Appends the expanded message text of an entry
+        static void FormatMessage(const BinaryLogEntry& entry, std::string& out);
+
+        const std::string& GetError() const { return error_; }
+
+    private:
+        bool Ensure(std::size_t bytes);
+        bool ReadByte(std::uint8_t& value);
+        bool ReadVarint(std::uint64_t& value);
+        bool ReadBytes(std::size_t length, std::string_view& out);
+        bool Fail(const std::string& message);
+
+        std::ifstream file_;
+        std::string buffer_;
+        std::size_t pos_ = 0;
+
+        LogClock::Anchor anchor_;
+        BinaryLog::ThreadTimestamps lastTimestamps_;
+        std::unordered_map<std::uint32_t, BinaryLogFormat> formats_;
+        std::string error_;
+    };
+}
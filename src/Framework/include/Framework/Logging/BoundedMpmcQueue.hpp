@@ -0,0 +1,118 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace Aurum
+{
+    // ------------------------------------------------------------
+    // Bounded lock-free multi-producer / multi-consumer queue
+    // ------------------------------------------------------------
+    // Array of cells with per-cell sequence numbers (Vyukov style).
+    // Producers and consumers only contend on their own position
+    // counter; a full or empty queue is reported instead of waiting.
+    template<typename T>
+    class BoundedMpmcQueue
+    {
+    public:
+        static constexpr std::size_t kCacheLine = 64;
+
+        explicit BoundedMpmcQueue(std::size_t capacity)
+        {
+            std::size_t size = 2;
+            while (size < capacity)
+                size <<= 1;
+
+            mask_ = size - 1;
+            cells_ = std::make_unique<Cell[]>(size);
+            for (std::size_t i = 0; i < size; ++i)
+                cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        BoundedMpmcQueue(const BoundedMpmcQueue&) = delete;
+        BoundedMpmcQueue& operator=(const BoundedMpmcQueue&) = delete;
+
+        // Returns false when the queue is full (value is left untouched)
+        bool TryPush(T&& value)
+        {
+            std::size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                Cell& cell = cells_[pos & mask_];
+                const std::size_t seq = cell.sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+
+                if (diff == 0)
+                {
+                    if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        cell.value = std::move(value);
+                        cell.sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    pos = enqueuePos_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        // Returns false when the queue is empty
+        bool TryPop(T& out)
+        {
+            std::size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                Cell& cell = cells_[pos & mask_];
+                const std::size_t seq = cell.sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+
+                if (diff == 0)
+                {
+                    if (dequeuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        out = std::move(cell.value);
+                        cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    pos = dequeuePos_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        std::size_t Capacity() const { return mask_ + 1; }
+
+        // Approximate when other threads are active
+        bool Empty() const
+        {
+            return enqueuePos_.load(std::memory_order_acquire) ==
+                   dequeuePos_.load(std::memory_order_acquire);
+        }
+
+    private:
+        struct alignas(kCacheLine) Cell
+        {
+            std::atomic<std::size_t> sequence{0};
+            T value{};
+        };
+
+        std::unique_ptr<Cell[]> cells_;
+        std::size_t mask_ = 0;
+
+        alignas(kCacheLine) std::atomic<std::size_t> enqueuePos_{0};
+        alignas(kCacheLine) std::atomic<std::size_t> dequeuePos_{0};
+    };
+}
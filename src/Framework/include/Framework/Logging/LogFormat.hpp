@@ -0,0 +1,603 @@
+#pragma once
+#include <charconv>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace Aurum
+{
+    // ------------------------------------------------------------
+    // Deferred Log Arguments
+    // ------------------------------------------------------------
+    // Arguments are captured as a tagged byte stream when a record is
+    // accepted and only turned into text when a sink needs it. Each
+    // argument is a one-byte LogArgType followed by its value: integers
+    // as LEB128 varints (zigzag for signed types, so small negatives stay
+    // short), float and double as their raw 4 / 8 bytes, strings as a
+    // varint length and the bytes.
+    enum class LogArgType : std::uint8_t
+    {
+        Int64 = 1,
+        UInt64,
+        Double,
+        Bool,
+        Char,
+        String,
+        Float
+    };
+
+    template<typename T>
+    concept LogToStringable = requires(const T& v) { { v.ToString() } -> std::convertible_to<std::string>; };
+
+    namespace LogDetail
+    {
+        constexpr std::uint64_t ZigZagEncode(std::int64_t value)
+        {
+            return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+        }
+
+        constexpr std::int64_t ZigZagDecode(std::uint64_t value)
+        {
+            return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+        }
+
+        inline void AppendVarint(std::string& out, std::uint64_t value)
+        {
+            char bytes[10];
+            std::size_t size = 0;
+            while (value >= 0x80)
+            {
+                bytes[size++] = static_cast<char>((value & 0x7F) | 0x80);
+                value >>= 7;
+            }
+            bytes[size++] = static_cast<char>(value);
+            out.append(bytes, size);
+        }
+
+        inline bool ReadVarint(std::string_view& in, std::uint64_t& value)
+        {
+            value = 0;
+            for (int shift = 0; shift < 64 && !in.empty(); shift += 7)
+            {
+                const auto byte = static_cast<std::uint8_t>(in.front());
+                in.remove_prefix(1);
+                value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0)
+                    return true;
+            }
+            return false;
+        }
+
+        template<typename T>
+        void AppendRaw(std::string& out, LogArgType type, const T& value)
+        {
+            char bytes[1 + sizeof(T)];
+            bytes[0] = static_cast<char>(type);
+            std::memcpy(bytes + 1, &value, sizeof(T));
+            out.append(bytes, sizeof(bytes));
+        }
+
+        inline void AppendTaggedVarint(std::string& out, LogArgType type, std::uint64_t value)
+        {
+            out += static_cast<char>(type);
+            AppendVarint(out, value);
+        }
+
+        inline void AppendString(std::string& out, std::string_view value)
+        {
+            AppendTaggedVarint(out, LogArgType::String, value.size());
+            out.append(value.data(), value.size());
+        }
+
+        template<typename T>
+        bool ReadRaw(std::string_view& in, T& value)
+        {
+            if (in.size() < sizeof(T))
+                return false;
+            std::memcpy(&value, in.data(), sizeof(T));
+            in.remove_prefix(sizeof(T));
+            return true;
+        }
+    }
+
+    template<typename T>
+    void EncodeLogArg(std::string& out, const T& value)
+    {
+        using U = std::remove_cvref_t<T>;
+
+        if constexpr (std::is_same_v<U, bool>)
+            LogDetail::AppendRaw(out, LogArgType::Bool, static_cast<std::uint8_t>(value ? 1 : 0));
+        else if constexpr (std::is_same_v<U, char>)
+            LogDetail::AppendRaw(out, LogArgType::Char, value);
+        else if constexpr (std::is_enum_v<U>)
+            LogDetail::AppendTaggedVarint(out, LogArgType::Int64, LogDetail::ZigZagEncode(static_cast<std::int64_t>(value)));
+        else if constexpr (std::is_integral_v<U> && std::is_signed_v<U>)
+            LogDetail::AppendTaggedVarint(out, LogArgType::Int64, LogDetail::ZigZagEncode(static_cast<std::int64_t>(value)));
+        else if constexpr (std::is_integral_v<U>)
+            LogDetail::AppendTaggedVarint(out, LogArgType::UInt64, static_cast<std::uint64_t>(value));
+        else if constexpr (std::is_same_v<U, float>)
+            LogDetail::AppendRaw(out, LogArgType::Float, value);
+        else if constexpr (std::is_floating_point_v<U>)
+            LogDetail::AppendRaw(out, LogArgType::Double, static_cast<double>(value));
+        else if constexpr (std::is_convertible_v<const U&, std::string_view>)
+            LogDetail::AppendString(out, std::string_view(value));
+        else if constexpr (LogToStringable<U>)
+            LogDetail::AppendString(out, value.ToString());
+        else
+            static_assert(sizeof(U) == 0, "Unsupported log argument type (add a ToString() member)");
+    }
+
+    // ------------------------------------------------------------
+    // Formatting
+    // ------------------------------------------------------------
+    // Supports the std::format standard spec for "{}" placeholders:
+    //   {:[[fill]align][sign][#][0][width][.precision][type]}
+    // with a one-byte fill, align '<', '>' or '^', sign '+', '-' or ' ',
+    // and types d b B o x X c (integers), f F e E g G a A (floats) and
+    // s (strings). Width and string precision count code points. '#' adds
+    // the 0x / 0b / 0 prefix to integers and keeps the point on floats.
+    // Positional indices, nested "{}" width / precision and locale 'L' are
+    // not supported; AURUM_LOG rejects such formats at compile time.
+    // "{{" and "}}" produce literal braces. Placeholders without a
+    // matching argument are copied through unchanged.
+    struct LogFormatSpec
+    {
+        char fill = ' ';
+        char align = 0;      // 0 = the type's default (numbers right, text left)
+        char sign = '-';
+        bool alternate = false;
+        bool zeroPad = false;
+        int width = 0;
+        int precision = -1;
+        char type = 0;
+        bool valid = true;
+    };
+
+    namespace LogDetail
+    {
+        // Keeps a typo like "{:99999999}" from turning into a huge allocation
+        inline constexpr int kMaxFormatWidth = 4096;
+
+        constexpr bool IsAlign(char c) { return c == '<' || c == '>' || c == '^'; }
+        constexpr bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+        constexpr bool IsLogFormatType(char c)
+        {
+            return std::string_view("dbBoxXcfFeEgGaAs").find(c) != std::string_view::npos;
+        }
+
+        constexpr bool ParseFormatNumber(std::string_view& spec, int& value)
+        {
+            value = 0;
+            if (spec.empty() || !IsDigit(spec.front()))
+                return false;
+            while (!spec.empty() && IsDigit(spec.front()))
+            {
+                value = value * 10 + (spec.front() - '0');
+                if (value > kMaxFormatWidth)
+                    return false;
+                spec.remove_prefix(1);
+            }
+            return true;
+        }
+
+        constexpr bool IsIntegerPresentation(char type)
+        {
+            return std::string_view("dbBoxX").find(type) != std::string_view::npos;
+        }
+
+        inline std::size_t CountCodePoints(std::string_view text)
+        {
+            std::size_t count = 0;
+            for (char c : text)
+                count += (static_cast<unsigned char>(c) & 0xC0) != 0x80;
+            return count;
+        }
+
+        // Byte length of the first count code points of text
+        inline std::size_t CodePointPrefix(std::string_view text, std::size_t count)
+        {
+            std::size_t i = 0;
+            while (i < text.size() && count > 0)
+            {
+                ++i;
+                while (i < text.size() && (static_cast<unsigned char>(text[i]) & 0xC0) == 0x80)
+                    ++i;
+                --count;
+            }
+            return i;
+        }
+
+        // Pads body out to spec.width. The first prefixLength bytes of body
+        // (sign and base prefix) stay in front of any zero padding.
+        inline void AppendPadded(std::string& out, std::string_view body, std::size_t prefixLength,
+                                 const LogFormatSpec& spec, char defaultAlign, bool zeroPad)
+        {
+            const std::size_t length = CountCodePoints(body);
+            const std::size_t width = static_cast<std::size_t>(spec.width);
+            if (width <= length)
+            {
+                out.append(body);
+                return;
+            }
+
+            const std::size_t padding = width - length;
+            if (zeroPad && spec.zeroPad && spec.align == 0)
+            {
+                out.append(body.substr(0, prefixLength));
+                out.append(padding, '0');
+                out.append(body.substr(prefixLength));
+                return;
+            }
+
+            const char align = spec.align ? spec.align : defaultAlign;
+            const std::size_t before = (align == '<') ? 0 : (align == '^') ? padding / 2 : padding;
+            out.append(before, spec.fill);
+            out.append(body);
+            out.append(padding - before, spec.fill);
+        }
+    }
+
+    // Returns a spec with valid == false for anything outside the grammar
+    // above, so callers can reject it at compile time.
+    constexpr LogFormatSpec ParseLogFormatSpec(std::string_view spec)
+    {
+        LogFormatSpec result;
+        if (spec.empty())
+            return result;
+        if (spec.front() != ':')
+        {
+            result.valid = false;   // Positional or named argument
+            return result;
+        }
+        spec.remove_prefix(1);
+
+        if (spec.size() >= 2 && LogDetail::IsAlign(spec[1]))
+        {
+            result.fill = spec[0];
+            result.align = spec[1];
+            spec.remove_prefix(2);
+            if (result.fill == '{' || result.fill == '}' || (static_cast<unsigned char>(result.fill) & 0x80))
+                result.valid = false;
+        }
+        else if (!spec.empty() && LogDetail::IsAlign(spec[0]))
+        {
+            result.align = spec[0];
+            spec.remove_prefix(1);
+        }
+
+        if (!spec.empty() && (spec[0] == '+' || spec[0] == '-' || spec[0] == ' '))
+        {
+            result.sign = spec[0];
+            spec.remove_prefix(1);
+        }
+        if (!spec.empty() && spec[0] == '#')
+        {
+            result.alternate = true;
+            spec.remove_prefix(1);
+        }
+        if (!spec.empty() && spec[0] == '0')
+        {
+            result.zeroPad = true;
+            spec.remove_prefix(1);
+        }
+        if (!spec.empty() && LogDetail::IsDigit(spec[0]) && !LogDetail::ParseFormatNumber(spec, result.width))
+            result.valid = false;
+        if (!spec.empty() && spec[0] == '.')
+        {
+            spec.remove_prefix(1);
+            if (!LogDetail::ParseFormatNumber(spec, result.precision))
+                result.valid = false;
+        }
+        if (!spec.empty() && LogDetail::IsLogFormatType(spec[0]))
+        {
+            result.type = spec[0];
+            spec.remove_prefix(1);
+        }
+
+        if (!spec.empty())
+            result.valid = false;
+        return result;
+    }
+
+    // True if every placeholder in format parses and every brace is
+    // matched. AURUM_LOG checks its format with this at compile time.
+    constexpr bool IsValidLogFormat(std::string_view format)
+    {
+        std::size_t i = 0;
+        while (i < format.size())
+        {
+            if (format[i] == '{')
+            {
+                if (i + 1 < format.size() && format[i + 1] == '{')
+                {
+                    i += 2;
+                    continue;
+                }
+                const std::size_t close = format.find('}', i + 1);
+                if (close == std::string_view::npos || !ParseLogFormatSpec(format.substr(i + 1, close - i - 1)).valid)
+                    return false;
+                i = close + 1;
+                continue;
+            }
+            if (format[i] == '}')
+            {
+                if (i + 1 >= format.size() || format[i + 1] != '}')
+                    return false;
+                i += 2;
+                continue;
+            }
+            ++i;
+        }
+        return true;
+    }
+
+    // Shortest round-trip text is per type, so a float prints as "0.1"
+    // rather than the digits of its double widening
+    template<typename T>
+    void AppendFormattedFloat(std::string& out, T value, const LogFormatSpec& spec)
+    {
+        const char type = spec.type;
+        std::chars_format format = std::chars_format::general;
+        if (type == 'f' || type == 'F') format = std::chars_format::fixed;
+        else if (type == 'e' || type == 'E') format = std::chars_format::scientific;
+        else if (type == 'a' || type == 'A') format = std::chars_format::hex;
+
+        // Leaves room for a sign in front of the digits
+        auto convert = [&](char* first, char* last)
+        {
+            if (spec.precision >= 0)
+                return std::to_chars(first, last, value, format, spec.precision);
+            if (type == 'a' || type == 'A')
+                return std::to_chars(first, last, value, format);
+            if (type == 'f' || type == 'F' || type == 'e' || type == 'E' || type == 'g' || type == 'G')
+                return std::to_chars(first, last, value, format, 6);
+            return std::to_chars(first, last, value);
+        };
+
+        // Fixed notation of a large double needs over 300 digits, more
+        // with a long precision
+        char buffer[512];
+        std::string large;
+        char* first = buffer + 1;
+        std::to_chars_result res = convert(first, std::end(buffer));
+        if (res.ec == std::errc::value_too_large)
+        {
+            large.resize(400 + static_cast<std::size_t>(spec.precision > 0 ? spec.precision : 0));
+            first = large.data() + 1;
+            res = convert(first, large.data() + large.size());
+        }
+        if (res.ec != std::errc())
+            return;
+
+        char* last = res.ptr;
+        if (*first != '-' && spec.sign != '-')
+            *--first = spec.sign;
+        if (type == 'F' || type == 'E' || type == 'G' || type == 'A')
+        {
+            for (char* c = first; c != last; ++c)
+            {
+                if (*c >= 'a' && *c <= 'z')
+                    *c = static_cast<char>(*c - 'a' + 'A');
+            }
+        }
+
+        std::string_view body(first, static_cast<std::size_t>(last - first));
+        const bool finite = std::isfinite(value);
+        std::string withPoint;
+        if (spec.alternate && finite && body.find('.') == std::string_view::npos)
+        {
+            const std::size_t exponent = body.find_first_of("eEpP");
+            withPoint.assign(body.substr(0, exponent));
+            withPoint += '.';
+            if (exponent != std::string_view::npos)
+                withPoint.append(body.substr(exponent));
+            body = withPoint;
+        }
+
+        const std::size_t prefixLength = (body.front() == '-' || body.front() == '+' || body.front() == ' ') ? 1 : 0;
+        LogDetail::AppendPadded(out, body, prefixLength, spec, '>', finite);
+    }
+
+    template<typename T>
+    void AppendFormattedInteger(std::string& out, T value, const LogFormatSpec& spec)
+    {
+        if (spec.type == 'c')
+        {
+            const char c = static_cast<char>(value);
+            LogDetail::AppendPadded(out, std::string_view(&c, 1), 0, spec, '>', false);
+            return;
+        }
+
+        int base = 10;
+        const char* prefix = "";
+        switch (spec.type)
+        {
+            case 'b': base = 2;  prefix = "0b"; break;
+            case 'B': base = 2;  prefix = "0B"; break;
+            case 'o': base = 8;  prefix = "0";  break;
+            case 'x': base = 16; prefix = "0x"; break;
+            case 'X': base = 16; prefix = "0X"; break;
+            default: break;
+        }
+
+        bool negative = false;
+        if constexpr (std::is_signed_v<T>)
+            negative = value < 0;
+        using Unsigned = std::make_unsigned_t<T>;
+        const Unsigned magnitude = negative ? static_cast<Unsigned>(Unsigned(0) - static_cast<Unsigned>(value))
+                                            : static_cast<Unsigned>(value);
+
+        // Sign, prefix and up to 64 binary digits
+        char buffer[80];
+        char* end = buffer;
+        if (negative) *end++ = '-';
+        else if (spec.sign != '-') *end++ = spec.sign;
+        if (spec.alternate && !(base == 8 && magnitude == 0))
+        {
+            for (const char* p = prefix; *p; ++p)
+                *end++ = *p;
+        }
+
+        const std::size_t prefixLength = static_cast<std::size_t>(end - buffer);
+        const auto res = std::to_chars(end, std::end(buffer), magnitude, base);
+        if (spec.type == 'X')
+        {
+            for (char* c = end; c != res.ptr; ++c)
+            {
+                if (*c >= 'a' && *c <= 'f')
+                    *c = static_cast<char>(*c - 'a' + 'A');
+            }
+        }
+        LogDetail::AppendPadded(out, std::string_view(buffer, static_cast<std::size_t>(res.ptr - buffer)),
+                                prefixLength, spec, '>', true);
+    }
+
+    inline void AppendFormattedString(std::string& out, std::string_view value, const LogFormatSpec& spec)
+    {
+        if (spec.precision >= 0)
+            value = value.substr(0, LogDetail::CodePointPrefix(value, static_cast<std::size_t>(spec.precision)));
+        LogDetail::AppendPadded(out, value, 0, spec, '<', false);
+    }
+
+    // One decoded argument; only the field matching type is meaningful
+    struct LogArgValue
+    {
+        LogArgType type = LogArgType::Int64;
+        std::int64_t i = 0;
+        std::uint64_t u = 0;
+        double d = 0.0;
+        float f = 0.0f;
+        std::string_view s;
+    };
+
+    // Reads the next argument from the stream.
+    // Returns false if the stream is exhausted or malformed.
+    inline bool ReadLogArg(std::string_view& args, LogArgValue& out)
+    {
+        if (args.empty())
+            return false;
+
+        out.type = static_cast<LogArgType>(args.front());
+        args.remove_prefix(1);
+
+        switch (out.type)
+        {
+            case LogArgType::Int64:
+            {
+                std::uint64_t v = 0;
+                if (!LogDetail::ReadVarint(args, v)) return false;
+                out.i = LogDetail::ZigZagDecode(v);
+                return true;
+            }
+            case LogArgType::UInt64:
+                return LogDetail::ReadVarint(args, out.u);
+            case LogArgType::Double:
+                return LogDetail::ReadRaw(args, out.d);
+            case LogArgType::Float:
+                return LogDetail::ReadRaw(args, out.f);
+            case LogArgType::Bool:
+            {
+                std::uint8_t v = 0;
+                if (!LogDetail::ReadRaw(args, v)) return false;
+                out.u = v;
+                return true;
+            }
+            case LogArgType::Char:
+            {
+                char v = 0;
+                if (!LogDetail::ReadRaw(args, v)) return false;
+                out.s = std::string_view(args.data() - 1, 1);
+                return true;
+            }
+            case LogArgType::String:
+            {
+                std::uint64_t length = 0;
+                if (!LogDetail::ReadVarint(args, length) || args.size() < length) return false;
+                out.s = args.substr(0, length);
+                args.remove_prefix(length);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Bool and char switch to their numeric value for an integer type
+    inline void AppendLogArg(std::string& out, const LogArgValue& value, const LogFormatSpec& spec)
+    {
+        switch (value.type)
+        {
+            case LogArgType::Int64:  AppendFormattedInteger(out, value.i, spec); break;
+            case LogArgType::UInt64: AppendFormattedInteger(out, value.u, spec); break;
+            case LogArgType::Double: AppendFormattedFloat(out, value.d, spec); break;
+            case LogArgType::Float:  AppendFormattedFloat(out, value.f, spec); break;
+            case LogArgType::Bool:
+                if (LogDetail::IsIntegerPresentation(spec.type))
+                    AppendFormattedInteger(out, value.u, spec);
+                else
+                    AppendFormattedString(out, value.u ? "true" : "false", spec);
+                break;
+            case LogArgType::Char:
+                if (LogDetail::IsIntegerPresentation(spec.type))
+                    AppendFormattedInteger(out, static_cast<int>(value.s.front()), spec);
+                else
+                    AppendFormattedString(out, value.s, spec);
+                break;
+            case LogArgType::String: AppendFormattedString(out, value.s, spec); break;
+        }
+    }
+
+    // Expands format with the encoded argument stream and appends the result.
+    inline void FormatLogMessage(std::string& out, std::string_view format, std::string_view args)
+    {
+        std::size_t i = 0;
+        while (i < format.size())
+        {
+            const char c = format[i];
+
+            if (c == '{')
+            {
+                if (i + 1 < format.size() && format[i + 1] == '{')
+                {
+                    out += '{';
+                    i += 2;
+                    continue;
+                }
+
+                const std::size_t close = format.find('}', i + 1);
+                if (close == std::string_view::npos)
+                {
+                    out.append(format.substr(i));
+                    return;
+                }
+
+                // An unsupported spec (only possible in a decoded file) still
+                // consumes its argument so the rest stay in place
+                LogArgValue value;
+                const LogFormatSpec spec = ParseLogFormatSpec(format.substr(i + 1, close - i - 1));
+                if (ReadLogArg(args, value) && spec.valid)
+                    AppendLogArg(out, value, spec);
+                else
+                    out.append(format.substr(i, close - i + 1));
+
+                i = close + 1;
+                continue;
+            }
+
+            if (c == '}' && i + 1 < format.size() && format[i + 1] == '}')
+            {
+                out += '}';
+                i += 2;
+                continue;
+            }
+
+            out += c;
+            ++i;
+        }
+    }
+}
@@ -0,0 +1,140 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <Framework/Logging/LogRecord.hpp>
+
+namespace Aurum
+{
+    struct LogRateLimitConfig
+    {
+        bool enabled = false;                     // Opt in: Logger passes everything by default
+        std::chrono::milliseconds window{ 1000 }; // Counting window per message
+        std::uint32_t burst = 10;                 // Records let through per window
+    };
+
+    // ------------------------------------------------------------
+    // Log Rate Limiter
+    // ------------------------------------------------------------
+    // Groups records by call site (AURUM_LOG_* records) or by message
+    // text (plain Logger::Log records). Within each window only the first
+    // `burst` records of a group pass; the rest are counted, and a single
+    // "Suppressed N similar messages" record is emitted once the window
+    // closes. Not thread-safe: the Logger calls it under its write lock.
+    class LogRateLimiter
+    {
+    public:
+        void Configure(const LogRateLimitConfig& config) { config_ = config; }
+        const LogRateLimitConfig& GetConfig() const { return config_; }
+
+        // Returns true if the record should be written. Summary records for
+        // groups whose window has closed are appended to summaries.
+        bool Admit(const LogRecord& record, std::vector<LogRecord>& summaries)
+        {
+            if (!config_.enabled)
+                return true;
+
+            const std::uint64_t window = WindowNs();
+            Group& group = groups_[KeyOf(record)];
+
+            if (group.count == 0 || record.timestamp >= group.windowStart + window)
+            {
+                if (group.suppressed > 0)
+                    summaries.push_back(MakeSummary(group, record.timestamp));
+
+                group.windowStart = record.timestamp;
+                group.count = 0;
+                group.suppressed = 0;
+                group.level = record.level;
+                group.sample = SampleOf(record);
+            }
+
+            if (++group.count <= config_.burst)
+                return true;
+
+            ++group.suppressed;
+            return false;
+        }
+
+        // Emits summaries for groups whose window closed without a new record
+        // arriving, and forgets idle groups so the table stays small.
+        void Sweep(std::uint64_t now, std::vector<LogRecord>& summaries)
+        {
+            if (!config_.enabled || now < lastSweep_ + WindowNs() / 4)
+                return;
+            lastSweep_ = now;
+
+            const std::uint64_t window = WindowNs();
+            for (auto it = groups_.begin(); it != groups_.end();)
+            {
+                Group& group = it->second;
+                if (now < group.windowStart + window)
+                {
+                    ++it;
+                    continue;
+                }
+
+                if (group.suppressed > 0)
+                {
+                    summaries.push_back(MakeSummary(group, now));
+                    group.suppressed = 0;
+                }
+                it = groups_.erase(it);
+            }
+        }
+
+    private:
+        struct Group
+        {
+            std::uint64_t windowStart = 0;
+            std::uint32_t count = 0;
+            std::uint64_t suppressed = 0;
+            LogLevel level = LogLevel::Info;
+            std::string sample; // Format string or message text, for the summary
+        };
+
+        std::uint64_t WindowNs() const
+        {
+            return static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(config_.window).count());
+        }
+
+        static std::uint64_t KeyOf(const LogRecord& record)
+        {
+            if (record.site)
+                return reinterpret_cast<std::uintptr_t>(record.site);
+
+            // FNV-1a over the text, tagged so it cannot collide with a pointer
+            std::uint64_t hash = 14695981039346656037ull;
+            for (unsigned char c : record.payload)
+                hash = (hash ^ c) * 1099511628211ull;
+            return hash | 1ull;
+        }
+
+        static std::string SampleOf(const LogRecord& record)
+        {
+            constexpr std::size_t kMaxSample = 120;
+            const std::string_view text = record.site ? std::string_view(record.site->format)
+                                                      : std::string_view(record.payload);
+            return std::string(text.substr(0, kMaxSample));
+        }
+
+        static LogRecord MakeSummary(const Group& group, std::uint64_t timestamp)
+        {
+            LogRecord summary;
+            summary.level = group.level;
+            summary.timestamp = timestamp;
+            summary.threadId = CurrentLogThreadId();
+            summary.payload = "Suppressed " + std::to_string(group.suppressed) +
+                              " similar messages: " + group.sample;
+            return summary;
+        }
+
+        LogRateLimitConfig config_;
+        std::unordered_map<std::uint64_t, Group> groups_;
+        std::uint64_t lastSweep_ = 0;
+    };
+}
@@ -0,0 +1,126 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+// ------------------------------------------------------------
+// Compile-time log level
+// ------------------------------------------------------------
+// Calls below this level are removed by the AURUM_LOG_* macros.
+// 0 = Debug, 1 = Info, 2 = Warning, 3 = Error, 4 = Off
+#ifndef AURUM_LOG_MIN_LEVEL
+    #if defined(_DEBUG) || !defined(NDEBUG)
+        #define AURUM_LOG_MIN_LEVEL 0
+    #else
+        #define AURUM_LOG_MIN_LEVEL 1
+    #endif
+#endif
+
+namespace Aurum
+{
+    // Ordered by severity so levels can be compared against thresholds
+    enum class LogLevel
+    {
+        Debug,
+        Info,
+        Warning,
+        Error
+    };
+
+    constexpr bool IsLogLevelCompiled(LogLevel level)
+    {
+        return static_cast<int>(level) >= AURUM_LOG_MIN_LEVEL;
+    }
+
+    constexpr const char* LogLevelToString(LogLevel level)
+    {
+        switch (level)
+        {
+            case LogLevel::Info: return "[INFO]";
+            case LogLevel::Warning: return "[WARN]";
+            case LogLevel::Error: return "[ERROR]";
+            case LogLevel::Debug: return "[DEBUG]";
+            default: return "[UNKNOWN]";
+        }
+    }
+
+    // Static description of one AURUM_LOG_* call site.
+    // The id is assigned on first use and names the format string in
+    // binary logs; 0 means "not assigned yet".
+    struct LogSite
+    {
+        LogLevel level;
+        const char* format;
+        const char* file;
+        int line;
+        mutable std::atomic<std::uint32_t> id{0};
+    };
+
+    // Returns the process-wide id of a call site, assigning one if needed
+    inline std::uint32_t GetLogSiteId(const LogSite& site)
+    {
+        static std::atomic<std::uint32_t> nextId{1};
+
+        std::uint32_t id = site.id.load(std::memory_order_acquire);
+        if (id != 0)
+            return id;
+
+        const std::uint32_t candidate = nextId.fetch_add(1, std::memory_order_relaxed);
+        if (site.id.compare_exchange_strong(id, candidate, std::memory_order_acq_rel))
+            return candidate;
+        return id; // Another thread won the race
+    }
+
+    // ------------------------------------------------------------
+    // Log Clock
+    // ------------------------------------------------------------
+    // Records are stamped with a monotonic nanosecond counter; the wall
+    // clock time is reconstructed from one anchor taken at startup.
+    struct LogClock
+    {
+        static std::uint64_t Now()
+        {
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+        // Pairs a steady timestamp with the system clock at the same moment
+        struct Anchor
+        {
+            std::uint64_t steadyNs = 0;
+            std::int64_t wallNs = 0; // Nanoseconds since the Unix epoch
+
+            static Anchor Capture()
+            {
+                Anchor anchor;
+                anchor.steadyNs = Now();
+                anchor.wallNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::system_clock::now().time_since_epoch()).count();
+                return anchor;
+            }
+
+            std::int64_t ToWallNs(std::uint64_t steadyNs) const
+            {
+                return wallNs + (static_cast<std::int64_t>(steadyNs) - static_cast<std::int64_t>(this->steadyNs));
+            }
+        };
+    };
+
+    // Small sequential id for the calling thread (1, 2, 3, ...)
+    inline std::uint32_t CurrentLogThreadId()
+    {
+        static std::atomic<std::uint32_t> nextId{1};
+        thread_local const std::uint32_t id = nextId.fetch_add(1, std::memory_order_relaxed);
+        return id;
+    }
+
+    struct LogRecord
+    {
+        LogLevel level = LogLevel::Info;
+        std::uint64_t timestamp = 0;   // LogClock nanoseconds
+        std::uint32_t threadId = 0;
+        const LogSite* site = nullptr; // Set for deferred-format records
+        std::string payload;           // Message text, or encoded arguments when site is set
+    };
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include <atomic>
+#include <string_view>
+#include <Framework/Logging/LogRecord.hpp>
+
+namespace Aurum
+{
+    // ------------------------------------------------------------
+    // Log Sink Interface
+    // ------------------------------------------------------------
+    // Sinks receive every record the Logger emits at or above their own
+    // level. Calls are serialized by the Logger, so implementations need
+    // no locking of their own, and must not log from inside Write().
+    // Sinks are expected to buffer in Write() and hand the buffer to the
+    // OS in Flush(), which the Logger calls once per batch.
+    class LogSink
+    {
+    public:
+        virtual ~LogSink() = default;
+
+        // line is the formatted text of the record including the trailing
+        // newline, or empty when no attached sink asked for text.
+        virtual void Write(const LogRecord& record, std::string_view line) = 0;
+        virtual void Flush() {}
+
+        // Sinks that work on the raw record can opt out of text formatting
+        virtual bool WantsText() const { return true; }
+
+        // Per-sink level filter (everything by default)
+        void SetLevel(LogLevel level) { level_.store(level, std::memory_order_relaxed); }
+        LogLevel GetLevel() const { return level_.load(std::memory_order_relaxed); }
+
+        bool Accepts(LogLevel level) const
+        {
+            return static_cast<int>(level) >= static_cast<int>(level_.load(std::memory_order_relaxed));
+        }
+
+    private:
+        std::atomic<LogLevel> level_{ LogLevel::Debug };
+    };
+}
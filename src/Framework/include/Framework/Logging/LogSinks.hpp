@@ -0,0 +1,115 @@
+#pragma once
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <Framework/Logging/LogSink.hpp>
+#include <Framework/MappedFile.hpp>
+
+namespace Aurum
+{
+    // ---------------------------------------
+    // Console Sink: std::cout, one write per batch
+    // ---------------------------------------
+    class ConsoleLogSink : public LogSink
+    {
+    public:
+        void Write(const LogRecord& record, std::string_view line) override;
+        void Flush() override;
+
+    private:
+        std::string buffer_;
+    };
+
+    // ---------------------------------------
+    // File Sink: appends to a single text file
+    // ---------------------------------------
+    class FileLogSink : public LogSink
+    {
+    public:
+        explicit FileLogSink(const std::string& path);
+
+        bool IsOpen() const { return file_.is_open(); }
+
+        void Write(const LogRecord& record, std::string_view line) override;
+        void Flush() override;
+
+    private:
+        std::ofstream file_;
+        std::string buffer_;
+    };
+
+    // ---------------------------------------
+    // Rotating File Sink
+    // ---------------------------------------
+    // Writes to path until it would exceed maxBytes, then shifts
+    // path -> path.1 -> path.2 ... keeping at most maxBackups old files.
+    class RotatingFileLogSink : public LogSink
+    {
+    public:
+        RotatingFileLogSink(const std::string& path, std::uint64_t maxBytes, std::size_t maxBackups);
+
+        void Write(const LogRecord& record, std::string_view line) override;
+        void Flush() override;
+
+    private:
+        void Rotate();
+
+        std::string path_;
+        std::uint64_t maxBytes_;
+        std::size_t maxBackups_;
+
+        std::ofstream file_;
+        std::uint64_t fileSize_ = 0; // Bytes on disk plus buffered
+        std::string buffer_;
+    };
+
+    // ---------------------------------------
+    // Ring Buffer Sink: last N lines kept in memory
+    // ---------------------------------------
+    // Meant for crash handlers and debug consoles. Line storage is
+    // reused, so steady-state logging does not allocate.
+    class RingBufferLogSink : public LogSink
+    {
+    public:
+        explicit RingBufferLogSink(std::size_t capacity);
+
+        void Write(const LogRecord& record, std::string_view line) override;
+
+        // Oldest first. Safe to call from any thread.
+        std::vector<std::string> Snapshot() const;
+        void Dump(std::ostream& out) const;
+
+    private:
+        mutable std::mutex mutex_;
+        std::vector<std::string> lines_;
+        std::size_t next_ = 0;
+        std::size_t count_ = 0;
+    };
+
+    // ---------------------------------------
+    // Memory-Mapped File Sink
+    // ---------------------------------------
+    // Appends by copying into a shared file mapping, so writes cost a
+    // memcpy instead of a syscall. Written pages live in the OS page
+    // cache, so they survive a crash of the process without any flush.
+    // The file grows in chunkSize steps and is trimmed to its real length
+    // when the sink is destroyed; after a crash the zero-filled tail is
+    // skipped when the file is reopened.
+    class MappedFileLogSink : public LogSink
+    {
+    public:
+        explicit MappedFileLogSink(const std::string& path, std::size_t chunkSize = 4 * 1024 * 1024);
+        ~MappedFileLogSink() override;
+
+        bool IsOpen() const { return file_.IsOpen(); }
+
+        void Write(const LogRecord& record, std::string_view line) override;
+
+    private:
+        MappedFile file_;
+        std::size_t chunkSize_;
+        std::size_t writeOffset_ = 0;
+    };
+}
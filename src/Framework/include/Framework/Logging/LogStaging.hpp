@@ -0,0 +1,72 @@
+#pragma once
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <Framework/Logging/LogRecord.hpp>
+
+namespace Aurum
+{
+    // ------------------------------------------------------------
+    // Timestamp Cache
+    // ------------------------------------------------------------
+    // Formats the "HH:MM:SS" log prefix and only rebuilds it when the
+    // wall-clock second changes. Not shared between threads: each
+    // formatting context owns one.
+    class TimestampCache
+    {
+    public:
+        std::string_view Format(std::uint64_t timestamp, const LogClock::Anchor& anchor)
+        {
+            const std::int64_t wallNs = anchor.ToWallNs(timestamp);
+            std::int64_t second = wallNs / 1000000000;
+            if (wallNs < 0 && second * 1000000000 != wallNs)
+                --second;
+
+            if (second != cachedSecond_)
+            {
+                const std::time_t time = static_cast<std::time_t>(second);
+                std::tm local{};
+#if defined(_WIN32)
+                localtime_s(&local, &time);
+#else
+                localtime_r(&time, &local);
+#endif
+                std::snprintf(text_, sizeof(text_), "%02d:%02d:%02d", local.tm_hour, local.tm_min, local.tm_sec);
+                cachedSecond_ = second;
+            }
+            return text_;
+        }
+
+    private:
+        std::int64_t cachedSecond_ = std::numeric_limits<std::int64_t>::min();
+        char text_[16] = {};
+    };
+
+    // ------------------------------------------------------------
+    // Per-Thread Staging Buffer
+    // ------------------------------------------------------------
+    // Each logging thread formats its records into its own buffer; the
+    // lock is only contended while the Logger collects buffers to merge.
+    struct LogStagingBuffer
+    {
+        std::mutex mutex;
+        std::vector<LogRecord> records;
+        std::string text;                     // Formatted lines, back to back
+        std::vector<std::size_t> lineOffsets; // Start of each record's line in text
+        TimestampCache timestamps;            // Only touched by the owning thread
+        bool orphaned = false;                // Owning thread has exited
+    };
+
+    // Records staged by one thread, detached from its buffer for merging
+    struct LogStagedBatch
+    {
+        std::vector<LogRecord> records;
+        std::string text;
+        std::vector<std::size_t> lineOffsets;
+    };
+}
@@ -0,0 +1,82 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Aurum
+{
+    // ---------------------------------------
+    // Memory-Mapped File
+    // ---------------------------------------
+    // Thin wrapper over mmap / MapViewOfFile. Read mode maps an existing
+    // file read-only; ReadWrite mode creates the file if needed and can
+    // grow or shrink it with Resize(), which remaps the view.
+    class MappedFile
+    {
+    public:
+        enum class Mode
+        {
+            Read,
+            ReadWrite
+        };
+
+        MappedFile() = default;
+        ~MappedFile() { Close(); }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        MappedFile(MappedFile&& other) noexcept { MoveFrom(other); }
+        MappedFile& operator=(MappedFile&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Close();
+                MoveFrom(other);
+            }
+            return *this;
+        }
+
+        // For ReadWrite, minSize extends a smaller file to at least that size
+        bool Open(const std::string& path, Mode mode, std::size_t minSize = 0);
+        void Close();
+
+        // ReadWrite only. Existing contents up to the new size are preserved.
+        // On failure Data() stays valid for Size(): the old view is kept, or
+        // on Windows the file is closed if it cannot be mapped again.
+        bool Resize(std::size_t newSize);
+
+        // Schedules dirty pages for write-back without waiting for the disk
+        void FlushAsync();
+
+        bool IsOpen() const { return handle_ != kInvalidHandle; }
+        std::size_t Size() const { return size_; }
+        const std::uint8_t* Data() const { return data_; }
+        std::uint8_t* Data() { return data_; }
+
+    private:
+        bool Map();
+        void Unmap();
+
+        void MoveFrom(MappedFile& other)
+        {
+            handle_ = other.handle_;
+            mapping_ = other.mapping_;
+            data_ = other.data_;
+            size_ = other.size_;
+            mode_ = other.mode_;
+            other.handle_ = kInvalidHandle;
+            other.mapping_ = nullptr;
+            other.data_ = nullptr;
+            other.size_ = 0;
+        }
+
+        static constexpr std::intptr_t kInvalidHandle = -1;
+
+        std::intptr_t handle_ = kInvalidHandle; // File descriptor or HANDLE
+        void* mapping_ = nullptr;               // Windows file mapping object
+        std::uint8_t* data_ = nullptr;
+        std::size_t size_ = 0;
+        Mode mode_ = Mode::Read;
+    };
+}
@@ -0,0 +1,120 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+#include <Framework/Math/Matrix4x4.hpp>
+#include <Framework/Math/Quaternion.hpp>
+#include <Framework/Math/Vector3.hpp>
+
+namespace Aurum
+{
+    // ---------------------------------------
+    // Structure-of-arrays streams
+    // ---------------------------------------
+    // Separate x / y / z float arrays, so one SIMD register holds the same
+    // component of 8 (AVX2) or 16 (AVX-512) elements and the kernels need
+    // no shuffles. Pointers only; the caller owns the storage.
+    struct Float3Stream
+    {
+        float* x = nullptr;
+        float* y = nullptr;
+        float* z = nullptr;
+    };
+
+    struct ConstFloat3Stream
+    {
+        const float* x = nullptr;
+        const float* y = nullptr;
+        const float* z = nullptr;
+
+        ConstFloat3Stream() = default;
+        ConstFloat3Stream(const float* x, const float* y, const float* z) : x(x), y(y), z(z) {}
+        ConstFloat3Stream(Float3Stream s) : x(s.x), y(s.y), z(s.z) {}
+    };
+
+    // Quaternions as four streams, (w, x, y, z) like Quaternion
+    struct ConstQuaternionStream
+    {
+        const float* w = nullptr;
+        const float* x = nullptr;
+        const float* y = nullptr;
+        const float* z = nullptr;
+    };
+
+    // Owning SoA storage for Vector3 data
+    class Float3Buffer
+    {
+    public:
+        Float3Buffer() = default;
+        explicit Float3Buffer(std::size_t count) { Resize(count); }
+
+        void Resize(std::size_t count)
+        {
+            x_.resize(count);
+            y_.resize(count);
+            z_.resize(count);
+        }
+
+        std::size_t Size() const { return x_.size(); }
+
+        Float3Stream Stream() { return {x_.data(), y_.data(), z_.data()}; }
+        ConstFloat3Stream Stream() const { return {x_.data(), y_.data(), z_.data()}; }
+
+        Vector3 Get(std::size_t i) const { return {x_[i], y_[i], z_[i]}; }
+        void Set(std::size_t i, const Vector3& v)
+        {
+            x_[i] = v.x;
+            y_[i] = v.y;
+            z_[i] = v.z;
+        }
+
+    private:
+        std::vector<float> x_, y_, z_;
+    };
+
+    // ---------------------------------------
+    // Batch Math: SoA kernels with runtime dispatch
+    // ---------------------------------------
+    // Unlike Simd.hpp (picked at compile time), the widest kernels the CPU
+    // and OS support are chosen at startup: AVX-512F, AVX2, or the scalar
+    // reference. Every backend performs the same IEEE operations in the same
+    // order as the AoS kernels in Simd.hpp, so TransformPoints matches
+    // Matrix4x4::TransformPoint bit for bit whichever backend runs.
+    //
+    // Output may alias input (in-place); partial overlap is not allowed.
+    enum class BatchMathBackend
+    {
+        Scalar,
+        Avx2,
+        Avx512
+    };
+
+    namespace BatchMath
+    {
+        // out[i] = in[i] * matrix
+        void TransformPoints(const Matrix4x4& matrix, ConstFloat3Stream in, Float3Stream out, std::size_t count);
+
+        // out[i] = in[i] * matrices[i]
+        void TransformPoints(const Matrix4x4* matrices, ConstFloat3Stream in, Float3Stream out, std::size_t count);
+
+        // Near-zero vectors are copied unchanged, as in Vector3::Normalized
+        void Normalize(ConstFloat3Stream in, Float3Stream out, std::size_t count);
+
+        // out[i] = rotations[i] applied to in[i]; rotations must be unit length
+        void Rotate(ConstQuaternionStream rotations, ConstFloat3Stream in, Float3Stream out, std::size_t count);
+
+        // Conservative bounds of each transformed box (centre / extents form)
+        void TransformAabbs(const Matrix4x4& matrix, ConstFloat3Stream mins, ConstFloat3Stream maxs,
+                            Float3Stream outMins, Float3Stream outMaxs, std::size_t count);
+
+        // --- Dispatch ---
+        BatchMathBackend GetBackend();
+        const char* GetBackendName(BatchMathBackend backend);
+        inline const char* GetBackendName() { return GetBackendName(GetBackend()); }
+
+        // Built into this binary and usable on this CPU / OS
+        bool IsSupported(BatchMathBackend backend);
+
+        // Force a backend (benchmarks, debugging); false if unsupported
+        bool SetBackend(BatchMathBackend backend);
+    }
+}
@@ -0,0 +1,150 @@
+#pragma once
+#include <compare>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+
+namespace Aurum
+{
+    // ---------------------------------------
+    // Fixed: Q16.16 fixed-point scalar
+    // ---------------------------------------
+    // Integer-only arithmetic, so every operation (including Sqrt, Sin and
+    // Cos) gives the same bits on any compiler, CPU and optimization level.
+    // Meant for lockstep simulation state; plugs into the math templates
+    // (FixedVector3, FixedQuaternion, ...).
+    //
+    // Range is +-32768 at a resolution of 1/65536. Products round to
+    // nearest, quotients truncate toward zero, results outside the range
+    // wrap like integers and division by zero saturates. Doubles convert
+    // the same way (rounded, then wrapped); NaN becomes zero and values
+    // past the 64-bit range, infinities included, saturate. Squared lengths
+    // overflow past ~181, so keep simulation spaces small or scaled.
+    struct Fixed
+    {
+        static constexpr int kFractionBits = 16;
+        static constexpr std::int32_t kOne = std::int32_t(1) << kFractionBits;
+
+        std::int32_t raw = 0;
+
+        constexpr Fixed() = default;
+        constexpr explicit Fixed(int value) : raw(Wrap(static_cast<std::int64_t>(value) * kOne)) {}
+        constexpr explicit Fixed(double value) : raw(WrapDouble(value)) {}
+        constexpr explicit Fixed(float value) : Fixed(static_cast<double>(value)) {}
+
+        static constexpr Fixed FromRaw(std::int32_t raw)
+        {
+            Fixed result;
+            result.raw = raw;
+            return result;
+        }
+
+        constexpr explicit operator double() const { return static_cast<double>(raw) / kOne; }
+        constexpr explicit operator float() const { return static_cast<float>(static_cast<double>(*this)); }
+
+        // Arithmetic (in 64 bits, then wrapped back to 32)
+        constexpr Fixed operator-() const { return FromRaw(Wrap(-static_cast<std::int64_t>(raw))); }
+        constexpr Fixed operator+(Fixed other) const { return FromRaw(Wrap(static_cast<std::int64_t>(raw) + other.raw)); }
+        constexpr Fixed operator-(Fixed other) const { return FromRaw(Wrap(static_cast<std::int64_t>(raw) - other.raw)); }
+        constexpr Fixed operator*(Fixed other) const
+        {
+            const std::int64_t product = static_cast<std::int64_t>(raw) * other.raw;
+            return FromRaw(Wrap((product + (std::int64_t(1) << (kFractionBits - 1))) >> kFractionBits));
+        }
+        constexpr Fixed operator/(Fixed other) const
+        {
+            if (other.raw == 0)
+                return FromRaw(raw >= 0 ? std::numeric_limits<std::int32_t>::max() : std::numeric_limits<std::int32_t>::min());
+            return FromRaw(Wrap((static_cast<std::int64_t>(raw) << kFractionBits) / other.raw));
+        }
+
+        constexpr Fixed& operator+=(Fixed other) { return *this = *this + other; }
+        constexpr Fixed& operator-=(Fixed other) { return *this = *this - other; }
+        constexpr Fixed& operator*=(Fixed other) { return *this = *this * other; }
+        constexpr Fixed& operator/=(Fixed other) { return *this = *this / other; }
+
+        constexpr bool operator==(const Fixed&) const = default;
+        constexpr auto operator<=>(const Fixed&) const = default;
+
+        // Nearest to the exact root; zero for negative input
+        static constexpr Fixed Sqrt(Fixed v)
+        {
+            if (v.raw <= 0)
+                return Fixed();
+
+            // Bit-by-bit integer square root of raw << 16 (a Q32 value)
+            std::uint64_t rem = static_cast<std::uint64_t>(v.raw) << kFractionBits;
+            std::uint64_t root = 0;
+            std::uint64_t bit = std::uint64_t(1) << 62;
+            while (bit > rem)
+                bit >>= 2;
+            while (bit != 0)
+            {
+                if (rem >= root + bit)
+                {
+                    rem -= root + bit;
+                    root = (root >> 1) + bit;
+                }
+                else
+                {
+                    root >>= 1;
+                }
+                bit >>= 2;
+            }
+            return FromRaw(static_cast<std::int32_t>(rem > root ? root + 1 : root));
+        }
+
+        // Radians; within 1/65536 of the exact value over the whole range
+        static constexpr Fixed Sin(Fixed angle) { return SinQuadrant(angle, 0); }
+        static constexpr Fixed Cos(Fixed angle) { return SinQuadrant(angle, 1); }
+
+    private:
+        static constexpr std::int32_t Wrap(std::int64_t value) { return static_cast<std::int32_t>(value); }
+
+        // Converting a double outside the target range is undefined, so
+        // round in double and only narrow once the value fits in 64 bits
+        static constexpr std::int32_t WrapDouble(double value)
+        {
+            constexpr double kInt64Limit = 9223372036854775808.0;   // 2^63
+            if (value != value)
+                return 0;
+            const double scaled = value * kOne + (value < 0.0 ? -0.5 : 0.5);
+            if (scaled >= kInt64Limit)
+                return std::numeric_limits<std::int32_t>::max();
+            if (scaled < -kInt64Limit)
+                return std::numeric_limits<std::int32_t>::min();
+            return Wrap(static_cast<std::int64_t>(scaled));
+        }
+
+        // sin(angle + quadrant * pi/2). The angle is reduced by pi/2 in Q32
+        // and the remainder r in [0, pi/2) evaluated as a Taylor series to
+        // r^11 in Q30, which is well inside Q16 rounding.
+        static constexpr Fixed SinQuadrant(Fixed angle, std::int64_t quadrant)
+        {
+            constexpr std::int64_t kHalfPiQ32 = 6746518852;   // pi/2 * 2^32
+            constexpr std::int64_t kOneQ30 = std::int64_t(1) << 30;
+
+            const std::int64_t x = static_cast<std::int64_t>(angle.raw) << kFractionBits;
+            std::int64_t k = x / kHalfPiQ32;
+            if (x - k * kHalfPiQ32 < 0)
+                --k;                                            // Floor, not truncate
+            std::int64_t r = (x - k * kHalfPiQ32) >> 2;         // [0, pi/2) in Q30
+            quadrant = (k + quadrant) & 3;
+            if (quadrant & 1)
+                r = (kHalfPiQ32 >> 2) - r;                      // cos(r) = sin(pi/2 - r)
+
+            // sin r = r (1 - r^2/(2*3) (1 - r^2/(4*5) (1 - ... (1 - r^2/(10*11)))))
+            const std::int64_t z = (r * r) >> 30;
+            std::int64_t t = kOneQ30;
+            for (std::int64_t n = 10; n >= 2; n -= 2)
+                t = kOneQ30 - ((z * t) >> 30) / (n * (n + 1));
+            const std::int64_t sine = (((r * t) >> 30) + (std::int64_t(1) << 13)) >> 14;
+            return FromRaw(static_cast<std::int32_t>(quadrant >= 2 ? -sine : sine));
+        }
+    };
+
+    inline std::ostream& operator<<(std::ostream& os, Fixed value)
+    {
+        return os << static_cast<double>(value);
+    }
+}
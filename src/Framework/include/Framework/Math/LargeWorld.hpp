@@ -0,0 +1,134 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <Framework/Math/BatchMath.hpp>
+#include <Framework/Math/Vector3.hpp>
+
+namespace Aurum
+{
+    // ---------------------------------------
+    // Sector Position: int64 cell + float offset
+    // ---------------------------------------
+    // An alternative to Vector3d for stored world positions: the integer
+    // sector never loses precision, and the float offset inside a 4 km
+    // sector resolves about 0.25 mm. 40 bytes (36 plus alignment padding)
+    // against Vector3d's 24, but the precision is the same everywhere
+    // instead of falling off with distance from zero, and offsets stay
+    // float for local math.
+    struct SectorPosition
+    {
+        static constexpr double kSectorSize = 4096.0; // Metres, power of two
+
+        std::int64_t sx = 0, sy = 0, sz = 0;
+        Vector3 offset;                               // Within [0, kSectorSize] after FromDouble / Move
+
+        static SectorPosition FromDouble(const Vector3d& p)
+        {
+            SectorPosition result;
+            result.sx = static_cast<std::int64_t>(std::floor(p.x / kSectorSize));
+            result.sy = static_cast<std::int64_t>(std::floor(p.y / kSectorSize));
+            result.sz = static_cast<std::int64_t>(std::floor(p.z / kSectorSize));
+            result.offset = Vector3(Vector3d(p.x - static_cast<double>(result.sx) * kSectorSize,
+                                             p.y - static_cast<double>(result.sy) * kSectorSize,
+                                             p.z - static_cast<double>(result.sz) * kSectorSize));
+            return result;
+        }
+
+        Vector3d ToDouble() const
+        {
+            return {static_cast<double>(sx) * kSectorSize + offset.x,
+                    static_cast<double>(sy) * kSectorSize + offset.y,
+                    static_cast<double>(sz) * kSectorSize + offset.z};
+        }
+
+        // Moves by a local delta and carries whole sectors out of the offset
+        void Move(const Vector3& delta)
+        {
+            offset += delta;
+            Carry(offset.x, sx);
+            Carry(offset.y, sy);
+            Carry(offset.z, sz);
+        }
+
+    private:
+        static void Carry(float& value, std::int64_t& sector)
+        {
+            const double sectors = std::floor(static_cast<double>(value) / kSectorSize);
+            if (sectors != 0.0)
+            {
+                sector += static_cast<std::int64_t>(sectors);
+                value = static_cast<float>(static_cast<double>(value) - sectors * kSectorSize);
+            }
+        }
+    };
+
+    // SoA streams of stored world positions, for the per-frame batch pass
+    struct ConstDouble3Stream
+    {
+        const double* x = nullptr;
+        const double* y = nullptr;
+        const double* z = nullptr;
+    };
+
+    struct ConstSectorStream
+    {
+        const std::int64_t* sx = nullptr;
+        const std::int64_t* sy = nullptr;
+        const std::int64_t* sz = nullptr;
+        ConstFloat3Stream offset;
+    };
+
+    // ---------------------------------------
+    // Floating Origin: camera-relative float coordinates
+    // ---------------------------------------
+    // World positions live in double (Vector3d) or SectorPosition; the GPU
+    // and the float math types only ever see positions relative to an
+    // origin near the camera, where float is precise. Once per frame:
+    //
+    //   if (origin.Update(cameraWorld))  // Re-centred this frame
+    //       ShiftFloatCaches(origin.GetLastShift());
+    //   origin.ToLocal(positions, renderPositions, count);
+    //
+    // The origin is snapped to the sector grid, so it is exact in both
+    // representations and re-centring moves it by whole sectors.
+    class FloatingOrigin
+    {
+    public:
+        // Re-centre when the camera is this far from the origin on any axis.
+        // The origin snaps to the nearest sector corner, so the camera ends
+        // within half a sector of it; smaller distances act as half a sector.
+        explicit FloatingOrigin(double rebaseDistance = SectorPosition::kSectorSize);
+
+        // True when the origin moved; GetLastShift() is old - new origin,
+        // the amount to add to float positions relative to the old one
+        bool Update(const Vector3d& camera);
+        bool Update(const SectorPosition& camera) { return Update(camera.ToDouble()); }
+
+        const Vector3d& GetOrigin() const { return origin_; }
+        const Vector3d& GetLastShift() const { return lastShift_; }
+        std::uint64_t GetRebaseCount() const { return rebaseCount_; }
+
+        Vector3 ToLocal(const Vector3d& world) const { return Vector3(world - origin_); }
+        Vector3 ToLocal(const SectorPosition& world) const
+        {
+            return Vector3(Vector3d(static_cast<double>(world.sx - sectorX_) * SectorPosition::kSectorSize + world.offset.x,
+                                    static_cast<double>(world.sy - sectorY_) * SectorPosition::kSectorSize + world.offset.y,
+                                    static_cast<double>(world.sz - sectorZ_) * SectorPosition::kSectorSize + world.offset.z));
+        }
+        Vector3d ToWorld(const Vector3& local) const { return origin_ + Vector3d(local); }
+
+        // Batch pass: out[i] = float(world[i] - origin)
+        void ToLocal(ConstDouble3Stream world, Float3Stream out, std::size_t count) const;
+        void ToLocal(ConstSectorStream world, Float3Stream out, std::size_t count) const;
+
+    private:
+        void SetOrigin(std::int64_t sx, std::int64_t sy, std::int64_t sz);
+
+        double rebaseDistance_;
+        Vector3d origin_;
+        Vector3d lastShift_;
+        std::int64_t sectorX_ = 0, sectorY_ = 0, sectorZ_ = 0;
+        std::uint64_t rebaseCount_ = 0;
+    };
+}
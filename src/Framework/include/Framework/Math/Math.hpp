@@ -3,12 +3,16 @@
 // Aurum Math Library - Unified Include
 // This header aggregates all math components for convenience.
 
+#include <Framework/Math/Fixed.hpp>
+#include <Framework/Math/Scalar.hpp>
 #include <Framework/Math/Vector2.hpp>
 #include <Framework/Math/Vector3.hpp>
 #include <Framework/Math/Vector4.hpp>
 #include <Framework/Math/Matrix4x4.hpp>
 #include <Framework/Math/Quaternion.hpp>
 #include <Framework/Math/Transform.hpp>
+#include <Framework/Math/BatchMath.hpp>
+#include <Framework/Math/LargeWorld.hpp>
 
 namespace Aurum
 {
@@ -1,72 +1,167 @@
 #pragma once
-#include <cstring>
 #include <cmath>
+#include <concepts>
 #include <sstream>
+#include <Framework/Math/Quaternion.hpp>
 #include <Framework/Math/Vector3.hpp>
 
 namespace Aurum
 {
-    struct Matrix4x4
+    template<MathScalarType T>
+    struct BasicMatrix4x4
     {
-        float m[4][4]; // Row-major
+        T m[4][4]; // Row-major
 
-        Matrix4x4() { SetIdentity(); }
+        // Skips the identity fill for results that are overwritten anyway
+        struct NoInit {};
+
+        BasicMatrix4x4() { SetIdentity(); }
+        explicit BasicMatrix4x4(NoInit) {}
+
+        template<MathScalarType U>
+        explicit BasicMatrix4x4(const BasicMatrix4x4<U>& other)
+        {
+            for (int i = 0; i < 4; ++i)
+                for (int j = 0; j < 4; ++j)
+                    m[i][j] = static_cast<T>(other.m[i][j]);
+        }
 
         void SetIdentity()
         {
-            std::memset(m, 0, sizeof(m));
-            m[0][0] = m[1][1] = m[2][2] = m[3][3] = 1.0f;
+            for (int i = 0; i < 4; ++i)
+                for (int j = 0; j < 4; ++j)
+                    m[i][j] = (i == j) ? T(1) : T(0);
         }
 
-        static Matrix4x4 Identity()
+        static BasicMatrix4x4 Identity()
         {
-            Matrix4x4 mat;
+            BasicMatrix4x4 mat;
             mat.SetIdentity();
             return mat;
         }
 
-        static Matrix4x4 Translation(const Vector3& v)
+        static BasicMatrix4x4 Translation(const BasicVector3<T>& v)
         {
-            Matrix4x4 mat = Identity();
+            BasicMatrix4x4 mat = Identity();
             mat.m[3][0] = v.x;
             mat.m[3][1] = v.y;
             mat.m[3][2] = v.z;
             return mat;
         }
 
-        static Matrix4x4 Scale(const Vector3& v)
+        static BasicMatrix4x4 Scale(const BasicVector3<T>& v)
         {
-            Matrix4x4 mat = Identity();
+            BasicMatrix4x4 mat = Identity();
             mat.m[0][0] = v.x;
             mat.m[1][1] = v.y;
             mat.m[2][2] = v.z;
             return mat;
         }
 
-        Matrix4x4 operator*(const Matrix4x4& other) const
+        // Unit quaternion to rotation, row-vector convention (v * R)
+        static BasicMatrix4x4 Rotation(const BasicQuaternion<T>& q)
         {
-            Matrix4x4 result;
-            for (int i = 0; i < 4; ++i)
+            return TRS(BasicVector3<T>(), q, BasicVector3<T>(T(1), T(1), T(1)));
+        }
+
+        // Scale * Rotation * Translation, written directly: the quaternion's
+        // rotation rows scaled in place and the translation as the last row,
+        // with no matrix products
+        static BasicMatrix4x4 TRS(const BasicVector3<T>& t, const BasicQuaternion<T>& q, const BasicVector3<T>& s)
+        {
+            T r[3][3];
+            RotationBasis(q, r);
+            const T scale[3] = {s.x, s.y, s.z};
+
+            BasicMatrix4x4 mat{NoInit{}};
+            for (int i = 0; i < 3; ++i)
             {
-                for (int j = 0; j < 4; ++j)
-                {
-                    result.m[i][j] = 0.0f;
-                    for (int k = 0; k < 4; ++k)
-                        result.m[i][j] += m[i][k] * other.m[k][j];
-                }
+                mat.m[i][0] = r[i][0] * scale[i];
+                mat.m[i][1] = r[i][1] * scale[i];
+                mat.m[i][2] = r[i][2] * scale[i];
+                mat.m[i][3] = T(0);
+            }
+            mat.m[3][0] = t.x; mat.m[3][1] = t.y; mat.m[3][2] = t.z; mat.m[3][3] = T(1);
+            return mat;
+        }
+
+        // Inverse of TRS(t, q, s): Translation^-1 * Rotation^T * Scale^-1.
+        // A zero scale axis maps to zero instead of infinity.
+        static BasicMatrix4x4 InverseTRS(const BasicVector3<T>& t, const BasicQuaternion<T>& q, const BasicVector3<T>& s)
+        {
+            T r[3][3];
+            RotationBasis(q, r);
+            const T inv[3] = {SafeReciprocal(s.x), SafeReciprocal(s.y), SafeReciprocal(s.z)};
+
+            BasicMatrix4x4 mat{NoInit{}};
+            for (int i = 0; i < 3; ++i)
+            {
+                for (int j = 0; j < 3; ++j)
+                    mat.m[i][j] = r[j][i] * inv[j];
+                mat.m[i][3] = T(0);
             }
+            for (int j = 0; j < 3; ++j)
+                mat.m[3][j] = -(t.x * mat.m[0][j] + t.y * mat.m[1][j] + t.z * mat.m[2][j]);
+            mat.m[3][3] = T(1);
+            return mat;
+        }
+
+        // Inverse-transpose of TRS's upper 3x3 (Scale^-1 * Rotation), for
+        // transforming normals; no translation
+        static BasicMatrix4x4 NormalTRS(const BasicQuaternion<T>& q, const BasicVector3<T>& s)
+        {
+            T r[3][3];
+            RotationBasis(q, r);
+            const T inv[3] = {SafeReciprocal(s.x), SafeReciprocal(s.y), SafeReciprocal(s.z)};
+
+            BasicMatrix4x4 mat{NoInit{}};
+            for (int i = 0; i < 3; ++i)
+            {
+                mat.m[i][0] = r[i][0] * inv[i];
+                mat.m[i][1] = r[i][1] * inv[i];
+                mat.m[i][2] = r[i][2] * inv[i];
+                mat.m[i][3] = T(0);
+            }
+            mat.m[3][0] = T(0); mat.m[3][1] = T(0); mat.m[3][2] = T(0); mat.m[3][3] = T(1);
+            return mat;
+        }
+
+        // Rotation rows of a unit quaternion (the transpose of the usual
+        // column-vector matrix, to match v * M)
+        static void RotationBasis(const BasicQuaternion<T>& q, T r[3][3])
+        {
+            const T x2 = q.x + q.x, y2 = q.y + q.y, z2 = q.z + q.z;
+            const T xx = q.x * x2, yy = q.y * y2, zz = q.z * z2;
+            const T xy = q.x * y2, xz = q.x * z2, yz = q.y * z2;
+            const T wx = q.w * x2, wy = q.w * y2, wz = q.w * z2;
+
+            r[0][0] = T(1) - (yy + zz); r[0][1] = xy + wz;          r[0][2] = xz - wy;
+            r[1][0] = xy - wz;          r[1][1] = T(1) - (xx + zz); r[1][2] = yz + wx;
+            r[2][0] = xz + wy;          r[2][1] = yz - wx;          r[2][2] = T(1) - (xx + yy);
+        }
+
+        // SIMD kernels for float, see Simd.hpp
+        BasicMatrix4x4 operator*(const BasicMatrix4x4& other) const
+        {
+            BasicMatrix4x4 result{NoInit{}};
+            MathKernels::MultiplyMatrix(&m[0][0], &other.m[0][0], &result.m[0][0]);
             return result;
         }
 
-        Vector3 TransformPoint(const Vector3& v) const
+        BasicVector3<T> TransformPoint(const BasicVector3<T>& v) const
         {
-            Vector3 r;
-            r.x = v.x*m[0][0] + v.y*m[1][0] + v.z*m[2][0] + m[3][0];
-            r.y = v.x*m[0][1] + v.y*m[1][1] + v.z*m[2][1] + m[3][1];
-            r.z = v.x*m[0][2] + v.y*m[1][2] + v.z*m[2][2] + m[3][2];
+            BasicVector3<T> r;
+            MathKernels::TransformPoint(&m[0][0], &v.x, &r.x);
             return r;
         }
 
+        BasicVector3<T> TransformDirection(const BasicVector3<T>& v) const
+        {
+            return {v.x * m[0][0] + v.y * m[1][0] + v.z * m[2][0],
+                    v.x * m[0][1] + v.y * m[1][1] + v.z * m[2][1],
+                    v.x * m[0][2] + v.y * m[1][2] + v.z * m[2][2]};
+        }
+
         std::string ToString() const
         {
             std::ostringstream ss;
@@ -79,5 +174,12 @@ namespace Aurum
             }
             return ss.str();
         }
+
+    private:
+        static T SafeReciprocal(T f) { return f != T(0) ? T(1) / f : T(0); }
     };
+
+    using Matrix4x4 = BasicMatrix4x4<float>;
+    using Matrix4x4d = BasicMatrix4x4<double>;
+    using FixedMatrix4x4 = BasicMatrix4x4<Fixed>;
 }
@@ -1,37 +1,46 @@
 #pragma once
 #include <cmath>
+#include <concepts>
+#include <Framework/Math/Simd.hpp>
 #include <Framework/Math/Vector3.hpp>
 
 namespace Aurum
 {
-    struct Quaternion
+    template<MathScalarType T>
+    struct BasicQuaternion
     {
-        float w, x, y, z;
+        T w, x, y, z;
 
-        Quaternion() : w(1), x(0), y(0), z(0) {}
-        Quaternion(float w, float x, float y, float z) : w(w), x(x), y(y), z(z) {}
+        BasicQuaternion() : w(1), x(0), y(0), z(0) {}
+        BasicQuaternion(T w, T x, T y, T z) : w(w), x(x), y(y), z(z) {}
 
-        static Quaternion FromAxisAngle(const Vector3& axis, float angleRad)
+        template<MathScalarType U>
+        explicit BasicQuaternion(const BasicQuaternion<U>& q)
+            : w(static_cast<T>(q.w)), x(static_cast<T>(q.x)), y(static_cast<T>(q.y)), z(static_cast<T>(q.z)) {}
+
+        static BasicQuaternion FromAxisAngle(const BasicVector3<T>& axis, T angleRad)
         {
-            float half = angleRad * 0.5f;
-            float s = std::sin(half);
-            return {std::cos(half), axis.x * s, axis.y * s, axis.z * s};
+            T half = angleRad * T(0.5);
+            T s = ScalarMath::Sin(half);
+            return {ScalarMath::Cos(half), axis.x * s, axis.y * s, axis.z * s};
         }
 
-        Quaternion Normalized() const
+        BasicQuaternion Normalized() const
         {
-            float len = std::sqrt(w*w + x*x + y*y + z*z);
+            T len = ScalarMath::Sqrt(w*w + x*x + y*y + z*z);
             return {w/len, x/len, y/len, z/len};
         }
 
-        static Quaternion Multiply(const Quaternion& a, const Quaternion& b)
+        static BasicQuaternion Multiply(const BasicQuaternion& a, const BasicQuaternion& b)
         {
-            return {
-                a.w*b.w - a.x*b.x - a.y*b.y - a.z*b.z,
-                a.w*b.x + a.x*b.w + a.y*b.z - a.z*b.y,
-                a.w*b.y - a.x*b.z + a.y*b.w + a.z*b.x,
-                a.w*b.z + a.x*b.y - a.y*b.x + a.z*b.w
-            };
+            BasicQuaternion result;
+            MathKernels::MultiplyQuaternion(&a.w, &b.w, &result.w);
+            return result;
         }
     };
+
+    using Quaternion = BasicQuaternion<float>;
+    using Quaterniond = BasicQuaternion<double>;
+    using FixedQuaternion = BasicQuaternion<Fixed>;
+    static_assert(sizeof(Quaternion) == 4 * sizeof(float), "SIMD kernels read Quaternion as float[4] (w, x, y, z)");
 }
@@ -0,0 +1,125 @@
+#pragma once
+#include <cfloat>
+#include <cmath>
+#include <concepts>
+#include <Framework/Math/Fixed.hpp>
+
+// ------------------------------------------------------------
+// Deterministic Math
+// ------------------------------------------------------------
+// AURUM_MATH_DETERMINISTIC=1 makes the float / double math types give the
+// same bits on every compiler and CPU, for lockstep simulation:
+//   - Sin / Cos go through the software versions below; C library results
+//     differ between vendors in the last bits
+//   - CMake turns FMA contraction off for everything linking the Framework
+// + - * / and sqrt are correctly rounded by IEEE 754, so hardware already
+// agrees on those, and the SIMD kernels match the scalar reference bit for
+// bit (Simd.hpp). Fixed is integer-only and deterministic in either mode.
+#if !defined(AURUM_MATH_DETERMINISTIC)
+    #define AURUM_MATH_DETERMINISTIC 0
+#endif
+
+#if AURUM_MATH_DETERMINISTIC
+static_assert(FLT_EVAL_METHOD == 0, "Deterministic math needs SSE2 / NEON float evaluation, not x87 extended precision");
+#endif
+
+namespace Aurum
+{
+    // Scalars the Basic* math types accept: float, double, or a class type
+    // with arithmetic, comparisons and static Sqrt / Sin / Cos (Fixed)
+    template<typename T>
+    concept MathScalarType = std::floating_point<T> || requires(T v) {
+        { T::Sqrt(v) } -> std::same_as<T>;
+        { T::Sin(v) } -> std::same_as<T>;
+        { T::Cos(v) } -> std::same_as<T>;
+    };
+
+    static_assert(MathScalarType<Fixed>);
+
+    // ---------------------------------------
+    // Software sin / cos
+    // ---------------------------------------
+    // Evaluated in double with a fixed sequence of IEEE operations: Cody-Waite
+    // reduction by pi/2 (exact for |x| up to ~1e6, still reproducible past
+    // it), then the fdlibm minimax polynomials on [-pi/4, pi/4]. About 1 ulp
+    // in double; float results are the double result rounded once.
+    namespace DeterministicMath
+    {
+        namespace Detail
+        {
+            // pi/2 in three 33-bit parts, so k * part is exact for |k| < 2^20
+            inline constexpr double kInvHalfPi = 6.36619772367581382433e-01;
+            inline constexpr double kHalfPi1 = 1.57079632673412561417e+00;
+            inline constexpr double kHalfPi2 = 6.07710050630396597660e-11;
+            inline constexpr double kHalfPi3 = 2.02226624871116645580e-21;
+
+            inline double SinPoly(double r)
+            {
+                const double z = r * r;
+                return r + r * z * (-1.66666666666666324348e-01 + z * (8.33333333332248946124e-03 +
+                       z * (-1.98412698298579493134e-04 + z * (2.75573137070700676789e-06 +
+                       z * (-2.50507602534068634195e-08 + z * 1.58969099521155010221e-10)))));
+            }
+
+            inline double CosPoly(double r)
+            {
+                const double z = r * r;
+                return (1.0 - 0.5 * z) + z * z * (4.16666666666666019037e-02 + z * (-1.38888888888741095749e-03 +
+                       z * (2.48015872894767294178e-05 + z * (-2.75573143513906633035e-07 +
+                       z * (2.08757232129817482790e-09 + z * -1.13596475577881948265e-11)))));
+            }
+
+            // sin(x + quadrant * pi/2)
+            inline double SinQuadrant(double x, int quadrant)
+            {
+                if (!std::isfinite(x))
+                    return x - x;
+
+                const double k = std::floor(x * kInvHalfPi + 0.5);
+                const double r = ((x - k * kHalfPi1) - k * kHalfPi2) - k * kHalfPi3;
+                quadrant = (static_cast<int>(k - 4.0 * std::floor(k * 0.25)) + quadrant) & 3;
+                switch (quadrant)
+                {
+                    case 0:  return SinPoly(r);
+                    case 1:  return CosPoly(r);
+                    case 2:  return -SinPoly(r);
+                    default: return -CosPoly(r);
+                }
+            }
+        }
+
+        inline double Sin(double x) { return Detail::SinQuadrant(x, 0); }
+        inline double Cos(double x) { return Detail::SinQuadrant(x, 1); }
+        inline float Sin(float x) { return static_cast<float>(Detail::SinQuadrant(x, 0)); }
+        inline float Cos(float x) { return static_cast<float>(Detail::SinQuadrant(x, 1)); }
+    }
+
+    // ---------------------------------------
+    // Scalar functions the math types call
+    // ---------------------------------------
+    namespace ScalarMath
+    {
+        template<MathScalarType T>
+        inline T Sqrt(T v)
+        {
+            if constexpr (std::floating_point<T>) return std::sqrt(v);
+            else return T::Sqrt(v);
+        }
+
+        template<MathScalarType T>
+        inline T Sin(T v)
+        {
+            if constexpr (!std::floating_point<T>) return T::Sin(v);
+            else if constexpr (AURUM_MATH_DETERMINISTIC) return static_cast<T>(DeterministicMath::Sin(static_cast<double>(v)));
+            else return std::sin(v);
+        }
+
+        template<MathScalarType T>
+        inline T Cos(T v)
+        {
+            if constexpr (!std::floating_point<T>) return T::Cos(v);
+            else if constexpr (AURUM_MATH_DETERMINISTIC) return static_cast<T>(DeterministicMath::Cos(static_cast<double>(v)));
+            else return std::cos(v);
+        }
+    }
+}
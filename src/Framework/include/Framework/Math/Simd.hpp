@@ -0,0 +1,384 @@
+#pragma once
+#include <cmath>
+#include <type_traits>
+#include <Framework/Math/Scalar.hpp>
+
+// ------------------------------------------------------------
+// SIMD Dispatch
+// ------------------------------------------------------------
+// Picked at compile time from the target the compiler builds for:
+//   AVX2  (-mavx2, /arch:AVX2)      matrix multiply two rows per op
+//   SSE   (any x86-64; SSE2 only)   everything else on x86
+//   NEON  (AArch64)
+//   Scalar reference (anything else, or AURUM_MATH_SCALAR=1)
+//
+// Every path performs the same IEEE operations in the same order as the
+// scalar reference (no FMA, no reciprocal estimates), so results match it
+// bit for bit as long as the compiler does not contract a*b+c on its own
+// (-ffp-contract=off when building with FMA enabled).
+#if !defined(AURUM_MATH_SCALAR)
+    #define AURUM_MATH_SCALAR 0
+#endif
+
+#if !AURUM_MATH_SCALAR && (defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #define AURUM_SIMD_SSE 1
+    #include <immintrin.h>
+    #if defined(__AVX2__)
+        #define AURUM_SIMD_AVX2 1
+    #endif
+#elif !AURUM_MATH_SCALAR && (defined(__aarch64__) || defined(_M_ARM64))
+    #define AURUM_SIMD_NEON 1
+    #include <arm_neon.h>
+#endif
+
+#ifndef AURUM_SIMD_SSE
+    #define AURUM_SIMD_SSE 0
+#endif
+#ifndef AURUM_SIMD_AVX2
+    #define AURUM_SIMD_AVX2 0
+#endif
+#ifndef AURUM_SIMD_NEON
+    #define AURUM_SIMD_NEON 0
+#endif
+
+namespace Aurum
+{
+    // ---------------------------------------
+    // Scalar reference kernels
+    // ---------------------------------------
+    // Matrices are row-major T[16] used with row vectors (v * M).
+    // Vectors are T[3] / T[4]; quaternions are (w, x, y, z). Templated so
+    // double-precision types share them; float is what the SIMD paths match.
+    namespace MathScalar
+    {
+        template<typename T>
+        inline void MultiplyMatrix(const T* a, const T* b, T* out)
+        {
+            for (int i = 0; i < 4; ++i)
+            {
+                const T* row = a + 4 * i;
+                for (int j = 0; j < 4; ++j)
+                    out[4 * i + j] = row[0] * b[j] + row[1] * b[4 + j] + row[2] * b[8 + j] + row[3] * b[12 + j];
+            }
+        }
+
+        template<typename T>
+        inline void TransformPoint(const T* m, const T* v, T* out)
+        {
+            for (int j = 0; j < 3; ++j)
+                out[j] = v[0] * m[j] + v[1] * m[4 + j] + v[2] * m[8 + j] + m[12 + j];
+        }
+
+        template<typename T>
+        inline T Dot3(const T* a, const T* b) { return a[0] * b[0] + a[1] * b[1] + a[2] * b[2]; }
+        template<typename T>
+        inline T Dot4(const T* a, const T* b) { return a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3]; }
+
+        template<typename T>
+        inline void Cross(const T* a, const T* b, T* out)
+        {
+            out[0] = a[1] * b[2] - a[2] * b[1];
+            out[1] = a[2] * b[0] - a[0] * b[2];
+            out[2] = a[0] * b[1] - a[1] * b[0];
+        }
+
+        // Leaves near-zero vectors untouched; returns false for them
+        template<typename T>
+        inline bool Normalize3(const T* v, T* out)
+        {
+            const T length = ScalarMath::Sqrt(Dot3(v, v));
+            if (length <= T(1e-6))
+                return false;
+            out[0] = v[0] / length;
+            out[1] = v[1] / length;
+            out[2] = v[2] / length;
+            return true;
+        }
+
+        template<typename T>
+        inline void MultiplyQuaternion(const T* a, const T* b, T* out)
+        {
+            const T w = a[0] * b[0] - a[1] * b[1] - a[2] * b[2] - a[3] * b[3];
+            const T x = a[0] * b[1] + a[1] * b[0] + a[2] * b[3] - a[3] * b[2];
+            const T y = a[0] * b[2] - a[1] * b[3] + a[2] * b[0] + a[3] * b[1];
+            const T z = a[0] * b[3] + a[1] * b[2] - a[2] * b[1] + a[3] * b[0];
+            out[0] = w; out[1] = x; out[2] = y; out[3] = z;
+        }
+    }
+
+    // ---------------------------------------
+    // Dispatched kernels (same signatures)
+    // ---------------------------------------
+    namespace MathSimd
+    {
+        constexpr const char* GetBackendName()
+        {
+            return AURUM_SIMD_AVX2 ? "AVX2" : AURUM_SIMD_SSE ? "SSE" : AURUM_SIMD_NEON ? "NEON" : "Scalar";
+        }
+
+#if AURUM_SIMD_SSE
+        // 12-byte load/store without touching memory past the vector
+        inline __m128 Load3(const float* v)
+        {
+            const __m128 xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(v)));
+            return _mm_movelh_ps(xy, _mm_load_ss(v + 2));
+        }
+
+        inline void Store3(float* out, __m128 v)
+        {
+            _mm_store_sd(reinterpret_cast<double*>(out), _mm_castps_pd(v));
+            _mm_store_ss(out + 2, _mm_movehl_ps(v, v));
+        }
+
+        #define AURUM_SSE_SPLAT(v, i) _mm_shuffle_ps((v), (v), _MM_SHUFFLE(i, i, i, i))
+
+        inline void MultiplyMatrix(const float* a, const float* b, float* out)
+        {
+    #if AURUM_SIMD_AVX2
+            // Rows of b repeated in both halves; two output rows per step
+            const __m256 b0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b));
+            const __m256 b1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 4));
+            const __m256 b2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 8));
+            const __m256 b3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 12));
+            for (int i = 0; i < 4; i += 2)
+            {
+                const __m256 rows = _mm256_loadu_ps(a + 4 * i);
+                __m256 r = _mm256_mul_ps(_mm256_permute_ps(rows, _MM_SHUFFLE(0, 0, 0, 0)), b0);
+                r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_permute_ps(rows, _MM_SHUFFLE(1, 1, 1, 1)), b1));
+                r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_permute_ps(rows, _MM_SHUFFLE(2, 2, 2, 2)), b2));
+                r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_permute_ps(rows, _MM_SHUFFLE(3, 3, 3, 3)), b3));
+                _mm256_storeu_ps(out + 4 * i, r);
+            }
+    #else
+            const __m128 b0 = _mm_loadu_ps(b);
+            const __m128 b1 = _mm_loadu_ps(b + 4);
+            const __m128 b2 = _mm_loadu_ps(b + 8);
+            const __m128 b3 = _mm_loadu_ps(b + 12);
+            for (int i = 0; i < 4; ++i)
+            {
+                const __m128 row = _mm_loadu_ps(a + 4 * i);
+                __m128 r = _mm_mul_ps(AURUM_SSE_SPLAT(row, 0), b0);
+                r = _mm_add_ps(r, _mm_mul_ps(AURUM_SSE_SPLAT(row, 1), b1));
+                r = _mm_add_ps(r, _mm_mul_ps(AURUM_SSE_SPLAT(row, 2), b2));
+                r = _mm_add_ps(r, _mm_mul_ps(AURUM_SSE_SPLAT(row, 3), b3));
+                _mm_storeu_ps(out + 4 * i, r);
+            }
+    #endif
+        }
+
+        inline void TransformPoint(const float* m, const float* v, float* out)
+        {
+            __m128 r = _mm_mul_ps(_mm_set1_ps(v[0]), _mm_loadu_ps(m));
+            r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(v[1]), _mm_loadu_ps(m + 4)));
+            r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(v[2]), _mm_loadu_ps(m + 8)));
+            r = _mm_add_ps(r, _mm_loadu_ps(m + 12));
+            Store3(out, r);
+        }
+
+        inline float Dot3(const float* a, const float* b)
+        {
+            const __m128 p = _mm_mul_ps(Load3(a), Load3(b));
+            const __m128 xy = _mm_add_ss(p, AURUM_SSE_SPLAT(p, 1));
+            return _mm_cvtss_f32(_mm_add_ss(xy, _mm_movehl_ps(p, p)));
+        }
+
+        inline float Dot4(const float* a, const float* b)
+        {
+            const __m128 p = _mm_mul_ps(_mm_loadu_ps(a), _mm_loadu_ps(b));
+            __m128 s = _mm_add_ss(p, AURUM_SSE_SPLAT(p, 1));
+            s = _mm_add_ss(s, _mm_movehl_ps(p, p));
+            return _mm_cvtss_f32(_mm_add_ss(s, AURUM_SSE_SPLAT(p, 3)));
+        }
+
+        inline void Cross(const float* a, const float* b, float* out)
+        {
+            const __m128 va = Load3(a);
+            const __m128 vb = Load3(b);
+            const __m128 aYZX = _mm_shuffle_ps(va, va, _MM_SHUFFLE(3, 0, 2, 1));
+            const __m128 bZXY = _mm_shuffle_ps(vb, vb, _MM_SHUFFLE(3, 1, 0, 2));
+            const __m128 aZXY = _mm_shuffle_ps(va, va, _MM_SHUFFLE(3, 1, 0, 2));
+            const __m128 bYZX = _mm_shuffle_ps(vb, vb, _MM_SHUFFLE(3, 0, 2, 1));
+            Store3(out, _mm_sub_ps(_mm_mul_ps(aYZX, bZXY), _mm_mul_ps(aZXY, bYZX)));
+        }
+
+        inline bool Normalize3(const float* v, float* out)
+        {
+            const __m128 vec = Load3(v);
+            const __m128 p = _mm_mul_ps(vec, vec);
+            const __m128 sum = _mm_add_ss(_mm_add_ss(p, AURUM_SSE_SPLAT(p, 1)), _mm_movehl_ps(p, p));
+            const __m128 length = _mm_sqrt_ss(sum);
+            if (_mm_cvtss_f32(length) <= 1e-6f)
+                return false;
+            Store3(out, _mm_div_ps(vec, AURUM_SSE_SPLAT(length, 0)));
+            return true;
+        }
+
+        inline void MultiplyQuaternion(const float* a, const float* b, float* out)
+        {
+            // Lanes are (w, x, y, z); subtractions become sign flips, which are exact
+            const __m128 qa = _mm_loadu_ps(a);
+            const __m128 qb = _mm_loadu_ps(b);
+            const __m128 signX = _mm_castsi128_ps(_mm_set_epi32(0, static_cast<int>(0x80000000), 0, static_cast<int>(0x80000000)));
+            const __m128 signY = _mm_castsi128_ps(_mm_set_epi32(static_cast<int>(0x80000000), 0, 0, static_cast<int>(0x80000000)));
+            const __m128 signZ = _mm_castsi128_ps(_mm_set_epi32(0, 0, static_cast<int>(0x80000000), static_cast<int>(0x80000000)));
+
+            __m128 r = _mm_mul_ps(AURUM_SSE_SPLAT(qa, 0), qb);
+            r = _mm_add_ps(r, _mm_xor_ps(_mm_mul_ps(AURUM_SSE_SPLAT(qa, 1), _mm_shuffle_ps(qb, qb, _MM_SHUFFLE(2, 3, 0, 1))), signX));
+            r = _mm_add_ps(r, _mm_xor_ps(_mm_mul_ps(AURUM_SSE_SPLAT(qa, 2), _mm_shuffle_ps(qb, qb, _MM_SHUFFLE(1, 0, 3, 2))), signY));
+            r = _mm_add_ps(r, _mm_xor_ps(_mm_mul_ps(AURUM_SSE_SPLAT(qa, 3), _mm_shuffle_ps(qb, qb, _MM_SHUFFLE(0, 1, 2, 3))), signZ));
+            _mm_storeu_ps(out, r);
+        }
+
+        #undef AURUM_SSE_SPLAT
+#elif AURUM_SIMD_NEON
+        inline float32x4_t Load3(const float* v)
+        {
+            return vcombine_f32(vld1_f32(v), vld1_lane_f32(v + 2, vdup_n_f32(0.0f), 0));
+        }
+
+        inline void Store3(float* out, float32x4_t v)
+        {
+            vst1_f32(out, vget_low_f32(v));
+            vst1q_lane_f32(out + 2, v, 2);
+        }
+
+        inline void MultiplyMatrix(const float* a, const float* b, float* out)
+        {
+            const float32x4_t b0 = vld1q_f32(b);
+            const float32x4_t b1 = vld1q_f32(b + 4);
+            const float32x4_t b2 = vld1q_f32(b + 8);
+            const float32x4_t b3 = vld1q_f32(b + 12);
+            for (int i = 0; i < 4; ++i)
+            {
+                const float* row = a + 4 * i;
+                float32x4_t r = vmulq_n_f32(b0, row[0]);
+                r = vaddq_f32(r, vmulq_n_f32(b1, row[1]));
+                r = vaddq_f32(r, vmulq_n_f32(b2, row[2]));
+                r = vaddq_f32(r, vmulq_n_f32(b3, row[3]));
+                vst1q_f32(out + 4 * i, r);
+            }
+        }
+
+        inline void TransformPoint(const float* m, const float* v, float* out)
+        {
+            float32x4_t r = vmulq_n_f32(vld1q_f32(m), v[0]);
+            r = vaddq_f32(r, vmulq_n_f32(vld1q_f32(m + 4), v[1]));
+            r = vaddq_f32(r, vmulq_n_f32(vld1q_f32(m + 8), v[2]));
+            r = vaddq_f32(r, vld1q_f32(m + 12));
+            Store3(out, r);
+        }
+
+        inline float Dot3(const float* a, const float* b)
+        {
+            const float32x4_t p = vmulq_f32(Load3(a), Load3(b));
+            return (vgetq_lane_f32(p, 0) + vgetq_lane_f32(p, 1)) + vgetq_lane_f32(p, 2);
+        }
+
+        inline float Dot4(const float* a, const float* b)
+        {
+            const float32x4_t p = vmulq_f32(vld1q_f32(a), vld1q_f32(b));
+            return ((vgetq_lane_f32(p, 0) + vgetq_lane_f32(p, 1)) + vgetq_lane_f32(p, 2)) + vgetq_lane_f32(p, 3);
+        }
+
+        inline void Cross(const float* a, const float* b, float* out)
+        {
+            // Three lanes are too short to beat the scalar shuffles here
+            MathScalar::Cross(a, b, out);
+        }
+
+        inline bool Normalize3(const float* v, float* out)
+        {
+            const float length = std::sqrt(Dot3(v, v));
+            if (length <= 1e-6f)
+                return false;
+            Store3(out, vdivq_f32(Load3(v), vdupq_n_f32(length)));
+            return true;
+        }
+
+        inline void MultiplyQuaternion(const float* a, const float* b, float* out)
+        {
+            const float32x4_t qb = vld1q_f32(b);
+            const float32x4_t bXWZY = vrev64q_f32(qb);                                   // (x, w, z, y)
+            const float32x4_t bYZWX = vextq_f32(qb, qb, 2);                              // (y, z, w, x)
+            const float32x4_t bZYXW = vrev64q_f32(bYZWX);                                // (z, y, x, w)
+            const float32x4_t signX = { -1.0f, 1.0f, -1.0f, 1.0f };
+            const float32x4_t signY = { -1.0f, 1.0f, 1.0f, -1.0f };
+            const float32x4_t signZ = { -1.0f, -1.0f, 1.0f, 1.0f };
+
+            float32x4_t r = vmulq_n_f32(qb, a[0]);
+            r = vaddq_f32(r, vmulq_f32(vmulq_n_f32(bXWZY, a[1]), signX));
+            r = vaddq_f32(r, vmulq_f32(vmulq_n_f32(bYZWX, a[2]), signY));
+            r = vaddq_f32(r, vmulq_f32(vmulq_n_f32(bZYXW, a[3]), signZ));
+            vst1q_f32(out, r);
+        }
+#else
+        using MathScalar::MultiplyMatrix;
+        using MathScalar::TransformPoint;
+        using MathScalar::Dot3;
+        using MathScalar::Dot4;
+        using MathScalar::Cross;
+        using MathScalar::Normalize3;
+        using MathScalar::MultiplyQuaternion;
+#endif
+    }
+
+    // ---------------------------------------
+    // Scalar-generic entry points
+    // ---------------------------------------
+    // What the Basic* math types call: float takes the MathSimd kernels,
+    // double the scalar reference.
+    namespace MathKernels
+    {
+        template<typename T>
+        inline constexpr bool kUseSimd = std::is_same_v<T, float>;
+
+        template<typename T>
+        inline void MultiplyMatrix(const T* a, const T* b, T* out)
+        {
+            if constexpr (kUseSimd<T>) MathSimd::MultiplyMatrix(a, b, out);
+            else MathScalar::MultiplyMatrix(a, b, out);
+        }
+
+        template<typename T>
+        inline void TransformPoint(const T* m, const T* v, T* out)
+        {
+            if constexpr (kUseSimd<T>) MathSimd::TransformPoint(m, v, out);
+            else MathScalar::TransformPoint(m, v, out);
+        }
+
+        template<typename T>
+        inline T Dot3(const T* a, const T* b)
+        {
+            if constexpr (kUseSimd<T>) return MathSimd::Dot3(a, b);
+            else return MathScalar::Dot3(a, b);
+        }
+
+        template<typename T>
+        inline T Dot4(const T* a, const T* b)
+        {
+            if constexpr (kUseSimd<T>) return MathSimd::Dot4(a, b);
+            else return MathScalar::Dot4(a, b);
+        }
+
+        template<typename T>
+        inline void Cross(const T* a, const T* b, T* out)
+        {
+            if constexpr (kUseSimd<T>) MathSimd::Cross(a, b, out);
+            else MathScalar::Cross(a, b, out);
+        }
+
+        template<typename T>
+        inline bool Normalize3(const T* v, T* out)
+        {
+            if constexpr (kUseSimd<T>) return MathSimd::Normalize3(v, out);
+            else return MathScalar::Normalize3(v, out);
+        }
+
+        template<typename T>
+        inline void MultiplyQuaternion(const T* a, const T* b, T* out)
+        {
+            if constexpr (kUseSimd<T>) MathSimd::MultiplyQuaternion(a, b, out);
+            else MathScalar::MultiplyQuaternion(a, b, out);
+        }
+    }
+}
@@ -1,26 +1,180 @@
 #pragma once
+#include <concepts>
+#include <cstdint>
 #include <Framework/Math/Vector3.hpp>
 #include <Framework/Math/Quaternion.hpp>
 #include <Framework/Math/Matrix4x4.hpp>
 
 namespace Aurum
 {
-    struct Transform
+    template<MathScalarType T>
+    struct BasicTransform
     {
-        Vector3 position;
-        Quaternion rotation;
-        Vector3 scale;
+        using Vector3Type = BasicVector3<T>;
+        using QuaternionType = BasicQuaternion<T>;
+        using Matrix4x4Type = BasicMatrix4x4<T>;
 
-        Transform()
-            : position(0, 0, 0), rotation(), scale(1, 1, 1) {}
+        Vector3Type position;
+        QuaternionType rotation;   // Unit length
+        Vector3Type scale;
 
-        Matrix4x4 ToMatrix() const
+        BasicTransform()
+            : position(), rotation(), scale(T(1), T(1), T(1)) {}
+
+        BasicTransform(const Vector3Type& position, const QuaternionType& rotation, const Vector3Type& scale)
+            : position(position), rotation(rotation), scale(scale) {}
+
+        template<MathScalarType U>
+        explicit BasicTransform(const BasicTransform<U>& other)
+            : position(other.position), rotation(other.rotation), scale(other.scale) {}
+
+        // Scale, then rotate, then translate (v * M)
+        Matrix4x4Type ToMatrix() const { return Matrix4x4Type::TRS(position, rotation, scale); }
+        Matrix4x4Type ToInverseMatrix() const { return Matrix4x4Type::InverseTRS(position, rotation, scale); }
+
+        // Inverse-transpose, for normals (use with TransformDirection)
+        Matrix4x4Type ToNormalMatrix() const { return Matrix4x4Type::NormalTRS(rotation, scale); }
+
+        bool operator==(const BasicTransform& other) const
+        {
+            return position.x == other.position.x && position.y == other.position.y && position.z == other.position.z &&
+                   rotation.w == other.rotation.w && rotation.x == other.rotation.x &&
+                   rotation.y == other.rotation.y && rotation.z == other.rotation.z &&
+                   scale.x == other.scale.x && scale.y == other.scale.y && scale.z == other.scale.z;
+        }
+        bool operator!=(const BasicTransform& other) const { return !(*this == other); }
+    };
+
+    using Transform = BasicTransform<float>;
+    using Transformd = BasicTransform<double>;
+    using FixedTransform = BasicTransform<Fixed>;
+
+    // ---------------------------------------
+    // Cached Transform: matrices rebuilt only when dirty
+    // ---------------------------------------
+    // Setters mark the cached matrices dirty (a no-op when the value does
+    // not change); each getter rebuilds at most once per change. With a
+    // parent set, GetWorldMatrix() is local * parent world and is rebuilt
+    // only when this transform or one of its ancestors changed, tracked by
+    // a per-node world version rather than by walking children.
+    //
+    // Getters update mutable caches: not safe to call concurrently on the
+    // same instance (or on instances sharing an ancestor) without a lock.
+    template<MathScalarType T>
+    class BasicCachedTransform
+    {
+    public:
+        using TransformType = BasicTransform<T>;
+        using Matrix4x4Type = BasicMatrix4x4<T>;
+
+        BasicCachedTransform() = default;
+        explicit BasicCachedTransform(const TransformType& transform) : local_(transform) {}
+
+        const TransformType& GetLocal() const { return local_; }
+        const BasicVector3<T>& GetPosition() const { return local_.position; }
+        const BasicQuaternion<T>& GetRotation() const { return local_.rotation; }
+        const BasicVector3<T>& GetScale() const { return local_.scale; }
+
+        void SetLocal(const TransformType& transform)
+        {
+            if (transform != local_)
+            {
+                local_ = transform;
+                MarkDirty();
+            }
+        }
+        void SetPosition(const BasicVector3<T>& position) { SetLocal({position, local_.rotation, local_.scale}); }
+        void SetRotation(const BasicQuaternion<T>& rotation) { SetLocal({local_.position, rotation, local_.scale}); }
+        void SetScale(const BasicVector3<T>& scale) { SetLocal({local_.position, local_.rotation, scale}); }
+
+        // The parent must outlive this transform (or be reset first)
+        void SetParent(const BasicCachedTransform* parent)
+        {
+            if (parent != parent_)
+            {
+                parent_ = parent;
+                dirty_ |= kWorldDirty;
+                ++worldVersion_;
+            }
+        }
+        const BasicCachedTransform* GetParent() const { return parent_; }
+
+        const Matrix4x4Type& GetMatrix() const
+        {
+            if (dirty_ & kMatrixDirty)
+            {
+                matrix_ = local_.ToMatrix();
+                dirty_ &= ~kMatrixDirty;
+            }
+            return matrix_;
+        }
+
+        const Matrix4x4Type& GetInverseMatrix() const
+        {
+            if (dirty_ & kInverseDirty)
+            {
+                inverse_ = local_.ToInverseMatrix();
+                dirty_ &= ~kInverseDirty;
+            }
+            return inverse_;
+        }
+
+        const Matrix4x4Type& GetNormalMatrix() const
         {
-            Matrix4x4 T = Matrix4x4::Translation(position);
-            Matrix4x4 S = Matrix4x4::Scale(scale);
-            // Rotation matrix from quaternion simplified placeholder (expand later)
-            Matrix4x4 R = Matrix4x4::Identity();
-            return S * R * T;
+            if (dirty_ & kNormalDirty)
+            {
+                normal_ = local_.ToNormalMatrix();
+                dirty_ &= ~kNormalDirty;
+            }
+            return normal_;
         }
+
+        const Matrix4x4Type& GetWorldMatrix() const
+        {
+            if (!parent_)
+                return GetMatrix();
+
+            const Matrix4x4Type& parentWorld = parent_->GetWorldMatrix();
+            if ((dirty_ & kWorldDirty) || parentVersion_ != parent_->worldVersion_)
+            {
+                world_ = GetMatrix() * parentWorld;
+                parentVersion_ = parent_->worldVersion_;
+                dirty_ &= ~kWorldDirty;
+                ++worldVersion_;
+            }
+            return world_;
+        }
+
+        // Changes whenever the world matrix may have changed; lets dependents
+        // (children, GPU constant uploads) skip unchanged transforms
+        std::uint32_t GetWorldVersion() const { return worldVersion_; }
+
+    private:
+        static constexpr std::uint8_t kMatrixDirty = 1 << 0;
+        static constexpr std::uint8_t kInverseDirty = 1 << 1;
+        static constexpr std::uint8_t kNormalDirty = 1 << 2;
+        static constexpr std::uint8_t kWorldDirty = 1 << 3;
+        static constexpr std::uint8_t kAllDirty = kMatrixDirty | kInverseDirty | kNormalDirty | kWorldDirty;
+
+        void MarkDirty()
+        {
+            dirty_ = kAllDirty;
+            ++worldVersion_;
+        }
+
+        TransformType local_;
+        const BasicCachedTransform* parent_ = nullptr;
+
+        mutable Matrix4x4Type matrix_{typename Matrix4x4Type::NoInit{}};
+        mutable Matrix4x4Type inverse_{typename Matrix4x4Type::NoInit{}};
+        mutable Matrix4x4Type normal_{typename Matrix4x4Type::NoInit{}};
+        mutable Matrix4x4Type world_{typename Matrix4x4Type::NoInit{}};
+        mutable std::uint32_t worldVersion_ = 0;
+        mutable std::uint32_t parentVersion_ = 0;
+        mutable std::uint8_t dirty_ = kAllDirty;
     };
+
+    using CachedTransform = BasicCachedTransform<float>;
+    using CachedTransformd = BasicCachedTransform<double>;
+    using FixedCachedTransform = BasicCachedTransform<Fixed>;
 }
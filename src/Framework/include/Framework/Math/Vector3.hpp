@@ -1,57 +1,62 @@
 #pragma once
 #include <cmath>
+#include <concepts>
 #include <string>
 #include <sstream>
+#include <Framework/Math/Simd.hpp>
 
 namespace Aurum
 {
-    struct Vector3
+    // float (Vector3) for rendering and gameplay; double (Vector3d) for
+    // large-world positions; Fixed (FixedVector3) for lockstep simulation.
+    // Converting between them is explicit.
+    template<MathScalarType T>
+    struct BasicVector3
     {
-        float x, y, z;
+        T x, y, z;
 
-        Vector3() : x(0), y(0), z(0) {}
-        Vector3(float x, float y, float z) : x(x), y(y), z(z) {}
+        BasicVector3() : x(0), y(0), z(0) {}
+        BasicVector3(T x, T y, T z) : x(x), y(y), z(z) {}
+
+        template<MathScalarType U>
+        explicit BasicVector3(const BasicVector3<U>& v)
+            : x(static_cast<T>(v.x)), y(static_cast<T>(v.y)), z(static_cast<T>(v.z)) {}
 
         // Basic arithmetic
-        Vector3 operator+(const Vector3& other) const { return {x + other.x, y + other.y, z + other.z}; }
-        Vector3 operator-(const Vector3& other) const { return {x - other.x, y - other.y, z - other.z}; }
-        Vector3 operator*(float scalar) const { return {x * scalar, y * scalar, z * scalar}; }
-        Vector3 operator/(float scalar) const { return {x / scalar, y / scalar, z / scalar}; }
+        BasicVector3 operator+(const BasicVector3& other) const { return {x + other.x, y + other.y, z + other.z}; }
+        BasicVector3 operator-(const BasicVector3& other) const { return {x - other.x, y - other.y, z - other.z}; }
+        BasicVector3 operator*(T scalar) const { return {x * scalar, y * scalar, z * scalar}; }
+        BasicVector3 operator/(T scalar) const { return {x / scalar, y / scalar, z / scalar}; }
 
-        Vector3& operator+=(const Vector3& v) { x += v.x; y += v.y; z += v.z; return *this; }
-        Vector3& operator-=(const Vector3& v) { x -= v.x; y -= v.y; z -= v.z; return *this; }
+        BasicVector3& operator+=(const BasicVector3& v) { x += v.x; y += v.y; z += v.z; return *this; }
+        BasicVector3& operator-=(const BasicVector3& v) { x -= v.x; y -= v.y; z -= v.z; return *this; }
 
-        // Vector operations
-        float Length() const { return std::sqrt(x*x + y*y + z*z); }
-        float LengthSq() const { return x*x + y*y + z*z; }
+        // Vector operations (SIMD kernels for float, see Simd.hpp)
+        T Length() const { return ScalarMath::Sqrt(LengthSq()); }
+        T LengthSq() const { return Dot(*this, *this); }
 
         void Normalize()
         {
-            float len = Length();
-            if (len > 1e-6f)
-            {
-                x /= len; y /= len; z /= len;
-            }
+            MathKernels::Normalize3(&x, &x);
         }
 
-        Vector3 Normalized() const
+        BasicVector3 Normalized() const
         {
-            float len = Length();
-            return (len > 1e-6f) ? Vector3(x/len, y/len, z/len) : Vector3();
+            BasicVector3 result;
+            MathKernels::Normalize3(&x, &result.x);
+            return result;
         }
 
-        static float Dot(const Vector3& a, const Vector3& b)
+        static T Dot(const BasicVector3& a, const BasicVector3& b)
         {
-            return a.x*b.x + a.y*b.y + a.z*b.z;
+            return MathKernels::Dot3(&a.x, &b.x);
         }
 
-        static Vector3 Cross(const Vector3& a, const Vector3& b)
+        static BasicVector3 Cross(const BasicVector3& a, const BasicVector3& b)
         {
-            return {
-                a.y*b.z - a.z*b.y,
-                a.z*b.x - a.x*b.z,
-                a.x*b.y - a.y*b.x
-            };
+            BasicVector3 result;
+            MathKernels::Cross(&a.x, &b.x, &result.x);
+            return result;
         }
 
         std::string ToString() const
@@ -61,4 +66,10 @@ namespace Aurum
             return ss.str();
         }
     };
+
+    using Vector3 = BasicVector3<float>;
+    using Vector3d = BasicVector3<double>;
+    using FixedVector3 = BasicVector3<Fixed>;
+    static_assert(sizeof(Vector3) == 3 * sizeof(float), "SIMD kernels read Vector3 as float[3]");
+    static_assert(sizeof(Vector3d) == 3 * sizeof(double), "Kernels read Vector3d as double[3]");
 }
@@ -2,6 +2,7 @@
 #include <cmath>
 #include <string>
 #include <sstream>
+#include <Framework/Math/Simd.hpp>
 
 namespace Aurum
 {
@@ -18,7 +19,7 @@ namespace Aurum
 
         static float Dot(const Vector4& a, const Vector4& b)
         {
-            return a.x*b.x + a.y*b.y + a.z*b.z + a.w*b.w;
+            return MathSimd::Dot4(&a.x, &b.x);
         }
 
         std::string ToString() const
@@ -28,4 +29,5 @@ namespace Aurum
             return ss.str();
         }
     };
+    static_assert(sizeof(Vector4) == 4 * sizeof(float), "SIMD kernels read Vector4 as float[4]");
 }
@@ -1,11 +1,152 @@
 #pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <mutex>
-#include <unordered_map>
+#include <vector>
+#include <Framework/CallStack.hpp>
 #include <Framework/Logger.hpp>
 
+// ------------------------------------------------------------
+// Memory Tracking Switch
+// ------------------------------------------------------------
+// On in debug builds and in any build with the profiler compiled in; set
+// AURUM_MEMORY_TRACKING=0 (CMake: -DAURUM_ENABLE_MEMORY_TRACKING=OFF) to
+// make AURUM_NEW / AURUM_DELETE plain new / delete.
+#ifndef AURUM_MEMORY_TRACKING
+    #if defined(_DEBUG) || !defined(NDEBUG) || !defined(AURUM_PROFILER) || AURUM_PROFILER
+        #define AURUM_MEMORY_TRACKING 1
+    #else
+        #define AURUM_MEMORY_TRACKING 0
+    #endif
+#endif
+
+// AURUM_GLOBAL_NEW_HOOK=1 (CMake: -DAURUM_HOOK_GLOBAL_NEW=ON) replaces the
+// global operator new/delete so every C++ allocation, STL containers
+// included, is counted with its tag and a sampled call stack.
+#ifndef AURUM_GLOBAL_NEW_HOOK
+    #define AURUM_GLOBAL_NEW_HOOK 0
+#endif
+
+// AURUM_SMALL_OBJECT_NEW=1 (CMake: -DAURUM_SMALL_OBJECT_NEW=ON) serves
+// AURUM_NEW / AURUM_DELETE from SmallObjectAllocator where the type allows.
+#ifndef AURUM_SMALL_OBJECT_NEW
+    #define AURUM_SMALL_OBJECT_NEW 0
+#endif
+
 namespace Aurum
 {
+    // Snapshot returned by MemoryTracker::GetStats()
+    struct MemoryStats
+    {
+        std::uint64_t allocatedBytes = 0;   // Lifetime totals
+        std::uint64_t freedBytes = 0;
+        std::uint64_t allocations = 0;
+        std::uint64_t deallocations = 0;
+
+        std::int64_t liveBytes = 0;
+        std::uint64_t peakBytes = 0;        // High-water mark of liveBytes
+
+        std::uint64_t frameAllocations = 0; // During the last completed frame
+        std::uint64_t frameBytes = 0;
+        std::uint64_t frameIndex = 0;
+    };
+
+    constexpr std::size_t kMaxMemoryTags = 32;
+    constexpr std::uint16_t kUntaggedMemory = 0;
+    constexpr std::uint32_t kNoMemorySite = 0xFFFFFFFFu;
+
+    // Per-tag totals; liveBytes and the frame window as for MemoryStats
+    struct MemoryTagStats
+    {
+        const char* name = nullptr;
+        std::uint64_t allocations = 0;
+        std::uint64_t allocatedBytes = 0;
+        std::int64_t liveBytes = 0;
+        std::uint64_t frameAllocations = 0;
+        std::uint64_t frameBytes = 0;
+    };
+
+    // An allocation site: an AURUM_NEW file/line, or a sampled call stack
+    // whose counts are scaled by the sample interval (estimates)
+    struct MemorySiteStats
+    {
+        const char* file = nullptr;
+        int line = 0;
+        std::uint16_t tag = kUntaggedMemory;
+        std::size_t depth = 0;
+        void* frames[CallStack::kMaxFrames] = {};
+
+        std::uint64_t allocations = 0;
+        std::uint64_t allocatedBytes = 0;
+        std::int64_t liveBytes = 0;
+    };
+
+    // Per-frame usage of a linear allocator such as FrameArena
+    struct MemoryArenaStats
+    {
+        const char* name = nullptr;
+        std::uint64_t frameBytes = 0;       // Used by the last completed frame
+        std::uint64_t peakFrameBytes = 0;
+        std::uint64_t committedBytes = 0;
+        std::uint64_t reservedBytes = 0;
+    };
+
+    // Long-lived pool allocators (ObjectPool, SmallObjectAllocator)
+    struct MemoryPoolStats
+    {
+        const char* name = nullptr;
+        std::uint64_t liveBytes = 0;        // Handed out to callers
+        std::uint64_t peakBytes = 0;
+        std::uint64_t committedBytes = 0;   // Obtained from the heap
+        std::uint64_t allocations = 0;      // Lifetime
+    };
+
+    // Pools register themselves and are polled when stats are read
+    class MemoryPoolSource
+    {
+    public:
+        virtual ~MemoryPoolSource() = default;
+        virtual MemoryPoolStats GetPoolStats() const = 0;
+    };
+
+    struct MemoryTagCounters
+    {
+        std::atomic<std::uint64_t> allocations{0};
+        std::atomic<std::uint64_t> allocatedBytes{0};
+        std::atomic<std::uint64_t> freedBytes{0};
+    };
+
+    // ---------------------------------------
+    // Per-thread counters
+    // ---------------------------------------
+    // Each thread claims its own cache line, so tracking never contends.
+    // Readers add the slots up. Slots are reused after their thread exits
+    // and keep their counts, so lifetime totals stay exact.
+    struct alignas(64) MemoryThreadSlot
+    {
+        std::atomic<std::uint64_t> allocatedBytes{0};
+        std::atomic<std::uint64_t> freedBytes{0};
+        std::atomic<std::uint64_t> allocations{0};
+        std::atomic<std::uint64_t> deallocations{0};
+        std::atomic<std::int64_t> pendingBytes{0}; // Live delta not yet folded into the peak
+        std::atomic<bool> inUse{false};
+        std::array<MemoryTagCounters, kMaxMemoryTags> tags;
+    };
+
+    // Site table entry; claimed once by key, then only counters change
+    struct MemorySite
+    {
+        std::atomic<std::uint64_t> key{0};
+        std::atomic<bool> ready{false};
+        MemorySiteStats info;
+        std::atomic<std::uint64_t> allocations{0};
+        std::atomic<std::uint64_t> allocatedBytes{0};
+        std::atomic<std::uint64_t> freedBytes{0};
+    };
+
     class MemoryTracker
     {
     public:
@@ -15,54 +156,247 @@ namespace Aurum
             return instance;
         }
 
+        // AURUM_NEW path: exact, attributed to file:line and the current tag
         void RegisterAllocation(std::size_t size, const char* file, int line)
         {
-            std::lock_guard<std::mutex> lock(mutex_);
-            totalAllocated_ += size;
-            allocationCount_++;
+            const std::uint16_t tag = CurrentTag();
+            const std::uint32_t site = FindSourceSite(file, line, tag);
+            RegisterAllocation(size, tag, site, 1);
+
             if constexpr (kVerbose)
             {
                 Logger::Get().Log("Alloc " + std::to_string(size) + " bytes at " + file + ":" + std::to_string(line));
             }
         }
 
+        // Deallocations without a recorded tag are charged to the current one
         void RegisterDeallocation(std::size_t size)
         {
-            std::lock_guard<std::mutex> lock(mutex_);
-            totalFreed_ += size;
-            deallocationCount_++;
+            RegisterDeallocation(size, CurrentTag(), kNoMemorySite, 1);
+        }
+
+        // siteWeight scales site counts for sampled sites
+        void RegisterAllocation(std::size_t size, std::uint16_t tag, std::uint32_t site, std::uint32_t siteWeight)
+        {
+            MemoryThreadSlot& slot = ThreadSlot();
+            slot.allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+            slot.allocations.fetch_add(1, std::memory_order_relaxed);
+            slot.tags[tag].allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+            slot.tags[tag].allocations.fetch_add(1, std::memory_order_relaxed);
+            if (slot.pendingBytes.fetch_add(static_cast<std::int64_t>(size), std::memory_order_relaxed) +
+                static_cast<std::int64_t>(size) >= kPeakGranularity)
+            {
+                FoldPending(slot);
+            }
+
+            if (site != kNoMemorySite)
+            {
+                sites_[site].allocations.fetch_add(siteWeight, std::memory_order_relaxed);
+                sites_[site].allocatedBytes.fetch_add(static_cast<std::uint64_t>(size) * siteWeight, std::memory_order_relaxed);
+            }
         }
 
-        void Report() const
+        void RegisterDeallocation(std::size_t size, std::uint16_t tag, std::uint32_t site, std::uint32_t siteWeight)
         {
-            Logger::Get().Log("=== Memory Report ===", LogLevel::Info);
-            Logger::Get().Log("Allocated:   " + std::to_string(totalAllocated_) + " bytes", LogLevel::Info);
-            Logger::Get().Log("Freed:       " + std::to_string(totalFreed_) + " bytes", LogLevel::Info);
-            Logger::Get().Log("Allocations: " + std::to_string(allocationCount_), LogLevel::Info);
-            Logger::Get().Log("Deallocs:    " + std::to_string(deallocationCount_), LogLevel::Info);
-            Logger::Get().Log("=====================", LogLevel::Info);
+            MemoryThreadSlot& slot = ThreadSlot();
+            slot.freedBytes.fetch_add(size, std::memory_order_relaxed);
+            slot.deallocations.fetch_add(1, std::memory_order_relaxed);
+            slot.tags[tag].freedBytes.fetch_add(size, std::memory_order_relaxed);
+            if (slot.pendingBytes.fetch_add(-static_cast<std::int64_t>(size), std::memory_order_relaxed) -
+                static_cast<std::int64_t>(size) <= -kPeakGranularity)
+            {
+                FoldPending(slot);
+            }
+
+            if (site != kNoMemorySite)
+                sites_[site].freedBytes.fetch_add(static_cast<std::uint64_t>(size) * siteWeight, std::memory_order_relaxed);
         }
 
+        // ------------------------------------------------------------
+        // Tags: a per-thread stack, see AURUM_MEMORY_TAG
+        // ------------------------------------------------------------
+        // Returns the id for name (a string literal); ids past
+        // kMaxMemoryTags fall back to kUntaggedMemory
+        std::uint16_t RegisterTag(const char* name);
+        const char* GetTagName(std::uint16_t tag) const;
+
+        static std::uint16_t CurrentTag() { return CurrentTagRef(); }
+        static void SetCurrentTag(std::uint16_t tag) { CurrentTagRef() = tag; }
+
+        // ------------------------------------------------------------
+        // Sampled call-stack sites (global new hook)
+        // ------------------------------------------------------------
+        // Returns a site for one in every GetSampleInterval() calls on this
+        // thread, kNoMemorySite otherwise
+        std::uint32_t SampleStackSite(std::uint16_t tag, std::size_t skipFrames)
+        {
+            thread_local std::uint32_t countdown = 0;
+            const std::uint32_t interval = sampleInterval_.load(std::memory_order_relaxed);
+            if (interval == 0)
+                return kNoMemorySite;
+            if (countdown > 0)
+            {
+                countdown--;
+                return kNoMemorySite;
+            }
+            countdown = interval - 1;
+            return CaptureStackSite(tag, skipFrames);
+        }
+
+        // 0 disables stack sampling; at most 65535
+        void SetSampleInterval(std::uint32_t interval) { sampleInterval_.store(std::min(interval, 65535u), std::memory_order_relaxed); }
+        std::uint32_t GetSampleInterval() const { return sampleInterval_.load(std::memory_order_relaxed); }
+
+        // Closes the per-frame allocation window; call once per frame
+        void EndFrame();
+
+        // Sums the thread slots; lock-free and cheap enough to call per frame
+        MemoryStats GetStats() const;
+
+        std::vector<MemoryTagStats> GetTagStats() const;
+
+        // Arenas report once per frame, keyed by name
+        void UpdateArena(const MemoryArenaStats& stats);
+        std::vector<MemoryArenaStats> GetArenaStats() const;
+
+        void AddPool(const MemoryPoolSource* pool);
+        void RemovePool(const MemoryPoolSource* pool);
+        std::vector<MemoryPoolStats> GetPoolStats() const;
+
+        // Top sites by allocated bytes, or by allocation count
+        std::vector<MemorySiteStats> GetTopSites(std::size_t count, bool byCount = false) const;
+
+        void Report() const;
+        void ReportTags() const;
+        void ReportSites(std::size_t topN = 10) const;
+
     private:
-        MemoryTracker() = default;
+        MemoryTracker();
         ~MemoryTracker() = default;
 
         MemoryTracker(const MemoryTracker&) = delete;
         MemoryTracker& operator=(const MemoryTracker&) = delete;
 
-        mutable std::mutex mutex_;
-        std::size_t totalAllocated_ = 0;
-        std::size_t totalFreed_ = 0;
-        std::size_t allocationCount_ = 0;
-        std::size_t deallocationCount_ = 0;
+        MemoryThreadSlot& ThreadSlot()
+        {
+            // Hands the slot back when its thread exits
+            struct Holder
+            {
+                MemoryThreadSlot* slot = nullptr;
+                ~Holder()
+                {
+                    if (slot && slot != &Get().slots_.back())
+                        slot->inUse.store(false, std::memory_order_release);
+                }
+            };
+            thread_local Holder holder;
+
+            if (!holder.slot)
+                holder.slot = &ClaimSlot();
+            return *holder.slot;
+        }
+
+        MemoryThreadSlot& ClaimSlot();
+        void FoldPending(MemoryThreadSlot& slot);
+        void UpdatePeak(std::int64_t live);
+
+        static std::uint16_t& CurrentTagRef()
+        {
+            thread_local std::uint16_t tag = kUntaggedMemory;
+            return tag;
+        }
+
+        std::uint32_t FindSourceSite(const char* file, int line, std::uint16_t tag);
+        std::uint32_t CaptureStackSite(std::uint16_t tag, std::size_t skipFrames);
+        template <typename Init>
+        std::uint32_t FindOrAddSite(std::uint64_t key, Init&& init);
+
+        // Live bytes are exact on read; the peak is tracked from per-thread
+        // deltas folded in every kPeakGranularity bytes, so it can lag the
+        // true high-water mark by at most that much per thread.
+        static constexpr std::int64_t kPeakGranularity = 64 * 1024;
+        static constexpr std::size_t kMaxSlots = 128; // The last one is shared once the rest are taken
+
+        std::array<MemoryThreadSlot, kMaxSlots> slots_;
+        std::atomic<std::size_t> slotCount_{0};        // Slots ever claimed
+        alignas(64) std::atomic<std::int64_t> foldedLiveBytes_{0};
+        std::atomic<std::uint64_t> peakBytes_{0};
+
+        // --- Frame window (written by EndFrame) ---
+        std::uint64_t frameBaseAllocations_ = 0;
+        std::uint64_t frameBaseBytes_ = 0;
+        std::atomic<std::uint64_t> frameAllocations_{0};
+        std::atomic<std::uint64_t> frameBytes_{0};
+        std::atomic<std::uint64_t> frameIndex_{0};
+
+        // --- Tags ---
+        std::array<std::atomic<const char*>, kMaxMemoryTags> tagNames_{};
+        std::atomic<std::uint32_t> tagCount_{1};
+        std::array<std::uint64_t, kMaxMemoryTags> tagFrameBaseAllocations_{};
+        std::array<std::uint64_t, kMaxMemoryTags> tagFrameBaseBytes_{};
+        std::array<std::atomic<std::uint64_t>, kMaxMemoryTags> tagFrameAllocations_{};
+        std::array<std::atomic<std::uint64_t>, kMaxMemoryTags> tagFrameBytes_{};
+
+        // --- Arenas and pools ---
+        static constexpr std::size_t kMaxArenas = 8;
+        mutable std::mutex registryMutex_;
+        std::array<MemoryArenaStats, kMaxArenas> arenas_{};
+        std::size_t arenaCount_ = 0;
+        std::vector<const MemoryPoolSource*> pools_;
+
+        // --- Sites (open addressing, never removed) ---
+        static constexpr std::size_t kMaxSites = 1024;
+        std::array<MemorySite, kMaxSites> sites_;
+        std::atomic<std::uint32_t> sampleInterval_{64};
 
         static constexpr bool kVerbose = false; // toggle detailed per-allocation logs
     };
 
-    // Macros for tracking allocations (active only in debug)
-    #if defined(_DEBUG) || !defined(NDEBUG)
+    // RAII scope used by AURUM_MEMORY_TAG
+    class MemoryTagScope
+    {
+    public:
+        explicit MemoryTagScope(std::uint16_t tag) : previous_(MemoryTracker::CurrentTag())
+        {
+            MemoryTracker::SetCurrentTag(tag);
+        }
+
+        ~MemoryTagScope() { MemoryTracker::SetCurrentTag(previous_); }
+
+        MemoryTagScope(const MemoryTagScope&) = delete;
+        MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+
+    private:
+        std::uint16_t previous_;
+    };
+
+    // Charges allocations in the enclosing scope to a subsystem:
+    //   AURUM_MEMORY_TAG("Renderer");
+    #define AURUM_MEMORY_TAG_CONCAT_IMPL(a, b) a##b
+    #define AURUM_MEMORY_TAG_CONCAT(a, b) AURUM_MEMORY_TAG_CONCAT_IMPL(a, b)
+
+    #if AURUM_MEMORY_TRACKING
+        #define AURUM_MEMORY_TAG(name)                                                                                  \
+            static const std::uint16_t AURUM_MEMORY_TAG_CONCAT(aurumMemoryTag, __LINE__) = ::Aurum::MemoryTracker::Get().RegisterTag(name); \
+            ::Aurum::MemoryTagScope AURUM_MEMORY_TAG_CONCAT(aurumMemoryTagScope, __LINE__)(AURUM_MEMORY_TAG_CONCAT(aurumMemoryTag, __LINE__))
+    #else
+        #define AURUM_MEMORY_TAG(name) do {} while (0)
+    #endif
+
+    // Allocation path behind AURUM_NEW / AURUM_DELETE
+    #if AURUM_SMALL_OBJECT_NEW
+        #define AURUM_NEW_ALLOCATE(T, ...) ::Aurum::NewSmallObject<T>(__VA_ARGS__)
+        #define AURUM_NEW_RELEASE(ptr) ::Aurum::DeleteSmallObject(ptr)
+    #else
+        #define AURUM_NEW_ALLOCATE(T, ...) new T(__VA_ARGS__)
+        #define AURUM_NEW_RELEASE(ptr) delete ptr
+    #endif
+
+    // Macros for tracking allocations (see AURUM_MEMORY_TRACKING). With the
+    // global hook, operator new already counts them.
+    #if AURUM_MEMORY_TRACKING && !AURUM_GLOBAL_NEW_HOOK
         #define AURUM_NEW(T, ...) ([](){ \
-            T* ptr = new T(__VA_ARGS__); \
+            T* ptr = AURUM_NEW_ALLOCATE(T, __VA_ARGS__); \
             Aurum::MemoryTracker::Get().RegisterAllocation(sizeof(T), __FILE__, __LINE__); \
             return ptr; \
         }())
@@ -70,11 +404,15 @@ namespace Aurum
         #define AURUM_DELETE(ptr) do { \
             if(ptr){ \
                 Aurum::MemoryTracker::Get().RegisterDeallocation(sizeof(*ptr)); \
-                delete ptr; ptr = nullptr; \
+                AURUM_NEW_RELEASE(ptr); ptr = nullptr; \
             } \
         } while(0)
     #else
-        #define AURUM_NEW(T, ...) new T(__VA_ARGS__)
-        #define AURUM_DELETE(ptr) do { delete ptr; ptr = nullptr; } while(0)
+        #define AURUM_NEW(T, ...) AURUM_NEW_ALLOCATE(T, __VA_ARGS__)
+        #define AURUM_DELETE(ptr) do { AURUM_NEW_RELEASE(ptr); ptr = nullptr; } while(0)
     #endif
 }
+
+#if AURUM_SMALL_OBJECT_NEW
+    #include <Framework/SmallObjectAllocator.hpp>
+#endif
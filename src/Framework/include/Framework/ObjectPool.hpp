@@ -0,0 +1,132 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+#include <Framework/MemoryTracker.hpp>
+
+namespace Aurum
+{
+    // ---------------------------------------
+    // Object Pool: typed free-list allocator
+    // ---------------------------------------
+    // Hands out T-sized slots from chunk pages that are never moved or
+    // released before the pool itself, so addresses stay stable. Freed
+    // slots go onto an intrusive free list and are reused first (LIFO,
+    // cache-warm). Owned by one thread; the stats are safe to read from any.
+    //
+    //   ObjectPool<SceneNode> nodes("Scene Nodes");
+    //   SceneNode* node = nodes.Create(parent);
+    //   nodes.Destroy(node);
+    template <typename T>
+    class ObjectPool final : public MemoryPoolSource
+    {
+    public:
+        // About 16 KiB of objects per chunk, never fewer than 16
+        static constexpr std::size_t kSlotsPerChunk = std::max<std::size_t>(16, 16384 / sizeof(T));
+
+        explicit ObjectPool(const char* name = "Object Pool") : name_(name)
+        {
+            MemoryTracker::Get().AddPool(this);
+        }
+
+        ~ObjectPool() override
+        {
+            MemoryTracker::Get().RemovePool(this);
+            for (Slot* chunk : chunks_)
+                ::operator delete(chunk, std::align_val_t(alignof(Slot)));
+        }
+
+        ObjectPool(const ObjectPool&) = delete;
+        ObjectPool& operator=(const ObjectPool&) = delete;
+
+        template <typename... Args>
+        T* Create(Args&&... args)
+        {
+            if (!freeList_)
+                AddChunk();
+
+            Slot* slot = freeList_;
+            freeList_ = slot->next;
+            T* object;
+            try
+            {
+                object = ::new (static_cast<void*>(slot->storage)) T(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                // The constructor may have written over the link
+                slot->next = freeList_;
+                freeList_ = slot;
+                throw;
+            }
+
+            const std::uint64_t live = live_.load(std::memory_order_relaxed) + 1;
+            live_.store(live, std::memory_order_relaxed);
+            allocations_.store(allocations_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            if (live > peak_.load(std::memory_order_relaxed))
+                peak_.store(live, std::memory_order_relaxed);
+            return object;
+        }
+
+        void Destroy(T* object)
+        {
+            if (!object)
+                return;
+            object->~T();
+
+            Slot* slot = reinterpret_cast<Slot*>(object);
+            slot->next = freeList_;
+            freeList_ = slot;
+            live_.store(live_.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+        }
+
+        std::size_t GetLiveCount() const { return static_cast<std::size_t>(live_.load(std::memory_order_relaxed)); }
+        std::size_t GetCapacity() const { return capacity_.load(std::memory_order_relaxed); }
+
+        MemoryPoolStats GetPoolStats() const override
+        {
+            MemoryPoolStats stats;
+            stats.name = name_;
+            stats.liveBytes = live_.load(std::memory_order_relaxed) * sizeof(T);
+            stats.peakBytes = peak_.load(std::memory_order_relaxed) * sizeof(T);
+            stats.committedBytes = capacity_.load(std::memory_order_relaxed) * sizeof(Slot);
+            stats.allocations = allocations_.load(std::memory_order_relaxed);
+            return stats;
+        }
+
+    private:
+        union Slot
+        {
+            Slot* next;
+            alignas(T) unsigned char storage[sizeof(T)];
+        };
+
+        void AddChunk()
+        {
+            Slot* chunk = static_cast<Slot*>(::operator new(sizeof(Slot) * kSlotsPerChunk, std::align_val_t(alignof(Slot))));
+            chunks_.push_back(chunk);
+
+            // Thread the new slots so the lowest address is handed out first
+            for (std::size_t i = 0; i + 1 < kSlotsPerChunk; ++i)
+                chunk[i].next = &chunk[i + 1];
+            chunk[kSlotsPerChunk - 1].next = freeList_;
+            freeList_ = chunk;
+            capacity_.store(capacity_.load(std::memory_order_relaxed) + kSlotsPerChunk, std::memory_order_relaxed);
+        }
+
+        const char* name_;
+        Slot* freeList_ = nullptr;
+        std::vector<Slot*> chunks_;
+
+        // Written by the owner only; atomics so GetPoolStats() can read them
+        std::atomic<std::uint64_t> live_{0};
+        std::atomic<std::uint64_t> peak_{0};
+        std::atomic<std::uint64_t> allocations_{0};
+        std::atomic<std::size_t> capacity_{0};
+    };
+}
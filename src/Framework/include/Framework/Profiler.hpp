@@ -0,0 +1,270 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <Framework/TscClock.hpp>
+
+// Set AURUM_PROFILER=0 (CMake: -DAURUM_ENABLE_PROFILER=OFF) to compile
+// every AURUM_PROFILE_* macro to nothing.
+#ifndef AURUM_PROFILER
+    #define AURUM_PROFILER 1
+#endif
+
+namespace Aurum
+{
+    // Static description of a zone; one per AURUM_PROFILE_ZONE call site
+    struct ProfileSite
+    {
+        const char* name;
+        const char* file;
+        std::uint32_t line;
+    };
+
+    // site == nullptr marks the end of the innermost open zone
+    struct ProfileEvent
+    {
+        const ProfileSite* site;
+        std::uint64_t time; // Profiler::Now() nanoseconds
+    };
+
+    // ---------------------------------------
+    // Per-thread Event Buffer
+    // ---------------------------------------
+    // Single-producer / single-consumer ring: the owning thread writes zone
+    // events, Profiler::EndFrame drains them. When full, whole zones are
+    // dropped (a dropped begin also drops everything up to its end). Every
+    // written begin keeps a slot reserved for its end, so ends always fit
+    // and the collected tree stays balanced.
+    class ProfileThreadBuffer
+    {
+    public:
+        static constexpr std::size_t kCapacity = 1 << 16;
+
+        explicit ProfileThreadBuffer(std::uint32_t index) : index_(index) {}
+
+        void Push(const ProfileSite* site, std::uint64_t time)
+        {
+            if (skipDepth_ > 0)
+            {
+                site ? ++skipDepth_ : --skipDepth_;
+                return;
+            }
+
+            // A begin needs its own slot, its end's and those of every open zone
+            const std::uint64_t needed = site ? openDepth_ + 2 : 1;
+            const std::uint64_t write = write_.load(std::memory_order_relaxed);
+            if (write - cachedRead_ + needed > kCapacity)
+            {
+                cachedRead_ = read_.load(std::memory_order_acquire);
+                if (write - cachedRead_ + needed > kCapacity)
+                {
+                    if (site)
+                        ++skipDepth_;
+                    dropped_.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+            }
+
+            events_[write & (kCapacity - 1)] = { site, time };
+            write_.store(write + 1, std::memory_order_release);
+            if (site)
+                ++openDepth_;
+            else if (openDepth_ > 0)
+                --openDepth_;
+        }
+
+    private:
+        friend class Profiler;
+
+        // --- Producer side ---
+        std::unique_ptr<ProfileEvent[]> events_{ new ProfileEvent[kCapacity] };
+        alignas(64) std::atomic<std::uint64_t> write_{0};
+        std::uint64_t cachedRead_ = 0;
+        std::uint32_t skipDepth_ = 0;
+        std::uint32_t openDepth_ = 0; // Written begins still waiting for their end
+
+        // --- Consumer side ---
+        alignas(64) std::atomic<std::uint64_t> read_{0};
+        std::atomic<std::uint64_t> dropped_{0};
+        std::atomic<bool> retired_{false};   // Owning thread exited; freed after the next drain
+
+        struct OpenZone
+        {
+            const ProfileSite* site;
+            std::uint64_t start;
+            std::uint32_t node;
+        };
+        std::vector<OpenZone> open_;
+        std::uint32_t index_;
+        std::string name_;
+    };
+
+    // ---------------------------------------
+    // Per-frame Call Tree
+    // ---------------------------------------
+    struct ProfileNode
+    {
+        static constexpr std::uint32_t kNone = UINT32_MAX;
+
+        const ProfileSite* site = nullptr; // nullptr for the root
+        std::uint32_t parent = kNone;
+        std::uint32_t firstChild = kNone;
+        std::uint32_t nextSibling = kNone;
+        std::uint32_t calls = 0;
+        std::uint64_t inclusive = 0;       // Nanoseconds, children included
+        std::uint64_t exclusive = 0;       // Nanoseconds in the zone itself
+    };
+
+    struct ProfileThreadTree
+    {
+        std::uint32_t thread = 0;
+        std::string name;
+        std::vector<ProfileNode> nodes;    // nodes[0] is the root
+    };
+
+    struct ProfileFrame
+    {
+        std::uint64_t index = 0;
+        std::uint64_t begin = 0;
+        std::uint64_t end = 0;
+        std::uint64_t dropped = 0;         // Events lost to full buffers this frame
+        std::vector<ProfileThreadTree> threads;
+
+        // Indented tree: calls, inclusive and exclusive milliseconds
+        std::string ToString() const;
+    };
+
+    // Receives raw events while draining, e.g. the trace recorder.
+    // Called on the thread that runs EndFrame.
+    class ProfileListener
+    {
+    public:
+        virtual ~ProfileListener() = default;
+        virtual void OnThreadEvents(const ProfileThreadTree& thread, const ProfileEvent* events, std::size_t count) = 0;
+        virtual void OnFrameEnd(const ProfileFrame& frame) = 0;
+    };
+
+    // ---------------------------------------
+    // Profiler
+    // ---------------------------------------
+    // Zones are recorded with AURUM_PROFILE_ZONE into per-thread buffers.
+    // EndFrame (main thread, once per frame) drains them and builds one call
+    // tree per thread, merged by call path. A zone is counted in the frame
+    // in which it ends.
+    class Profiler
+    {
+    public:
+        static Profiler& Get()
+        {
+            static Profiler instance;
+            return instance;
+        }
+
+        // Zone timestamps: the calibrated TSC, or steady_clock without one
+        static std::uint64_t Now() { return TscClock::NowNanoseconds(); }
+
+        void SetEnabled(bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+        bool IsEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+        // Label shown for the calling thread
+        void SetThreadName(const std::string& name);
+
+        void Begin(const ProfileSite& site) { ThreadBuffer().Push(&site, Now()); }
+        void End() { ThreadBuffer().Push(nullptr, Now()); }
+
+        // Closes the current frame; the result is valid until the next call
+        void EndFrame();
+        const ProfileFrame& GetLastFrame() const { return frame_; }
+
+        // One listener at a time; nullptr removes it
+        void SetListener(ProfileListener* listener);
+
+    private:
+        Profiler() = default;
+
+        // Retires the thread's buffer when the thread exits
+        struct ThreadBufferOwner
+        {
+            ProfileThreadBuffer* buffer = nullptr;
+            ~ThreadBufferOwner()
+            {
+                if (buffer)
+                    buffer->retired_.store(true, std::memory_order_release);
+                buffer = nullptr;
+            }
+        };
+
+        ProfileThreadBuffer& ThreadBuffer()
+        {
+            thread_local ThreadBufferOwner owner;
+            if (!owner.buffer)
+                owner.buffer = &RegisterThread();
+            return *owner.buffer;
+        }
+
+        ProfileThreadBuffer& RegisterThread();
+        void BuildTree(ProfileThreadBuffer& buffer, ProfileThreadTree& tree);
+
+        std::atomic<bool> enabled_{true};
+        std::mutex threadsMutex_;
+        std::vector<std::unique_ptr<ProfileThreadBuffer>> threads_; // Live threads, and exited ones until drained
+        std::uint32_t nextThreadIndex_ = 0;
+
+        ProfileListener* listener_ = nullptr;
+        ProfileFrame frame_;
+        std::uint64_t frameIndex_ = 0;
+        std::uint64_t frameBegin_ = Now();
+    };
+
+    // RAII zone used by AURUM_PROFILE_ZONE
+    class ProfileZone
+    {
+    public:
+        explicit ProfileZone(const ProfileSite& site) : active_(Profiler::Get().IsEnabled())
+        {
+            if (active_)
+                Profiler::Get().Begin(site);
+        }
+
+        ~ProfileZone()
+        {
+            if (active_)
+                Profiler::Get().End();
+        }
+
+        ProfileZone(const ProfileZone&) = delete;
+        ProfileZone& operator=(const ProfileZone&) = delete;
+
+    private:
+        bool active_;
+    };
+}
+
+// ------------------------------------------------------------
+// Profiling Macros
+// ------------------------------------------------------------
+//   void Physics::Step()
+//   {
+//       AURUM_PROFILE_FUNCTION();
+//       { AURUM_PROFILE_ZONE("Broadphase"); ... }
+//   }
+#define AURUM_PROFILE_CONCAT_IMPL(a, b) a##b
+#define AURUM_PROFILE_CONCAT(a, b) AURUM_PROFILE_CONCAT_IMPL(a, b)
+
+#if AURUM_PROFILER
+    #define AURUM_PROFILE_ZONE(name)                                                                          \
+        static constinit ::Aurum::ProfileSite AURUM_PROFILE_CONCAT(aurumProfileSite, __LINE__){ name, __FILE__, __LINE__ }; \
+        ::Aurum::ProfileZone AURUM_PROFILE_CONCAT(aurumProfileZone, __LINE__)(AURUM_PROFILE_CONCAT(aurumProfileSite, __LINE__))
+    #define AURUM_PROFILE_FUNCTION() AURUM_PROFILE_ZONE(__func__)
+    #define AURUM_PROFILE_THREAD(name) ::Aurum::Profiler::Get().SetThreadName(name)
+    #define AURUM_PROFILE_FRAME() ::Aurum::Profiler::Get().EndFrame()
+#else
+    #define AURUM_PROFILE_ZONE(name) do {} while (0)
+    #define AURUM_PROFILE_FUNCTION() do {} while (0)
+    #define AURUM_PROFILE_THREAD(name) do {} while (0)
+    #define AURUM_PROFILE_FRAME() do {} while (0)
+#endif
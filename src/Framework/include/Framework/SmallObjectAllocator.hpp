@@ -0,0 +1,241 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <Framework/MemoryTracker.hpp>
+
+namespace Aurum
+{
+    // ---------------------------------------
+    // Small Object Allocator: size classes with thread caches
+    // ---------------------------------------
+    // Blocks up to kMaxSize bytes come from 20 size classes (16-byte steps
+    // to 128, then four per power of two). Each thread keeps a free list per
+    // class and trades whole batches with a central list, so the common
+    // path is a thread-local pop/push and the lock is taken once per batch.
+    // Larger requests go to operator new. Callers pass the size back to
+    // Deallocate (sized, like std::allocator). Spans are kept for the life of
+    // the process, so memory is reused by size class but not returned to
+    // the OS.
+    class SmallObjectAllocator final : public MemoryPoolSource
+    {
+    public:
+        static constexpr std::size_t kMaxSize = 1024;
+        static constexpr std::size_t kAlignment = 16;
+        static constexpr std::size_t kClassCount = 20;
+
+        static SmallObjectAllocator& Get()
+        {
+            static SmallObjectAllocator instance;
+            return instance;
+        }
+
+        void* Allocate(std::size_t size)
+        {
+            if (size > kMaxSize)
+                return ::operator new(size, std::align_val_t(kAlignment));
+
+            const std::size_t sizeClass = ClassOf(size);
+            ThreadCache& cache = GetThreadCache();
+            ThreadCache::List& list = cache.lists[sizeClass];
+            if (!list.head)
+                Refill(list, sizeClass);
+
+            Block* block = list.head;
+            list.head = block->next;
+            list.count--;
+            cache.AddLive(static_cast<std::int64_t>(kClassSizes[sizeClass]));
+            return block;
+        }
+
+        void Deallocate(void* memory, std::size_t size)
+        {
+            if (!memory)
+                return;
+            if (size > kMaxSize)
+            {
+                ::operator delete(memory, std::align_val_t(kAlignment));
+                return;
+            }
+
+            const std::size_t sizeClass = ClassOf(size);
+            ThreadCache& cache = GetThreadCache();
+            ThreadCache::List& list = cache.lists[sizeClass];
+            Block* block = static_cast<Block*>(memory);
+            block->next = list.head;
+            list.head = block;
+            list.count++;
+            cache.AddLive(-static_cast<std::int64_t>(kClassSizes[sizeClass]));
+            if (list.count >= 2 * kBatchSizes[sizeClass])
+                ReleaseBatch(list, sizeClass);
+        }
+
+        static constexpr std::size_t GetClassSize(std::size_t size) { return kClassSizes[ClassOf(size)]; }
+
+        MemoryPoolStats GetPoolStats() const override;
+
+    private:
+        struct Block
+        {
+            Block* next;
+        };
+
+        // A batch is a chain of blocks; batches are chained through their
+        // second word (every block is at least 16 bytes)
+        struct Batch
+        {
+            Block* next;
+            Batch* nextBatch;
+        };
+
+        struct ThreadCache
+        {
+            struct List
+            {
+                Block* head = nullptr;
+                std::uint32_t count = 0;
+            };
+
+            std::array<List, kClassCount> lists{};
+            std::atomic<std::int64_t> liveBytes{0};     // Written by the owning thread only
+            std::atomic<std::uint64_t> allocations{0};
+            ThreadCache* nextCache = nullptr;          // Registry link, under registryMutex_
+
+            void AddLive(std::int64_t bytes)
+            {
+                liveBytes.store(liveBytes.load(std::memory_order_relaxed) + bytes, std::memory_order_relaxed);
+                if (bytes > 0)
+                    allocations.store(allocations.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            }
+        };
+
+        struct CentralList
+        {
+            std::mutex mutex;
+            Batch* batches = nullptr;   // Full batches
+            Block* loose = nullptr;     // Partial leftovers from exited threads
+            std::uint32_t looseCount = 0;
+        };
+
+        static constexpr std::array<std::uint32_t, kClassCount> kClassSizes = {
+            16, 32, 48, 64, 80, 96, 112, 128,
+            160, 192, 224, 256,
+            320, 384, 448, 512,
+            640, 768, 896, 1024 };
+
+        // About 8 KiB per batch, 4 to 64 blocks
+        static constexpr std::array<std::uint32_t, kClassCount> kBatchSizes = [] {
+            std::array<std::uint32_t, kClassCount> sizes{};
+            for (std::size_t i = 0; i < kClassCount; ++i)
+                sizes[i] = std::min<std::uint32_t>(64, std::max<std::uint32_t>(4, 8192 / kClassSizes[i]));
+            return sizes;
+        }();
+
+        // (size + 15) / 16 -> class, for sizes up to kMaxSize
+        static constexpr std::array<std::uint8_t, kMaxSize / 16 + 1> kClassLookup = [] {
+            std::array<std::uint8_t, kMaxSize / 16 + 1> lookup{};
+            std::size_t sizeClass = 0;
+            for (std::size_t i = 0; i < lookup.size(); ++i)
+            {
+                while (kClassSizes[sizeClass] < i * 16)
+                    sizeClass++;
+                lookup[i] = static_cast<std::uint8_t>(sizeClass);
+            }
+            return lookup;
+        }();
+
+        static constexpr std::size_t ClassOf(std::size_t size) { return kClassLookup[(size + 15) / 16]; }
+
+        SmallObjectAllocator() { MemoryTracker::Get().AddPool(this); }
+        ~SmallObjectAllocator() override { MemoryTracker::Get().RemovePool(this); }
+
+        ThreadCache& GetThreadCache()
+        {
+            // Returns the thread's blocks to the central lists when it exits
+            struct Holder
+            {
+                ThreadCache* cache = nullptr;
+                ~Holder()
+                {
+                    if (cache)
+                        Get().RetireCache(cache);
+                }
+            };
+            thread_local Holder holder;
+
+            if (!holder.cache)
+                holder.cache = CreateCache();
+            return *holder.cache;
+        }
+
+        ThreadCache* CreateCache();
+        void RetireCache(ThreadCache* cache);
+        void Refill(ThreadCache::List& list, std::size_t sizeClass);
+        void ReleaseBatch(ThreadCache::List& list, std::size_t sizeClass);
+        Batch* CarveSpan(std::size_t sizeClass);
+        void AddOutstanding(std::int64_t bytes);
+
+        std::array<CentralList, kClassCount> central_;
+
+        mutable std::mutex registryMutex_;
+        ThreadCache* caches_ = nullptr;
+        std::int64_t retiredLiveBytes_ = 0;
+        std::uint64_t retiredAllocations_ = 0;
+        std::atomic<std::uint64_t> committedBytes_{0};
+        std::atomic<std::int64_t> outstandingBytes_{0};   // Handed to thread caches, used or not
+        mutable std::atomic<std::uint64_t> peakBytes_{0};
+    };
+
+    // ------------------------------------------------------------
+    // Typed helpers (used by AURUM_NEW with AURUM_SMALL_OBJECT_NEW)
+    // ------------------------------------------------------------
+    // Polymorphic or over-aligned types use plain new/delete, so a delete
+    // through the static type always matches the allocation path.
+    template <typename T>
+    constexpr bool kSmallObjectRoutable = !std::is_polymorphic_v<T> &&
+        sizeof(T) <= SmallObjectAllocator::kMaxSize && alignof(T) <= SmallObjectAllocator::kAlignment;
+
+    template <typename T, typename... Args>
+    T* NewSmallObject(Args&&... args)
+    {
+        if constexpr (kSmallObjectRoutable<T>)
+        {
+            void* memory = SmallObjectAllocator::Get().Allocate(sizeof(T));
+            try
+            {
+                return ::new (memory) T(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                SmallObjectAllocator::Get().Deallocate(memory, sizeof(T));
+                throw;
+            }
+        }
+        else
+        {
+            return new T(std::forward<Args>(args)...);
+        }
+    }
+
+    template <typename T>
+    void DeleteSmallObject(T* object)
+    {
+        if constexpr (kSmallObjectRoutable<T>)
+        {
+            if (!object)
+                return;
+            object->~T();
+            SmallObjectAllocator::Get().Deallocate(const_cast<std::remove_cv_t<T>*>(object), sizeof(T));
+        }
+        else
+        {
+            delete object;
+        }
+    }
+}
@@ -1,20 +1,30 @@
 #pragma once
 #include <chrono>
+#include <concepts>
 #include <string>
 #include <Framework/Logger.hpp>
+#include <Framework/TscClock.hpp>
 
 namespace Aurum
 {
     using Clock = std::chrono::high_resolution_clock;
     using TimePoint = std::chrono::time_point<Clock>;
 
+    // Any std::chrono clock can drive the timers below, e.g. Clock or TscClock
+    template<typename C>
+    concept TimerClock = std::chrono::is_clock_v<C>;
+
     // ---------------------------------------
     // Basic Timer: manual start/stop control
     // ---------------------------------------
-    class HighResolutionTimer
+    template<TimerClock ClockT = Clock>
+    class BasicHighResolutionTimer
     {
     public:
-        HighResolutionTimer() { Reset(); }
+        using Clock = ClockT;
+        using TimePoint = typename ClockT::time_point;
+
+        BasicHighResolutionTimer() { Reset(); }
 
         void Reset()
         {
@@ -40,16 +50,24 @@ namespace Aurum
         TimePoint start_;
     };
 
+    using HighResolutionTimer = BasicHighResolutionTimer<>;
+
     // ------------------------------------------------
     // Scoped Timer: logs duration automatically (RAII)
     // ------------------------------------------------
-    class ScopedTimer
+    // One log line per use; meant for one-off measurements such as load
+    // times. Use AURUM_PROFILE_ZONE (Profiler.hpp) in per-frame code.
+    template<TimerClock ClockT = Clock>
+    class BasicScopedTimer
     {
     public:
-        explicit ScopedTimer(const std::string& label)
+        using Clock = ClockT;
+        using TimePoint = typename ClockT::time_point;
+
+        explicit BasicScopedTimer(const std::string& label)
             : label_(label), start_(Clock::now()) {}
 
-        ~ScopedTimer()
+        ~BasicScopedTimer()
         {
             auto end = Clock::now();
             double ms = std::chrono::duration<double, std::milli>(end - start_).count();
@@ -61,16 +79,19 @@ namespace Aurum
         TimePoint start_;
     };
 
+    using ScopedTimer = BasicScopedTimer<>;
+
     // ---------------------------------------
     // Frame Timer: tracks delta per frame
     // ---------------------------------------
- class FrameTimer
+    template<TimerClock ClockT = Clock>
+    class BasicFrameTimer
     {
     public:
-        using Clock = std::chrono::high_resolution_clock;
-        using TimePoint = std::chrono::time_point<Clock>;
+        using Clock = ClockT;
+        using TimePoint = typename ClockT::time_point;
 
-        FrameTimer()
+        BasicFrameTimer()
             : last_(Clock::now())
         {}
 
@@ -99,4 +120,6 @@ namespace Aurum
     private:
         TimePoint last_;
     };
+
+    using FrameTimer = BasicFrameTimer<>;
 }
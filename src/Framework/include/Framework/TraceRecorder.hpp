@@ -0,0 +1,79 @@
+#pragma once
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <Framework/Profiler.hpp>
+
+namespace Aurum
+{
+    // ---------------------------------------
+    // Trace Recorder: Chrome trace event export
+    // ---------------------------------------
+    // Writes profiler zones (B/E), frame boundaries and counters in the
+    // Chrome trace event JSON format, viewable in chrome://tracing or
+    // ui.perfetto.dev. Events are buffered in a small chunk and appended to
+    // the file as they are drained each frame, so memory stays flat no
+    // matter how long the capture runs.
+    //
+    //   TraceRecorder::Get().Start("capture.json", 300);  // next 300 frames
+    //   AURUM_TRACE_COUNTER("Draw Calls", drawCalls);
+    class TraceRecorder : private ProfileListener
+    {
+    public:
+        static TraceRecorder& Get()
+        {
+            static TraceRecorder instance;
+            return instance;
+        }
+
+        // frames = 0 records until Stop(); delayFrames skips that many
+        // frames first, so a capture can cover a chosen frame range
+        bool Start(const std::string& path, std::uint64_t frames = 0, std::uint64_t delayFrames = 0);
+        void Stop();
+
+        bool IsCapturing() const;
+        const std::string& GetPath() const { return path_; }
+
+        // Counter track sample; safe from any thread, ignored when idle.
+        // NaN and infinite values are dropped (JSON cannot encode them).
+        void Counter(std::string_view name, double value);
+
+    private:
+        TraceRecorder();
+        ~TraceRecorder() override { Stop(); }
+
+        void OnThreadEvents(const ProfileThreadTree& thread, const ProfileEvent* events, std::size_t count) override;
+        void OnFrameEnd(const ProfileFrame& frame) override;
+
+        bool IsRecording() const { return file_ && delayFrames_ == 0; }
+        void BeginEvent();
+        void AppendTime(std::uint64_t time);
+        void AppendThreadName(std::uint32_t thread, std::string_view name);
+        void FlushChunk(bool force);
+        void Close();
+
+        mutable std::mutex mutex_;
+        std::FILE* file_ = nullptr;
+        std::string path_;
+        std::string chunk_;
+        bool firstEvent_ = true;
+
+        std::uint64_t origin_ = 0;         // Profiler::Now() at the first recorded frame
+        std::uint64_t framesLeft_ = 0;     // 0 = unlimited
+        std::uint64_t delayFrames_ = 0;
+        std::vector<std::uint32_t> depth_; // Open zones per thread, to balance B/E
+        std::vector<bool> named_;
+    };
+}
+
+// ------------------------------------------------------------
+// Trace Macros
+// ------------------------------------------------------------
+#if AURUM_PROFILER
+    #define AURUM_TRACE_COUNTER(name, value) ::Aurum::TraceRecorder::Get().Counter(name, static_cast<double>(value))
+#else
+    #define AURUM_TRACE_COUNTER(name, value) do {} while (0)
+#endif
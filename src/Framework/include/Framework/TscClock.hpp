@@ -0,0 +1,151 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+#endif
+
+namespace Aurum
+{
+    // ---------------------------------------
+    // TSC Clock: cycle counter as a steady clock
+    // ---------------------------------------
+    // Reads the invariant TSC (rdtsc) on x86 or the virtual counter
+    // (cntvct_el0) on ARM64 and converts ticks to nanoseconds with a
+    // calibration against steady_clock. Satisfies the std::chrono clock
+    // requirements, so it plugs into the BasicXxxTimer templates in Timer.hpp.
+    //
+    // Calibration: a short measurement on first use, then Recalibrate()
+    // (called once per profiler frame; works at most once a second) refines
+    // the rate over the whole elapsed baseline and steers the mapping back
+    // onto steady_clock without ever jumping backwards. If the counter is
+    // not invariant, or its rate later drifts by more than 1%, every call
+    // falls back to steady_clock.
+    class TscClock
+    {
+    public:
+        using rep = std::int64_t;
+        using period = std::nano;
+        using duration = std::chrono::nanoseconds;
+        using time_point = std::chrono::time_point<TscClock>;
+        static constexpr bool is_steady = true;
+
+        static time_point now() noexcept
+        {
+            return time_point(duration(static_cast<rep>(NowNanoseconds())));
+        }
+
+        // Nanoseconds on steady_clock's epoch
+        static std::uint64_t NowNanoseconds() noexcept
+        {
+            const State& state = GetState();
+            if (!state.useTsc.load(std::memory_order_relaxed))
+                return SteadyNanoseconds();
+
+            // Seqlock read of the conversion parameters; the counter is read
+            // inside it so a reading older than a new baseline is retried
+            std::uint32_t seq;
+            std::uint64_t ticks, baseTicks, baseNs, scale;
+            do
+            {
+                seq = state.seq.load(std::memory_order_acquire);
+                baseTicks = state.baseTicks.load(std::memory_order_relaxed);
+                baseNs = state.baseNs.load(std::memory_order_relaxed);
+                scale = state.scale.load(std::memory_order_relaxed);
+                ticks = ReadTicks();
+                std::atomic_thread_fence(std::memory_order_acquire);
+            } while ((seq & 1) || seq != state.seq.load(std::memory_order_relaxed));
+
+            return ToNanoseconds(ticks, baseTicks, baseNs, scale);
+        }
+
+        static std::uint64_t ReadTicks() noexcept
+        {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+            return __rdtsc();
+#elif defined(__x86_64__) || defined(__i386__)
+            return __rdtsc();
+#elif defined(_MSC_VER) && defined(_M_ARM64)
+            return static_cast<std::uint64_t>(_ReadStatusReg(ARM64_CNTVCT));
+#elif defined(__aarch64__)
+            std::uint64_t ticks;
+            asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+            return ticks;
+#else
+            return SteadyNanoseconds();
+#endif
+        }
+
+        static std::uint64_t SteadyNanoseconds() noexcept
+        {
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+        // Hardware reports a constant-rate counter
+        static bool HasInvariantCounter();
+
+        static bool IsUsingTsc() { return GetState().useTsc.load(std::memory_order_relaxed); }
+        static double GetTicksPerSecond();
+
+        // Cheap to call every frame; does the work at most once a second
+        static void Recalibrate();
+
+        // Force the steady_clock fallback (false) or re-enable the counter
+        static void SetEnabled(bool enabled);
+
+    private:
+        struct State
+        {
+            State();
+
+            std::atomic<bool> useTsc{false};
+            std::atomic<std::uint32_t> seq{0};
+            std::atomic<std::uint64_t> baseTicks{0};
+            std::atomic<std::uint64_t> baseNs{0};
+            std::atomic<std::uint64_t> scale{0};   // Nanoseconds per tick, 32.32 fixed point
+
+            // --- Calibration baseline (writer side, under a mutex) ---
+            std::uint64_t originTicks = 0;
+            std::uint64_t originNs = 0;
+            std::uint64_t lastCheckNs = 0;
+            std::uint64_t intervalNs = 0;
+            std::uint64_t rateScale = 0;           // Measured rate, without steering
+            bool invariant = false;
+        };
+
+        static State& GetState()
+        {
+            static State state;
+            return state;
+        }
+
+        static std::uint64_t MulShift32(std::uint64_t value, std::uint64_t scale) noexcept
+        {
+#if defined(__SIZEOF_INT128__)
+            return static_cast<std::uint64_t>((static_cast<unsigned __int128>(value) * scale) >> 32);
+#elif defined(_MSC_VER) && defined(_M_X64)
+            std::uint64_t high;
+            const std::uint64_t low = _umul128(value, scale, &high);
+            return (high << 32) | (low >> 32);
+#else
+            return (value >> 32) * scale + (((value & 0xFFFFFFFFull) * scale) >> 32);
+#endif
+        }
+
+        // rdtsc is not ordered with the loads above and counters can differ
+        // slightly between cores, so a reading may land just before the
+        // baseline: clamp it there instead of wrapping to the far future
+        static std::uint64_t ToNanoseconds(std::uint64_t ticks, std::uint64_t baseTicks, std::uint64_t baseNs, std::uint64_t scale) noexcept
+        {
+            const auto elapsed = static_cast<std::int64_t>(ticks - baseTicks);
+            return elapsed > 0 ? baseNs + MulShift32(static_cast<std::uint64_t>(elapsed), scale) : baseNs;
+        }
+
+        static void Publish(State& state, std::uint64_t ticks, std::uint64_t ns, std::uint64_t scale);
+    };
+}
@@ -0,0 +1,222 @@
+#include <Framework/Math/BatchMath.hpp>
+#include "BatchMathKernels.hpp"
+#include <atomic>
+#include <cmath>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+    #include <immintrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+    #include <cpuid.h>
+#endif
+
+namespace Aurum
+{
+    namespace
+    {
+        using namespace BatchMathDetail;
+
+        // ---------------------------------------
+        // Scalar reference backend
+        // ---------------------------------------
+        struct ScalarOps
+        {
+            using V = float;
+            static constexpr std::size_t kWidth = 1;
+
+            static V Load(const float* p) { return *p; }
+            static void Store(float* p, V v) { *p = v; }
+            static V LoadPartial(const float* p, std::size_t) { return *p; }
+            static void StorePartial(float* p, V v, std::size_t) { *p = v; }
+            static V GatherMatrix(const float* base) { return *base; }
+            static V GatherMatrixPartial(const float* base, std::size_t) { return *base; }
+
+            static V Set1(float f) { return f; }
+            static V Add(V a, V b) { return a + b; }
+            static V Sub(V a, V b) { return a - b; }
+            static V Mul(V a, V b) { return a * b; }
+            static V Div(V a, V b) { return a / b; }
+            static V Sqrt(V a) { return std::sqrt(a); }
+            static V Abs(V a) { return std::abs(a); }
+            static V SelectGreater(V a, V threshold, V ifGreater, V otherwise) { return a > threshold ? ifGreater : otherwise; }
+        };
+
+        constexpr Kernels kScalarKernels = MakeKernels<ScalarOps>();
+
+        // ---------------------------------------
+        // CPU / OS feature detection
+        // ---------------------------------------
+        struct CpuFeatures
+        {
+            bool avx2 = false;
+            bool avx512 = false;
+        };
+
+        CpuFeatures DetectFeatures()
+        {
+            CpuFeatures features;
+#if (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))) || defined(__x86_64__) || defined(__i386__)
+            unsigned regs1[4] = {}, regs7[4] = {};
+    #if defined(_MSC_VER)
+            int r[4];
+            __cpuid(r, 0);
+            const unsigned maxLeaf = static_cast<unsigned>(r[0]);
+            __cpuid(r, 1);
+            for (int i = 0; i < 4; ++i) regs1[i] = static_cast<unsigned>(r[i]);
+            if (maxLeaf >= 7)
+            {
+                __cpuidex(r, 7, 0);
+                for (int i = 0; i < 4; ++i) regs7[i] = static_cast<unsigned>(r[i]);
+            }
+    #else
+            const unsigned maxLeaf = __get_cpuid_max(0, nullptr);
+            __get_cpuid(1, &regs1[0], &regs1[1], &regs1[2], &regs1[3]);
+            if (maxLeaf >= 7)
+                __cpuid_count(7, 0, regs7[0], regs7[1], regs7[2], regs7[3]);
+    #endif
+            // The OS must save the wider registers on context switch (XCR0)
+            const bool osxsave = (regs1[2] & (1u << 27)) != 0;
+            const bool avx = (regs1[2] & (1u << 28)) != 0;
+            if (!osxsave || !avx)
+                return features;
+    #if defined(_MSC_VER)
+            const unsigned long long xcr0 = _xgetbv(0);
+    #else
+            unsigned lo = 0, hi = 0;
+            __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+            const unsigned long long xcr0 = (static_cast<unsigned long long>(hi) << 32) | lo;
+    #endif
+            const bool ymmState = (xcr0 & 0x06) == 0x06;  // SSE + AVX
+            const bool zmmState = (xcr0 & 0xE6) == 0xE6;  // + opmask, ZMM0-15 high, ZMM16-31
+            features.avx2 = ymmState && (regs7[1] & (1u << 5)) != 0;
+            features.avx512 = features.avx2 && zmmState && (regs7[1] & (1u << 16)) != 0;
+#endif
+            return features;
+        }
+
+        const Kernels* KernelsFor(BatchMathBackend backend)
+        {
+            static const CpuFeatures features = DetectFeatures();
+            switch (backend)
+            {
+            case BatchMathBackend::Avx512: return features.avx512 ? GetAvx512Kernels() : nullptr;
+            case BatchMathBackend::Avx2: return features.avx2 ? GetAvx2Kernels() : nullptr;
+            case BatchMathBackend::Scalar: return &kScalarKernels;
+            }
+            return nullptr;
+        }
+
+        struct Dispatch
+        {
+            Dispatch()
+            {
+#if !AURUM_MATH_SCALAR
+                for (BatchMathBackend candidate : {BatchMathBackend::Avx512, BatchMathBackend::Avx2})
+                {
+                    if (const Kernels* found = KernelsFor(candidate))
+                    {
+                        kernels.store(found, std::memory_order_relaxed);
+                        backend.store(candidate, std::memory_order_relaxed);
+                        break;
+                    }
+                }
+#endif
+            }
+
+            std::atomic<const Kernels*> kernels{&kScalarKernels};
+            std::atomic<BatchMathBackend> backend{BatchMathBackend::Scalar};
+        };
+
+        Dispatch& GetDispatch()
+        {
+            static Dispatch dispatch;
+            return dispatch;
+        }
+
+        const Kernels& Active()
+        {
+            return *GetDispatch().kernels.load(std::memory_order_relaxed);
+        }
+    }
+
+    namespace BatchMath
+    {
+        // ------------------------------------------------------------
+        // Kernels
+        // ------------------------------------------------------------
+        void TransformPoints(const Matrix4x4& matrix, ConstFloat3Stream in, Float3Stream out, std::size_t count)
+        {
+            const float* src[3] = {in.x, in.y, in.z};
+            float* const dst[3] = {out.x, out.y, out.z};
+            Active().transformPoints(&matrix.m[0][0], src, dst, count);
+        }
+
+        void TransformPoints(const Matrix4x4* matrices, ConstFloat3Stream in, Float3Stream out, std::size_t count)
+        {
+            static_assert(sizeof(Matrix4x4) == 16 * sizeof(float), "Gathers step through Matrix4x4 arrays as float[16]");
+            const float* src[3] = {in.x, in.y, in.z};
+            float* const dst[3] = {out.x, out.y, out.z};
+            Active().transformPointsEach(reinterpret_cast<const float*>(matrices), src, dst, count);
+        }
+
+        void Normalize(ConstFloat3Stream in, Float3Stream out, std::size_t count)
+        {
+            const float* src[3] = {in.x, in.y, in.z};
+            float* const dst[3] = {out.x, out.y, out.z};
+            Active().normalize(src, dst, count);
+        }
+
+        void Rotate(ConstQuaternionStream rotations, ConstFloat3Stream in, Float3Stream out, std::size_t count)
+        {
+            const float* rot[4] = {rotations.w, rotations.x, rotations.y, rotations.z};
+            const float* src[3] = {in.x, in.y, in.z};
+            float* const dst[3] = {out.x, out.y, out.z};
+            Active().rotate(rot, src, dst, count);
+        }
+
+        void TransformAabbs(const Matrix4x4& matrix, ConstFloat3Stream mins, ConstFloat3Stream maxs,
+                            Float3Stream outMins, Float3Stream outMaxs, std::size_t count)
+        {
+            const float* lo[3] = {mins.x, mins.y, mins.z};
+            const float* hi[3] = {maxs.x, maxs.y, maxs.z};
+            float* const outLo[3] = {outMins.x, outMins.y, outMins.z};
+            float* const outHi[3] = {outMaxs.x, outMaxs.y, outMaxs.z};
+            Active().transformAabbs(&matrix.m[0][0], lo, hi, outLo, outHi, count);
+        }
+
+        // ------------------------------------------------------------
+        // Dispatch
+        // ------------------------------------------------------------
+        BatchMathBackend GetBackend()
+        {
+            return GetDispatch().backend.load(std::memory_order_relaxed);
+        }
+
+        const char* GetBackendName(BatchMathBackend backend)
+        {
+            switch (backend)
+            {
+            case BatchMathBackend::Avx512: return "AVX-512";
+            case BatchMathBackend::Avx2: return "AVX2";
+            case BatchMathBackend::Scalar: return "Scalar";
+            }
+            return "Unknown";
+        }
+
+        bool IsSupported(BatchMathBackend backend)
+        {
+            return KernelsFor(backend) != nullptr;
+        }
+
+        bool SetBackend(BatchMathBackend backend)
+        {
+            const Kernels* found = KernelsFor(backend);
+            if (!found)
+                return false;
+            Dispatch& dispatch = GetDispatch();
+            dispatch.kernels.store(found, std::memory_order_relaxed);
+            dispatch.backend.store(backend, std::memory_order_relaxed);
+            return true;
+        }
+    }
+}
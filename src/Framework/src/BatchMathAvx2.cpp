@@ -0,0 +1,57 @@
+// Built with -mavx2 / /arch:AVX2 (see CMakeLists.txt); only reached after
+// BatchMath.cpp has checked the CPU. Keep includes free of inline functions.
+#include "BatchMathKernels.hpp"
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+#endif
+
+namespace Aurum::BatchMathDetail
+{
+#if defined(__AVX2__)
+    namespace
+    {
+        struct Avx2Ops
+        {
+            using V = __m256;
+            static constexpr std::size_t kWidth = 8;
+
+            static __m256i TailMask(std::size_t count)
+            {
+                const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+                return _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int>(count)), lanes);
+            }
+
+            static V Load(const float* p) { return _mm256_loadu_ps(p); }
+            static void Store(float* p, V v) { _mm256_storeu_ps(p, v); }
+            static V LoadPartial(const float* p, std::size_t count) { return _mm256_maskload_ps(p, TailMask(count)); }
+            static void StorePartial(float* p, V v, std::size_t count) { _mm256_maskstore_ps(p, TailMask(count), v); }
+
+            static __m256i MatrixStride() { return _mm256_setr_epi32(0, 16, 32, 48, 64, 80, 96, 112); }
+            static V GatherMatrix(const float* base) { return _mm256_i32gather_ps(base, MatrixStride(), 4); }
+            static V GatherMatrixPartial(const float* base, std::size_t count)
+            {
+                return _mm256_mask_i32gather_ps(_mm256_setzero_ps(), base, MatrixStride(), _mm256_castsi256_ps(TailMask(count)), 4);
+            }
+
+            static V Set1(float f) { return _mm256_set1_ps(f); }
+            static V Add(V a, V b) { return _mm256_add_ps(a, b); }
+            static V Sub(V a, V b) { return _mm256_sub_ps(a, b); }
+            static V Mul(V a, V b) { return _mm256_mul_ps(a, b); }
+            static V Div(V a, V b) { return _mm256_div_ps(a, b); }
+            static V Sqrt(V a) { return _mm256_sqrt_ps(a); }
+            static V Abs(V a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+            static V SelectGreater(V a, V threshold, V ifGreater, V otherwise)
+            {
+                return _mm256_blendv_ps(otherwise, ifGreater, _mm256_cmp_ps(a, threshold, _CMP_GT_OQ));
+            }
+        };
+
+        constexpr Kernels kAvx2Kernels = MakeKernels<Avx2Ops>();
+    }
+
+    const Kernels* GetAvx2Kernels() { return &kAvx2Kernels; }
+#else
+    const Kernels* GetAvx2Kernels() { return nullptr; }
+#endif
+}
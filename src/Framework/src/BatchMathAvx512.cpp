@@ -0,0 +1,58 @@
+// Built with -mavx512f / /arch:AVX512 (see CMakeLists.txt); only reached
+// after BatchMath.cpp has checked the CPU. Keep includes free of inline functions.
+#include "BatchMathKernels.hpp"
+
+#if defined(__AVX512F__)
+    #include <immintrin.h>
+#endif
+
+namespace Aurum::BatchMathDetail
+{
+#if defined(__AVX512F__)
+    namespace
+    {
+        struct Avx512Ops
+        {
+            using V = __m512;
+            static constexpr std::size_t kWidth = 16;
+
+            // count = kWidth gives the full mask
+            static __mmask16 TailMask(std::size_t count) { return static_cast<__mmask16>((1u << count) - 1u); }
+
+            static V Load(const float* p) { return _mm512_loadu_ps(p); }
+            static void Store(float* p, V v) { _mm512_storeu_ps(p, v); }
+            static V LoadPartial(const float* p, std::size_t count) { return _mm512_maskz_loadu_ps(TailMask(count), p); }
+            static void StorePartial(float* p, V v, std::size_t count) { _mm512_mask_storeu_ps(p, TailMask(count), v); }
+
+            static __m512i MatrixStride()
+            {
+                return _mm512_setr_epi32(0, 16, 32, 48, 64, 80, 96, 112, 128, 144, 160, 176, 192, 208, 224, 240);
+            }
+            static V GatherMatrix(const float* base) { return GatherMatrixPartial(base, kWidth); }
+            static V GatherMatrixPartial(const float* base, std::size_t count)
+            {
+                return _mm512_mask_i32gather_ps(_mm512_setzero_ps(), TailMask(count), MatrixStride(), base, 4);
+            }
+
+            static V Set1(float f) { return _mm512_set1_ps(f); }
+            static V Add(V a, V b) { return _mm512_add_ps(a, b); }
+            static V Sub(V a, V b) { return _mm512_sub_ps(a, b); }
+            static V Mul(V a, V b) { return _mm512_mul_ps(a, b); }
+            static V Div(V a, V b) { return _mm512_div_ps(a, b); }
+            // Masked forms (here and GatherMatrix) avoid a GCC 12 false -Wmaybe-uninitialized
+            static V Sqrt(V a) { return _mm512_maskz_sqrt_ps(TailMask(kWidth), a); }
+            static V Abs(V a) { return _mm512_abs_ps(a); }
+            static V SelectGreater(V a, V threshold, V ifGreater, V otherwise)
+            {
+                return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(a, threshold, _CMP_GT_OQ), otherwise, ifGreater);
+            }
+        };
+
+        constexpr Kernels kAvx512Kernels = MakeKernels<Avx512Ops>();
+    }
+
+    const Kernels* GetAvx512Kernels() { return &kAvx512Kernels; }
+#else
+    const Kernels* GetAvx512Kernels() { return nullptr; }
+#endif
+}
@@ -0,0 +1,209 @@
+#pragma once
+#include <cstddef>
+
+// ------------------------------------------------------------
+// Batch math kernels, shared by every backend
+// ------------------------------------------------------------
+// Private to the Framework. Each backend translation unit defines an
+// Ops struct (register type, width, loads / stores / arithmetic) in an
+// anonymous namespace and instantiates these templates with it, so the
+// arithmetic is written once and every backend performs the same IEEE
+// operations in the same order.
+//
+// The AVX2 / AVX-512 units are compiled with those instruction sets but
+// run on any CPU's startup path, so they must not include headers with
+// inline functions (the linker could keep their AVX copy for everyone).
+// Hence plain pointers here rather than the types from BatchMath.hpp.
+namespace Aurum::BatchMathDetail
+{
+    // x / y / z (or w / x / y / z) component pointers
+    using ConstStreams = const float* const*;
+    using Streams = float* const*;
+
+    struct Kernels
+    {
+        void (*transformPoints)(const float* matrix, ConstStreams in, Streams out, std::size_t count);
+        void (*transformPointsEach)(const float* matrices, ConstStreams in, Streams out, std::size_t count);
+        void (*normalize)(ConstStreams in, Streams out, std::size_t count);
+        void (*rotate)(ConstStreams rotations, ConstStreams in, Streams out, std::size_t count);
+        void (*transformAabbs)(const float* matrix, ConstStreams mins, ConstStreams maxs,
+                               Streams outMins, Streams outMaxs, std::size_t count);
+    };
+
+    // nullptr when the backend was not compiled in (non-x86 targets)
+    const Kernels* GetAvx2Kernels();
+    const Kernels* GetAvx512Kernels();
+
+    // ---------------------------------------
+    // Lane access: full blocks and the tail
+    // ---------------------------------------
+    template <typename Ops>
+    struct FullLanes
+    {
+        using V = typename Ops::V;
+        V Load(const float* p) const { return Ops::Load(p); }
+        void Store(float* p, V v) const { Ops::Store(p, v); }
+        // Lane k reads base[16 * k]: one element of consecutive matrices
+        V Gather(const float* base) const { return Ops::GatherMatrix(base); }
+    };
+
+    template <typename Ops>
+    struct PartialLanes
+    {
+        using V = typename Ops::V;
+        std::size_t count;
+        V Load(const float* p) const { return Ops::LoadPartial(p, count); }
+        void Store(float* p, V v) const { Ops::StorePartial(p, v, count); }
+        V Gather(const float* base) const { return Ops::GatherMatrixPartial(base, count); }
+    };
+
+    template <typename Ops, typename Body>
+    inline void ForEachBlock(std::size_t count, Body&& body)
+    {
+        std::size_t i = 0;
+        for (; i + Ops::kWidth <= count; i += Ops::kWidth)
+            body(i, FullLanes<Ops>{});
+        if constexpr (Ops::kWidth > 1)
+        {
+            if (i < count)
+                body(i, PartialLanes<Ops>{count - i});
+        }
+    }
+
+    // ((x * m0 + y * m1) + z * m2) + m3, the order of MathScalar::TransformPoint
+    template <typename Ops, typename V = typename Ops::V>
+    inline V TransformComponent(V x, V y, V z, V m0, V m1, V m2, V m3)
+    {
+        return Ops::Add(Ops::Add(Ops::Add(Ops::Mul(x, m0), Ops::Mul(y, m1)), Ops::Mul(z, m2)), m3);
+    }
+
+    // a.y * b.z - a.z * b.y and rotations thereof, as in MathScalar::Cross
+    template <typename Ops, typename V = typename Ops::V>
+    inline V CrossComponent(V a1, V b2, V a2, V b1)
+    {
+        return Ops::Sub(Ops::Mul(a1, b2), Ops::Mul(a2, b1));
+    }
+
+    // ---------------------------------------
+    // Kernels
+    // ---------------------------------------
+    template <typename Ops>
+    void TransformPoints(const float* matrix, ConstStreams in, Streams out, std::size_t count)
+    {
+        using V = typename Ops::V;
+        V m[12];
+        for (int row = 0; row < 4; ++row)
+            for (int c = 0; c < 3; ++c)
+                m[3 * row + c] = Ops::Set1(matrix[4 * row + c]);
+
+        ForEachBlock<Ops>(count, [&](std::size_t i, auto lanes) {
+            const V x = lanes.Load(in[0] + i);
+            const V y = lanes.Load(in[1] + i);
+            const V z = lanes.Load(in[2] + i);
+            for (int c = 0; c < 3; ++c)
+                lanes.Store(out[c] + i, TransformComponent<Ops>(x, y, z, m[c], m[3 + c], m[6 + c], m[9 + c]));
+        });
+    }
+
+    template <typename Ops>
+    void TransformPointsEach(const float* matrices, ConstStreams in, Streams out, std::size_t count)
+    {
+        using V = typename Ops::V;
+        ForEachBlock<Ops>(count, [&](std::size_t i, auto lanes) {
+            const float* base = matrices + 16 * i;
+            const V x = lanes.Load(in[0] + i);
+            const V y = lanes.Load(in[1] + i);
+            const V z = lanes.Load(in[2] + i);
+            for (int c = 0; c < 3; ++c)
+            {
+                lanes.Store(out[c] + i, TransformComponent<Ops>(x, y, z,
+                    lanes.Gather(base + c), lanes.Gather(base + 4 + c), lanes.Gather(base + 8 + c), lanes.Gather(base + 12 + c)));
+            }
+        });
+    }
+
+    template <typename Ops>
+    void Normalize(ConstStreams in, Streams out, std::size_t count)
+    {
+        using V = typename Ops::V;
+        const V epsilon = Ops::Set1(1e-6f);
+        ForEachBlock<Ops>(count, [&](std::size_t i, auto lanes) {
+            const V x = lanes.Load(in[0] + i);
+            const V y = lanes.Load(in[1] + i);
+            const V z = lanes.Load(in[2] + i);
+            const V length = Ops::Sqrt(Ops::Add(Ops::Add(Ops::Mul(x, x), Ops::Mul(y, y)), Ops::Mul(z, z)));
+            lanes.Store(out[0] + i, Ops::SelectGreater(length, epsilon, Ops::Div(x, length), x));
+            lanes.Store(out[1] + i, Ops::SelectGreater(length, epsilon, Ops::Div(y, length), y));
+            lanes.Store(out[2] + i, Ops::SelectGreater(length, epsilon, Ops::Div(z, length), z));
+        });
+    }
+
+    // v' = v + w * t + q x t, with t = 2 * (q x v)
+    template <typename Ops>
+    void Rotate(ConstStreams rotations, ConstStreams in, Streams out, std::size_t count)
+    {
+        using V = typename Ops::V;
+        ForEachBlock<Ops>(count, [&](std::size_t i, auto lanes) {
+            const V qw = lanes.Load(rotations[0] + i);
+            const V qx = lanes.Load(rotations[1] + i);
+            const V qy = lanes.Load(rotations[2] + i);
+            const V qz = lanes.Load(rotations[3] + i);
+            const V x = lanes.Load(in[0] + i);
+            const V y = lanes.Load(in[1] + i);
+            const V z = lanes.Load(in[2] + i);
+
+            V tx = CrossComponent<Ops>(qy, z, qz, y);
+            V ty = CrossComponent<Ops>(qz, x, qx, z);
+            V tz = CrossComponent<Ops>(qx, y, qy, x);
+            tx = Ops::Add(tx, tx);
+            ty = Ops::Add(ty, ty);
+            tz = Ops::Add(tz, tz);
+
+            lanes.Store(out[0] + i, Ops::Add(Ops::Add(x, Ops::Mul(qw, tx)), CrossComponent<Ops>(qy, tz, qz, ty)));
+            lanes.Store(out[1] + i, Ops::Add(Ops::Add(y, Ops::Mul(qw, ty)), CrossComponent<Ops>(qz, tx, qx, tz)));
+            lanes.Store(out[2] + i, Ops::Add(Ops::Add(z, Ops::Mul(qw, tz)), CrossComponent<Ops>(qx, ty, qy, tx)));
+        });
+    }
+
+    // Arvo's method: transform the centre, extents through |M|
+    template <typename Ops>
+    void TransformAabbs(const float* matrix, ConstStreams mins, ConstStreams maxs, Streams outMins, Streams outMaxs, std::size_t count)
+    {
+        using V = typename Ops::V;
+        V m[12], a[9];
+        for (int row = 0; row < 4; ++row)
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                m[3 * row + c] = Ops::Set1(matrix[4 * row + c]);
+                if (row < 3)
+                    a[3 * row + c] = Ops::Abs(m[3 * row + c]);
+            }
+        }
+        const V half = Ops::Set1(0.5f);
+
+        ForEachBlock<Ops>(count, [&](std::size_t i, auto lanes) {
+            V centre[3], extent[3];
+            for (int c = 0; c < 3; ++c)
+            {
+                const V lo = lanes.Load(mins[c] + i);
+                const V hi = lanes.Load(maxs[c] + i);
+                centre[c] = Ops::Mul(Ops::Add(lo, hi), half);
+                extent[c] = Ops::Mul(Ops::Sub(hi, lo), half);
+            }
+            for (int c = 0; c < 3; ++c)
+            {
+                const V mid = TransformComponent<Ops>(centre[0], centre[1], centre[2], m[c], m[3 + c], m[6 + c], m[9 + c]);
+                const V radius = Ops::Add(Ops::Add(Ops::Mul(extent[0], a[c]), Ops::Mul(extent[1], a[3 + c])), Ops::Mul(extent[2], a[6 + c]));
+                lanes.Store(outMins[c] + i, Ops::Sub(mid, radius));
+                lanes.Store(outMaxs[c] + i, Ops::Add(mid, radius));
+            }
+        });
+    }
+
+    template <typename Ops>
+    constexpr Kernels MakeKernels()
+    {
+        return {&TransformPoints<Ops>, &TransformPointsEach<Ops>, &Normalize<Ops>, &Rotate<Ops>, &TransformAabbs<Ops>};
+    }
+}
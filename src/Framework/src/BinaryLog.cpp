@@ -0,0 +1,264 @@
+#include <Framework/Logging/BinaryLog.hpp>
+#include <Framework/Logging/LogFormat.hpp>
+#include <cstring>
+
+namespace Aurum
+{
+    namespace
+    {
+        template<typename T>
+        void AppendPod(std::string& out, const T& value)
+        {
+            char bytes[sizeof(T)];
+            std::memcpy(bytes, &value, sizeof(T));
+            out.append(bytes, sizeof(T));
+        }
+
+        constexpr std::size_t kReadChunkSize = 1 << 20;
+        constexpr std::uint64_t kMaxThreadId = 1 << 20;   // Guards the per-thread table against corrupt input
+    }
+
+    // ============================================================
+    // BinaryLogSink
+    // ============================================================
+    BinaryLogSink::BinaryLogSink(const std::string& path)
+    {
+        file_.open(path, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!file_.is_open())
+            return;
+
+        const LogClock::Anchor anchor = LogClock::Anchor::Capture();
+        lastTimestamps_ = BinaryLog::ThreadTimestamps(anchor.steadyNs);
+
+        std::string header;
+        header.append(BinaryLog::kMagic, sizeof(BinaryLog::kMagic));
+        AppendPod(header, BinaryLog::kVersion);
+        AppendPod(header, std::uint16_t{0});
+        AppendPod(header, std::uint32_t{0});
+        AppendPod(header, anchor.steadyNs);
+        AppendPod(header, anchor.wallNs);
+        file_.write(header.data(), static_cast<std::streamsize>(header.size()));
+    }
+
+    BinaryLogSink::~BinaryLogSink()
+    {
+        Flush();
+    }
+
+    void BinaryLogSink::Write(const LogRecord& record, std::string_view)
+    {
+        if (!file_.is_open())
+            return;
+
+        std::uint32_t formatId = BinaryLog::kPlainFormatId;
+        if (record.site)
+        {
+            formatId = GetLogSiteId(*record.site);
+            if (formatId >= writtenFormats_.size())
+                writtenFormats_.resize(formatId + 1, false);
+            if (!writtenFormats_[formatId])
+            {
+                WriteFormat(formatId, *record.site);
+                writtenFormats_[formatId] = true;
+            }
+        }
+
+        std::uint64_t& last = lastTimestamps_[record.threadId];
+        const auto delta = static_cast<std::int64_t>(record.timestamp - last);
+        last = record.timestamp;
+
+        buffer_ += static_cast<char>(static_cast<std::uint8_t>(BinaryLog::EntryKind::Record) |
+                                     (static_cast<std::uint8_t>(record.level) << 4));
+        BinaryLog::WriteVarint(buffer_, record.threadId);
+        BinaryLog::WriteVarint(buffer_, formatId);
+        BinaryLog::WriteVarint(buffer_, BinaryLog::ZigZagEncode(delta));
+        BinaryLog::WriteVarint(buffer_, record.payload.size());
+        buffer_ += record.payload;
+    }
+
+    void BinaryLogSink::WriteFormat(std::uint32_t id, const LogSite& site)
+    {
+        const std::string_view file = site.file ? site.file : "";
+        const std::string_view format = site.format ? site.format : "";
+
+        buffer_ += static_cast<char>(BinaryLog::EntryKind::Format);
+        BinaryLog::WriteVarint(buffer_, id);
+        buffer_ += static_cast<char>(site.level);
+        BinaryLog::WriteVarint(buffer_, static_cast<std::uint64_t>(site.line));
+        BinaryLog::WriteVarint(buffer_, file.size());
+        buffer_.append(file);
+        BinaryLog::WriteVarint(buffer_, format.size());
+        buffer_.append(format);
+    }
+
+    void BinaryLogSink::Flush()
+    {
+        if (!file_.is_open() || buffer_.empty())
+            return;
+
+        file_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+        file_.flush();
+        buffer_.clear();
+    }
+
+    // ============================================================
+    // BinaryLogReader
+    // ============================================================
+    bool BinaryLogReader::Open(const std::string& path)
+    {
+        file_.open(path, std::ios::in | std::ios::binary);
+        if (!file_.is_open())
+            return Fail("Cannot open " + path);
+
+        buffer_.clear();
+        pos_ = 0;
+        formats_.clear();
+
+        if (!Ensure(BinaryLog::kHeaderSize) ||
+            std::memcmp(buffer_.data(), BinaryLog::kMagic, sizeof(BinaryLog::kMagic)) != 0)
+            return Fail("Not an Aurum binary log: " + path);
+
+        std::uint16_t version = 0;
+        std::memcpy(&version, buffer_.data() + 8, sizeof(version));
+        if (version != BinaryLog::kVersion)
+            return Fail("Unsupported binary log version " + std::to_string(version));
+
+        std::memcpy(&anchor_.steadyNs, buffer_.data() + 16, sizeof(anchor_.steadyNs));
+        std::memcpy(&anchor_.wallNs, buffer_.data() + 24, sizeof(anchor_.wallNs));
+        lastTimestamps_ = BinaryLog::ThreadTimestamps(anchor_.steadyNs);
+        pos_ = BinaryLog::kHeaderSize;
+        return true;
+    }
+
+    bool BinaryLogReader::Next(BinaryLogEntry& out)
+    {
+        for (;;)
+        {
+            std::uint8_t head = 0;
+            if (!ReadByte(head))
+                return false; // Clean end of file
+            const std::uint8_t kind = head & 0x0F;
+
+            if (kind == static_cast<std::uint8_t>(BinaryLog::EntryKind::Format))
+            {
+                std::uint64_t id = 0, line = 0, length = 0;
+                std::uint8_t level = 0;
+                std::string_view file, format;
+
+                if (!ReadVarint(id) || !ReadByte(level) || !ReadVarint(line))
+                    return Fail("Truncated format entry");
+                if (!ReadVarint(length) || !ReadBytes(length, file))
+                    return Fail("Truncated format entry");
+
+                BinaryLogFormat entry;
+                entry.level = static_cast<LogLevel>(level);
+                entry.line = static_cast<std::uint32_t>(line);
+                entry.file = std::string(file);
+
+                if (!ReadVarint(length) || !ReadBytes(length, format))
+                    return Fail("Truncated format entry");
+                entry.format = std::string(format);
+
+                formats_[static_cast<std::uint32_t>(id)] = std::move(entry);
+                continue;
+            }
+
+            if (kind != static_cast<std::uint8_t>(BinaryLog::EntryKind::Record))
+                return Fail("Unknown entry kind " + std::to_string(kind));
+
+            std::uint64_t threadId = 0, formatId = 0, delta = 0, length = 0;
+            if (!ReadVarint(threadId) || !ReadVarint(formatId) || !ReadVarint(delta) ||
+                !ReadVarint(length) || !ReadBytes(length, out.args))
+                return Fail("Truncated record");
+            if (threadId > kMaxThreadId)
+                return Fail("Record thread id out of range " + std::to_string(threadId));
+
+            std::uint64_t& last = lastTimestamps_[static_cast<std::uint32_t>(threadId)];
+            last += static_cast<std::uint64_t>(BinaryLog::ZigZagDecode(delta));
+
+            out.level = static_cast<LogLevel>(head >> 4);
+            out.timestamp = last;
+            out.wallNs = anchor_.ToWallNs(last);
+            out.threadId = static_cast<std::uint32_t>(threadId);
+            out.format = nullptr;
+
+            if (formatId != BinaryLog::kPlainFormatId)
+            {
+                auto it = formats_.find(static_cast<std::uint32_t>(formatId));
+                if (it == formats_.end())
+                    return Fail("Record refers to unknown format " + std::to_string(formatId));
+                out.format = &it->second;
+            }
+            return true;
+        }
+    }
+
+    void BinaryLogReader::FormatMessage(const BinaryLogEntry& entry, std::string& out)
+    {
+        if (entry.format)
+            FormatLogMessage(out, entry.format->format, entry.args);
+        else
+            out.append(entry.args);
+    }
+
+    // ------------------------------------------------------------
+    // Buffered input helpers
+    // ------------------------------------------------------------
+    bool BinaryLogReader::Ensure(std::size_t bytes)
+    {
+        if (buffer_.size() - pos_ >= bytes)
+            return true;
+
+        // Drop consumed bytes, then read at least what is missing
+        buffer_.erase(0, pos_);
+        pos_ = 0;
+
+        while (buffer_.size() < bytes && file_)
+        {
+            const std::size_t oldSize = buffer_.size();
+            const std::size_t want = (bytes - oldSize) > kReadChunkSize ? (bytes - oldSize) : kReadChunkSize;
+            buffer_.resize(oldSize + want);
+            file_.read(buffer_.data() + oldSize, static_cast<std::streamsize>(want));
+            buffer_.resize(oldSize + static_cast<std::size_t>(file_.gcount()));
+        }
+        return buffer_.size() >= bytes;
+    }
+
+    bool BinaryLogReader::ReadByte(std::uint8_t& value)
+    {
+        if (!Ensure(1))
+            return false;
+        value = static_cast<std::uint8_t>(buffer_[pos_++]);
+        return true;
+    }
+
+    bool BinaryLogReader::ReadVarint(std::uint64_t& value)
+    {
+        value = 0;
+        for (int shift = 0; shift < 64; shift += 7)
+        {
+            std::uint8_t byte = 0;
+            if (!ReadByte(byte))
+                return false;
+            value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0)
+                return true;
+        }
+        return false;
+    }
+
+    bool BinaryLogReader::ReadBytes(std::size_t length, std::string_view& out)
+    {
+        if (!Ensure(length))
+            return false;
+        out = std::string_view(buffer_.data() + pos_, length);
+        pos_ += length;
+        return true;
+    }
+
+    bool BinaryLogReader::Fail(const std::string& message)
+    {
+        error_ = message;
+        return false;
+    }
+}
@@ -0,0 +1,112 @@
+#include <Framework/CallStack.hpp>
+#include <algorithm>
+#include <cstdio>
+
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+    #include <dbghelp.h>
+    #include <mutex>
+#elif defined(__unix__) || defined(__APPLE__)
+    #include <cxxabi.h>
+    #include <dlfcn.h>
+    #include <execinfo.h>
+    #include <cstdlib>
+#endif
+
+namespace Aurum::CallStack
+{
+    std::size_t Capture(void** frames, std::size_t maxFrames, std::size_t skip)
+    {
+#if defined(_WIN32)
+        return RtlCaptureStackBackTrace(static_cast<DWORD>(skip + 1), static_cast<DWORD>(maxFrames), frames, nullptr);
+#elif defined(__unix__) || defined(__APPLE__)
+        void* buffer[kMaxFrames + 8];
+        const std::size_t wanted = std::min<std::size_t>(maxFrames + skip + 1, sizeof(buffer) / sizeof(buffer[0]));
+        const int captured = backtrace(buffer, static_cast<int>(wanted));
+        std::size_t count = 0;
+        for (int i = static_cast<int>(skip) + 1; i < captured && count < maxFrames; ++i)
+            frames[count++] = buffer[i];
+        return count;
+#else
+        (void)frames; (void)maxFrames; (void)skip;
+        return 0;
+#endif
+    }
+
+    std::uint64_t Hash(void* const* frames, std::size_t count)
+    {
+        std::uint64_t hash = 14695981039346656037ull;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            hash ^= reinterpret_cast<std::uintptr_t>(frames[i]);
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    std::string Symbolize(void* address)
+    {
+        char buffer[512];
+#if defined(_WIN32)
+        // DbgHelp is single-threaded
+        static std::mutex mutex;
+        static const bool initialized = [] {
+            SymSetOptions(SYMOPT_UNDNAME | SYMOPT_DEFERRED_LOADS);
+            return SymInitialize(GetCurrentProcess(), nullptr, TRUE) != FALSE;
+        }();
+        std::lock_guard<std::mutex> lock(mutex);
+
+        alignas(SYMBOL_INFO) char storage[sizeof(SYMBOL_INFO) + 256];
+        auto* symbol = reinterpret_cast<SYMBOL_INFO*>(storage);
+        symbol->SizeOfStruct = sizeof(SYMBOL_INFO);
+        symbol->MaxNameLen = 255;
+        DWORD64 displacement = 0;
+        const DWORD64 pc = reinterpret_cast<DWORD64>(address);
+        if (initialized && SymFromAddr(GetCurrentProcess(), pc, &displacement, symbol))
+        {
+            IMAGEHLP_LINE64 line{};
+            line.SizeOfStruct = sizeof(line);
+            DWORD lineDisplacement = 0;
+            if (SymGetLineFromAddr64(GetCurrentProcess(), pc, &lineDisplacement, &line))
+                std::snprintf(buffer, sizeof(buffer), "%s (%s:%lu)", symbol->Name, line.FileName, line.LineNumber);
+            else
+                std::snprintf(buffer, sizeof(buffer), "%s+0x%llx", symbol->Name, static_cast<unsigned long long>(displacement));
+            return buffer;
+        }
+#elif defined(__unix__) || defined(__APPLE__)
+        Dl_info info{};
+        if (dladdr(address, &info) && info.dli_fname)
+        {
+            const char* module = info.dli_fname;
+            for (const char* c = info.dli_fname; *c; ++c)
+            {
+                if (*c == '/')
+                    module = c + 1;
+            }
+
+            const auto offset = reinterpret_cast<std::uintptr_t>(address) - reinterpret_cast<std::uintptr_t>(info.dli_fbase);
+            if (info.dli_sname)
+            {
+                int status = 0;
+                char* demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+                std::snprintf(buffer, sizeof(buffer), "%s (%s+0x%llx)", status == 0 ? demangled : info.dli_sname,
+                              module, static_cast<unsigned long long>(offset));
+                std::free(demangled);
+            }
+            else
+            {
+                std::snprintf(buffer, sizeof(buffer), "%s+0x%llx", module, static_cast<unsigned long long>(offset));
+            }
+            return buffer;
+        }
+#endif
+        std::snprintf(buffer, sizeof(buffer), "%p", address);
+        return buffer;
+    }
+}
@@ -0,0 +1,337 @@
+#include <Framework/ConfigBlob.hpp>
+#include <Framework/Logger.hpp>
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <system_error>
+#include <vector>
+
+namespace Aurum
+{
+    namespace
+    {
+        constexpr char kMagic[8] = { 'A', 'U', 'R', 'U', 'M', 'C', 'F', 'G' };
+
+        struct BlobBuilder
+        {
+            std::vector<ConfigBlob::Entry> entries;
+            std::vector<std::uint8_t> ranks;   // Per entry, see Rank
+            std::string pool;
+            std::string path;                  // Dotted path of the node being visited
+        };
+
+        // Which of two entries with the same dotted path a json tree lookup
+        // finds: a path whose segments hold no '.' resolves directly, a
+        // top-level literal "a.b" only through the flat fallback
+        enum Rank : std::uint8_t { kNested = 0, kFlat = 1 };
+
+        ConfigBlob::Entry MakeEntry(const json& value, std::uint64_t keyHash, std::string& pool)
+        {
+            ConfigBlob::Entry entry{ keyHash, ConfigValueType::Null, 0, 0, 0, 0 };
+
+            auto storeDouble = [&](double d)
+            {
+                entry.type = ConfigValueType::Double;
+                std::memcpy(&entry.value, &d, sizeof(d));
+            };
+
+            switch (value.type())
+            {
+                case json::value_t::boolean:
+                    entry.type = ConfigValueType::Bool;
+                    entry.value = value.get<bool>() ? 1 : 0;
+                    break;
+                case json::value_t::number_integer:
+                    entry.type = ConfigValueType::Int;
+                    entry.value = static_cast<std::uint64_t>(value.get<std::int64_t>());
+                    break;
+                case json::value_t::number_unsigned:
+                {
+                    const auto u = value.get<std::uint64_t>();
+                    if (u <= static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max()))
+                    {
+                        entry.type = ConfigValueType::Int;
+                        entry.value = u;
+                    }
+                    else
+                    {
+                        storeDouble(static_cast<double>(u));
+                    }
+                    break;
+                }
+                case json::value_t::number_float:
+                    storeDouble(value.get<double>());
+                    break;
+                case json::value_t::string:
+                {
+                    const auto& text = value.get_ref<const std::string&>();
+                    entry.type = ConfigValueType::String;
+                    entry.value = pool.size();
+                    entry.length = static_cast<std::uint32_t>(text.size());
+                    pool += text;
+                    break;
+                }
+                case json::value_t::array:
+                    entry.type = ConfigValueType::Array;
+                    entry.length = static_cast<std::uint32_t>(value.size());
+                    break;
+                case json::value_t::object:
+                    entry.type = ConfigValueType::Object;
+                    entry.length = static_cast<std::uint32_t>(value.size());
+                    break;
+                default:
+                    break;
+            }
+            return entry;
+        }
+
+        // Same hashing as ConfigKey: segments joined by '.', root excluded.
+        // Only paths a json lookup can reach are stored: Resolve splits every
+        // '.', and the flat fallback only matches a whole top-level key, so a
+        // dotted key below the root, or anything under a dotted key, is
+        // skipped ({"a.b": {"c": 5}} has no "a.b.c").
+        void Flatten(const json& node, std::uint64_t hash, bool isRoot, BlobBuilder& builder)
+        {
+            auto visit = [&](std::string_view segment, const json& child)
+            {
+                const bool dotted = segment.find('.') != std::string_view::npos;
+                if (dotted && !isRoot)
+                    return;
+
+                std::uint64_t childHash = isRoot ? ConfigPath::kHashSeed : ConfigPath::HashAppend(hash, ".");
+                childHash = ConfigPath::HashAppend(childHash, segment);
+
+                const std::size_t parentLength = builder.path.size();
+                if (!isRoot)
+                    builder.path += '.';
+                builder.path += segment;
+
+                ConfigBlob::Entry entry = MakeEntry(child, childHash, builder.pool);
+                entry.keyOffset = static_cast<std::uint32_t>(builder.pool.size());
+                entry.keyLength = static_cast<std::uint32_t>(builder.path.size());
+                builder.pool += builder.path;
+                builder.entries.push_back(entry);
+                builder.ranks.push_back(dotted ? kFlat : kNested);
+
+                if (child.is_structured() && !dotted)
+                    Flatten(child, childHash, false, builder);
+                builder.path.resize(parentLength);
+            };
+
+            if (node.is_object())
+            {
+                for (auto it = node.begin(); it != node.end(); ++it)
+                    visit(it.key(), it.value());
+            }
+            else if (node.is_array())
+            {
+                char index[24];
+                for (std::size_t i = 0; i < node.size(); ++i)
+                {
+                    const auto result = std::to_chars(index, index + sizeof(index), i);
+                    visit(std::string_view(index, static_cast<std::size_t>(result.ptr - index)), node[i]);
+                }
+            }
+        }
+    }
+
+    // ------------------------------------------------------------
+    // Compile
+    // ------------------------------------------------------------
+    bool ConfigBlob::Compile(const json& data, std::uint64_t sourceHash, std::uint64_t sourceSize,
+                             const std::string& path)
+    {
+        BlobBuilder builder;
+        Flatten(data, 0, true, builder);
+
+        // Sort by hash, then path, then rank, so equal paths are adjacent
+        // with the one a tree lookup would find first
+        auto key = [&](const Entry& entry) { return std::string_view(builder.pool).substr(entry.keyOffset, entry.keyLength); };
+        std::vector<std::size_t> order(builder.entries.size());
+        for (std::size_t i = 0; i < order.size(); ++i)
+            order[i] = i;
+        std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b)
+        {
+            const Entry& ea = builder.entries[a];
+            const Entry& eb = builder.entries[b];
+            if (ea.keyHash != eb.keyHash)
+                return ea.keyHash < eb.keyHash;
+            const int byKey = key(ea).compare(key(eb));
+            return byKey != 0 ? byKey < 0 : builder.ranks[a] < builder.ranks[b];
+        });
+
+        // A hash shared by different paths is fine (Find compares the path);
+        // the same path twice keeps only the first
+        std::vector<Entry> entries;
+        entries.reserve(order.size());
+        for (std::size_t i : order)
+        {
+            const Entry& entry = builder.entries[i];
+            if (!entries.empty() && entries.back().keyHash == entry.keyHash && key(entries.back()) == key(entry))
+            {
+                Logger::Get().Log("Config key '" + std::string(key(entry)) + "' is defined twice in " + path +
+                                  "; using the nested value", LogLevel::Warning);
+                continue;
+            }
+            entries.push_back(entry);
+        }
+        builder.entries = std::move(entries);
+
+        const std::string document = data.dump();
+
+        Header header{};
+        std::memcpy(header.magic, kMagic, sizeof(kMagic));
+        header.version = kVersion;
+        header.entryCount = static_cast<std::uint32_t>(builder.entries.size());
+        header.sourceHash = sourceHash;
+        header.sourceSize = sourceSize;
+        header.poolOffset = sizeof(Header) + builder.entries.size() * sizeof(Entry);
+        header.poolSize = builder.pool.size() + document.size();
+        header.documentOffset = builder.pool.size();
+        header.documentSize = document.size();
+
+        // Write next to the target and rename, so a reader never maps a half-written blob
+        const std::string tempPath = path + ".tmp";
+        bool written = false;
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            if (!file.is_open())
+                return false;
+
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(reinterpret_cast<const char*>(builder.entries.data()),
+                       static_cast<std::streamsize>(builder.entries.size() * sizeof(Entry)));
+            file.write(builder.pool.data(), static_cast<std::streamsize>(builder.pool.size()));
+            file.write(document.data(), static_cast<std::streamsize>(document.size()));
+            written = file.good();
+        }
+
+        std::error_code ec;
+        if (written)
+            std::filesystem::rename(tempPath, path, ec);
+        if (!written || ec)
+        {
+            std::filesystem::remove(tempPath, ec);
+            return false;
+        }
+        return true;
+    }
+
+    // ------------------------------------------------------------
+    // Open / Lookup
+    // ------------------------------------------------------------
+    bool ConfigBlob::Open(const std::string& path)
+    {
+        Close();
+        if (!file_.Open(path, MappedFile::Mode::Read) || file_.Size() < sizeof(Header))
+        {
+            Close();
+            return false;
+        }
+
+        const std::uint8_t* base = file_.Data();
+        const auto* header = reinterpret_cast<const Header*>(base);
+        const std::uint64_t size = file_.Size();
+
+        const bool valid =
+            std::memcmp(header->magic, kMagic, sizeof(kMagic)) == 0 &&
+            header->version == kVersion &&
+            header->poolOffset >= sizeof(Header) + std::uint64_t(header->entryCount) * sizeof(Entry) &&
+            header->poolOffset <= size && header->poolSize <= size - header->poolOffset &&
+            header->documentOffset <= header->poolSize &&
+            header->documentSize <= header->poolSize - header->documentOffset &&
+            header->poolSize <= std::numeric_limits<std::uint32_t>::max();
+        if (!valid)
+        {
+            Close();
+            return false;
+        }
+
+        header_ = header;
+        entries_ = reinterpret_cast<const Entry*>(base + sizeof(Header));
+        pool_ = reinterpret_cast<const char*>(base + header->poolOffset);
+        count_ = header->entryCount;
+
+        // String views handed out later must stay inside the pool
+        for (std::size_t i = 0; i < count_; ++i)
+        {
+            const Entry& entry = entries_[i];
+            const bool badString = entry.type == ConfigValueType::String &&
+                (entry.value > header->poolSize || entry.length > header->poolSize - entry.value);
+            const bool badKey = entry.keyOffset > header->poolSize || entry.keyLength > header->poolSize - entry.keyOffset;
+            if (badString || badKey)
+            {
+                Close();
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void ConfigBlob::Close()
+    {
+        file_.Close();
+        header_ = nullptr;
+        entries_ = nullptr;
+        pool_ = nullptr;
+        count_ = 0;
+    }
+
+    const ConfigBlob::Entry* ConfigBlob::Find(std::uint64_t keyHash, std::string_view dottedPath) const
+    {
+        const Entry* end = entries_ + count_;
+        const Entry* it = std::lower_bound(entries_, end, keyHash,
+            [](const Entry& entry, std::uint64_t hash) { return entry.keyHash < hash; });
+        for (; it != end && it->keyHash == keyHash; ++it)
+        {
+            if (GetKey(*it) == dottedPath)
+                return it;
+        }
+        return nullptr;
+    }
+
+    const ConfigBlob::Entry* ConfigBlob::Find(std::string_view path) const
+    {
+        if (!ConfigPath::IsPointer(path))
+            return Find(ConfigPath::HashDotted(path), path);
+
+        // Pointer spelling: the stored path is the segments joined by '.'
+        std::string dotted;
+        std::string scratch;
+        bool first = true;
+        ConfigPath::ForEachSegment(path, scratch, [&](std::string_view segment)
+        {
+            if (!first)
+                dotted += '.';
+            first = false;
+            dotted += segment;
+            return true;
+        });
+        return Find(ConfigPath::HashDotted(dotted), dotted);
+    }
+
+    const ConfigBlob::Entry* ConfigBlob::Find(const ConfigKey& key) const
+    {
+        if (!key.IsPointer())
+            return Find(key.Hash(), key.Path());
+
+        std::string dotted;
+        for (std::size_t i = 0; i < key.Depth(); ++i)
+        {
+            if (i > 0)
+                dotted += '.';
+            dotted += key.Segment(i);
+        }
+        return Find(key.Hash(), dotted);
+    }
+
+    double ConfigBlob::AsDouble(const Entry& entry)
+    {
+        double d;
+        std::memcpy(&d, &entry.value, sizeof(d));
+        return d;
+    }
+}
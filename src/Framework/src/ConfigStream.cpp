@@ -0,0 +1,565 @@
+#include <Framework/ConfigStream.hpp>
+#include <Framework/MappedFile.hpp>
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <iterator>
+#include <mutex>
+#include <thread>
+
+namespace Aurum
+{
+    namespace
+    {
+        constexpr std::size_t kNpos = std::string_view::npos;
+
+        // ------------------------------------------------------------
+        // Structural Scan
+        // ------------------------------------------------------------
+        // Finds byte ranges without building values. Only strings and
+        // brackets are tracked; the real parse validates everything else.
+        bool IsSpace(char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; }
+
+        std::size_t SkipSpace(std::string_view text, std::size_t i)
+        {
+            while (i < text.size() && IsSpace(text[i]))
+                ++i;
+            return i;
+        }
+
+        // i points at the opening quote; returns the index after the closing one
+        std::size_t SkipString(std::string_view text, std::size_t i)
+        {
+            for (++i; i < text.size(); ++i)
+            {
+                if (text[i] == '\\')
+                    ++i;
+                else if (text[i] == '"')
+                    return i + 1;
+            }
+            return kNpos;
+        }
+
+        std::size_t SkipValue(std::string_view text, std::size_t i)
+        {
+            if (i >= text.size())
+                return kNpos;
+
+            if (text[i] == '"')
+                return SkipString(text, i);
+
+            if (text[i] == '{' || text[i] == '[')
+            {
+                int depth = 0;
+                while (i < text.size())
+                {
+                    const char c = text[i];
+                    if (c == '"')
+                    {
+                        i = SkipString(text, i);
+                        if (i == kNpos)
+                            return kNpos;
+                        continue;
+                    }
+                    if (c == '{' || c == '[')
+                        ++depth;
+                    else if ((c == '}' || c == ']') && --depth == 0)
+                        return i + 1;
+                    ++i;
+                }
+                return kNpos;
+            }
+
+            while (i < text.size() && !IsSpace(text[i]) && text[i] != ',' && text[i] != '}' && text[i] != ']')
+                ++i;
+            return i;
+        }
+
+        struct ArrayRegion
+        {
+            std::size_t route = 0;
+            std::size_t begin = 0; // '['
+            std::size_t end = 0;   // One past ']'
+            std::vector<std::pair<std::size_t, std::size_t>> elements;
+        };
+
+        // Element ranges of the array starting at text[i] == '['
+        bool SplitArray(std::string_view text, std::size_t i, ArrayRegion& region)
+        {
+            region.begin = i;
+            std::size_t j = SkipSpace(text, i + 1);
+            if (j < text.size() && text[j] == ']')
+            {
+                region.end = j + 1;
+                return true;
+            }
+
+            while (j < text.size())
+            {
+                const std::size_t start = j;
+                j = SkipValue(text, j);
+                if (j == kNpos || j == start)
+                    return false;
+                region.elements.emplace_back(start, j);
+
+                j = SkipSpace(text, j);
+                if (j >= text.size())
+                    return false;
+                if (text[j] == ']')
+                {
+                    region.end = j + 1;
+                    return true;
+                }
+                if (text[j] != ',')
+                    return false;
+                j = SkipSpace(text, j + 1);
+            }
+            return false;
+        }
+
+        // Walks the members of the top-level object and splits the arrays
+        // whose key is in keys[] (keys[n] belongs to route routeOf[n]).
+        std::vector<ArrayRegion> FindTopLevelArrays(std::string_view text,
+                                                    const std::vector<std::string_view>& keys,
+                                                    const std::vector<std::size_t>& routeOf)
+        {
+            std::vector<ArrayRegion> regions;
+            std::size_t i = SkipSpace(text, 0);
+            if (i >= text.size() || text[i] != '{')
+                return {};
+            ++i;
+
+            while (true)
+            {
+                i = SkipSpace(text, i);
+                if (i >= text.size() || text[i] == '}' || text[i] != '"')
+                    break;
+
+                const std::size_t keyEnd = SkipString(text, i);
+                if (keyEnd == kNpos)
+                    return {};
+                const std::string_view key = text.substr(i + 1, keyEnd - i - 2);
+
+                i = SkipSpace(text, keyEnd);
+                if (i >= text.size() || text[i] != ':')
+                    return {};
+                i = SkipSpace(text, i + 1);
+
+                const auto match = std::find(keys.begin(), keys.end(), key);
+                if (match != keys.end() && i < text.size() && text[i] == '[')
+                {
+                    ArrayRegion region;
+                    region.route = routeOf[static_cast<std::size_t>(match - keys.begin())];
+                    if (!SplitArray(text, i, region))
+                        return {};
+                    i = region.end;
+                    regions.push_back(std::move(region));
+                }
+                else
+                {
+                    i = SkipValue(text, i);
+                    if (i == kNpos)
+                        return {};
+                }
+
+                i = SkipSpace(text, i);
+                if (i < text.size() && text[i] == ',')
+                    ++i;
+            }
+            return regions;
+        }
+
+        // ------------------------------------------------------------
+        // Skipping Input
+        // ------------------------------------------------------------
+        // Presents the document with every split array replaced by "[]",
+        // so the sequential pass does not parse what the workers handle.
+        struct Piece
+        {
+            const char* begin;
+            const char* end;
+        };
+
+        class PieceIterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = char;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const char*;
+            using reference = const char&;
+
+            PieceIterator() = default;
+            PieceIterator(const Piece* piece, const Piece* last) : piece_(piece), last_(last)
+            {
+                SkipEmpty();
+            }
+
+            reference operator*() const { return *current_; }
+
+            PieceIterator& operator++()
+            {
+                if (++current_ == piece_->end)
+                {
+                    ++piece_;
+                    SkipEmpty();
+                }
+                return *this;
+            }
+
+            PieceIterator operator++(int)
+            {
+                PieceIterator copy = *this;
+                ++*this;
+                return copy;
+            }
+
+            bool operator==(const PieceIterator& other) const { return piece_ == other.piece_ && current_ == other.current_; }
+            bool operator!=(const PieceIterator& other) const { return !(*this == other); }
+
+        private:
+            void SkipEmpty()
+            {
+                while (piece_ != last_ && piece_->begin == piece_->end)
+                    ++piece_;
+                current_ = (piece_ != last_) ? piece_->begin : nullptr;
+            }
+
+            const Piece* piece_ = nullptr;
+            const Piece* last_ = nullptr;
+            const char* current_ = nullptr;
+        };
+
+        // ------------------------------------------------------------
+        // SAX Router
+        // ------------------------------------------------------------
+        // Tracks the dotted path of the current value and builds a json
+        // value only while inside a sub-tree that matches a route.
+        template<typename RouteList>
+        class SaxRouter
+        {
+        public:
+            SaxRouter(const RouteList& routes, ConfigReport& report) : routes_(routes), report_(report) {}
+
+            bool null() { return Value(json(nullptr)); }
+            bool boolean(bool val) { return Value(json(val)); }
+            bool number_integer(json::number_integer_t val) { return Value(json(val)); }
+            bool number_unsigned(json::number_unsigned_t val) { return Value(json(val)); }
+            bool number_float(json::number_float_t val, const std::string&) { return Value(json(val)); }
+            bool string(std::string& val) { return Value(json(std::move(val))); }
+            bool binary(json::binary_t& val) { return Value(json(std::move(val))); }
+
+            bool key(std::string& val)
+            {
+                if (captureDepth_ > 0)
+                    buildKey_ = std::move(val);
+                else
+                    pendingKey_ = std::move(val);
+                return true;
+            }
+
+            bool start_object(std::size_t) { return StartContainer(false); }
+            bool start_array(std::size_t) { return StartContainer(true); }
+            bool end_object() { return EndContainer(); }
+            bool end_array() { return EndContainer(); }
+
+            bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& ex)
+            {
+                report_.Add(path_.empty() ? "<root>" : path_, ex.what());
+                return false;
+            }
+
+        private:
+            struct Frame
+            {
+                bool isArray;
+                std::size_t nextIndex;
+                std::uint64_t hash;
+                std::size_t pathLength; // path_ size before this container's segment
+            };
+
+            // Appends the segment of the value about to start; returns the route it matches
+            std::size_t BeginValue(std::uint64_t& hash)
+            {
+                if (frames_.empty())
+                {
+                    hash = ConfigPath::kHashSeed;
+                    return MatchRoute(hash, nullptr);
+                }
+
+                Frame& parent = frames_.back();
+                std::string_view segment = pendingKey_;
+                char index[24];
+                if (parent.isArray)
+                {
+                    const auto result = std::to_chars(index, index + sizeof(index), parent.nextIndex++);
+                    segment = std::string_view(index, static_cast<std::size_t>(result.ptr - index));
+                }
+
+                hash = (frames_.size() == 1) ? ConfigPath::kHashSeed : ConfigPath::HashAppend(parent.hash, ".");
+                hash = ConfigPath::HashAppend(hash, segment);
+
+                if (!path_.empty())
+                    path_ += '.';
+                path_.append(segment);
+                return MatchRoute(hash, &parent);
+            }
+
+            std::size_t MatchRoute(std::uint64_t hash, const Frame* parent) const
+            {
+                for (std::size_t r = 0; r < routes_.size(); ++r)
+                {
+                    const auto& route = routes_[r];
+                    if (route.eachChild ? (parent && parent->hash == route.hash) : (route.hash == hash))
+                        return r;
+                }
+                return kNpos;
+            }
+
+            void Dispatch(std::size_t route, json& value)
+            {
+                try
+                {
+                    routes_[route].handler(path_, value);
+                }
+                catch (const std::exception& e)
+                {
+                    report_.Add(path_, std::string("handler failed: ") + e.what());
+                }
+            }
+
+            // Adds a value to the sub-tree being built; returns it
+            json* Build(json&& value)
+            {
+                json* top = buildStack_.back();
+                if (top->is_array())
+                {
+                    top->push_back(std::move(value));
+                    return &top->back();
+                }
+                json& slot = (*top)[buildKey_];
+                slot = std::move(value);
+                return &slot;
+            }
+
+            bool Value(json&& value)
+            {
+                if (captureDepth_ > 0)
+                {
+                    Build(std::move(value));
+                    return true;
+                }
+
+                const std::size_t pathLength = path_.size();
+                std::uint64_t hash = 0;
+                const std::size_t route = BeginValue(hash);
+                if (route != kNpos)
+                    Dispatch(route, value);
+                path_.resize(pathLength);
+                return true;
+            }
+
+            bool StartContainer(bool isArray)
+            {
+                if (captureDepth_ > 0)
+                {
+                    buildStack_.push_back(Build(isArray ? json::array() : json::object()));
+                    ++captureDepth_;
+                    return true;
+                }
+
+                const std::size_t pathLength = path_.size();
+                std::uint64_t hash = 0;
+                const std::size_t route = BeginValue(hash);
+                if (route != kNpos)
+                {
+                    captured_ = isArray ? json::array() : json::object();
+                    buildStack_.assign(1, &captured_);
+                    captureDepth_ = 1;
+                    captureRoute_ = route;
+                    capturePathLength_ = pathLength;
+                    return true;
+                }
+
+                frames_.push_back({ isArray, 0, hash, pathLength });
+                return true;
+            }
+
+            bool EndContainer()
+            {
+                if (captureDepth_ > 0)
+                {
+                    buildStack_.pop_back();
+                    if (--captureDepth_ == 0)
+                    {
+                        Dispatch(captureRoute_, captured_);
+                        captured_ = json();
+                        path_.resize(capturePathLength_);
+                    }
+                    return true;
+                }
+
+                path_.resize(frames_.back().pathLength);
+                frames_.pop_back();
+                return true;
+            }
+
+            const RouteList& routes_;
+            ConfigReport& report_;
+
+            std::vector<Frame> frames_;
+            std::string path_;
+            std::string pendingKey_;
+
+            // --- Sub-tree under construction ---
+            json captured_;
+            std::vector<json*> buildStack_;
+            std::string buildKey_;
+            std::size_t captureDepth_ = 0;
+            std::size_t captureRoute_ = 0;
+            std::size_t capturePathLength_ = 0;
+        };
+    }
+
+    // ------------------------------------------------------------
+    // ConfigStreamLoader
+    // ------------------------------------------------------------
+    void ConfigStreamLoader::On(std::string_view path, Handler handler, ConfigStreamMode mode)
+    {
+        Route route;
+        route.eachChild = path == "*" || (path.size() >= 2 && path.substr(path.size() - 2) == ".*");
+        if (path == "*")
+            path = {};
+        else if (route.eachChild)
+            path.remove_suffix(2);
+
+        route.path = std::string(path);
+        route.hash = ConfigPath::Hash(path);
+        route.mode = mode;
+        route.handler = std::move(handler);
+        routes_.push_back(std::move(route));
+    }
+
+    ConfigReport ConfigStreamLoader::Load(const std::string& path) const
+    {
+        MappedFile file;
+        if (!file.Open(path, MappedFile::Mode::Read))
+        {
+            ConfigReport report;
+            report.Add(path, "cannot open file");
+            return report;
+        }
+
+        const auto* data = reinterpret_cast<const char*>(file.Data());
+        return LoadFromMemory(std::string_view(data ? data : "", file.Size()));
+    }
+
+    ConfigReport ConfigStreamLoader::LoadFromMemory(std::string_view text) const
+    {
+        ConfigReport report;
+        std::mutex reportMutex;
+
+        // --- Find top-level arrays worth splitting ---
+        std::vector<std::string_view> parallelKeys;
+        std::vector<std::size_t> routeOf;
+        for (std::size_t r = 0; r < routes_.size(); ++r)
+        {
+            const Route& route = routes_[r];
+            if (route.mode == ConfigStreamMode::Parallel && route.eachChild &&
+                !route.path.empty() && route.path.find('.') == std::string::npos)
+            {
+                parallelKeys.push_back(route.path);
+                routeOf.push_back(r);
+            }
+        }
+
+        std::vector<ArrayRegion> regions;
+        if (!parallelKeys.empty())
+        {
+            regions = FindTopLevelArrays(text, parallelKeys, routeOf);
+            std::erase_if(regions, [&](const ArrayRegion& region)
+            {
+                return region.end - region.begin < parallelThreshold_ || region.elements.size() < 2;
+            });
+        }
+
+        // --- Workers: parse element chunks of the split arrays ---
+        struct Chunk
+        {
+            const ArrayRegion* region;
+            std::size_t first;
+            std::size_t last;
+        };
+
+        const std::size_t hardware = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+        const std::size_t workers = workerCount_ ? workerCount_ : hardware;
+
+        std::vector<Chunk> chunks;
+        for (const ArrayRegion& region : regions)
+        {
+            const std::size_t count = region.elements.size();
+            const std::size_t chunkSize = std::max<std::size_t>(1, count / (workers * 4));
+            for (std::size_t first = 0; first < count; first += chunkSize)
+                chunks.push_back({ &region, first, std::min(count, first + chunkSize) });
+        }
+
+        std::atomic<std::size_t> nextChunk{0};
+        auto work = [&]()
+        {
+            std::string elementPath;
+            for (std::size_t c = nextChunk.fetch_add(1); c < chunks.size(); c = nextChunk.fetch_add(1))
+            {
+                const Chunk& chunk = chunks[c];
+                const Route& route = routes_[chunk.region->route];
+                for (std::size_t e = chunk.first; e < chunk.last; ++e)
+                {
+                    elementPath = route.path + "." + std::to_string(e);
+                    const auto [begin, end] = chunk.region->elements[e];
+                    try
+                    {
+                        json value = json::parse(text.data() + begin, text.data() + end);
+                        route.handler(elementPath, value);
+                    }
+                    catch (const std::exception& ex)
+                    {
+                        std::lock_guard<std::mutex> lock(reportMutex);
+                        report.Add(elementPath, ex.what());
+                    }
+                }
+            }
+        };
+
+        std::vector<std::thread> threads;
+        if (!chunks.empty())
+        {
+            const std::size_t threadCount = std::min(workers, chunks.size());
+            for (std::size_t t = 0; t < threadCount; ++t)
+                threads.emplace_back(work);
+        }
+
+        // --- Caller's thread: stream everything else ---
+        std::vector<Piece> pieces;
+        static constexpr char kEmptyArray[] = "[]";
+        std::size_t cursor = 0;
+        for (const ArrayRegion& region : regions)
+        {
+            pieces.push_back({ text.data() + cursor, text.data() + region.begin });
+            pieces.push_back({ kEmptyArray, kEmptyArray + 2 });
+            cursor = region.end;
+        }
+        pieces.push_back({ text.data() + cursor, text.data() + text.size() });
+
+        ConfigReport saxReport;
+        SaxRouter<std::vector<Route>> router(routes_, saxReport);
+        json::sax_parse(PieceIterator(pieces.data(), pieces.data() + pieces.size()),
+                        PieceIterator(pieces.data() + pieces.size(), pieces.data() + pieces.size()),
+                        &router);
+
+        for (auto& thread : threads)
+            thread.join();
+
+        for (const auto& issue : saxReport.GetIssues())
+            report.Add(issue.path, issue.message);
+        return report;
+    }
+}
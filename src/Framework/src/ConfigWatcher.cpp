@@ -0,0 +1,129 @@
+#include <Framework/ConfigWatcher.hpp>
+#include <Framework/Logger.hpp>
+#include <filesystem>
+#include <system_error>
+
+#if defined(__linux__)
+    #include <poll.h>
+    #include <sys/inotify.h>
+    #include <unistd.h>
+#endif
+
+namespace Aurum
+{
+    namespace
+    {
+        // Time a save has to settle before the callback runs
+        constexpr std::chrono::milliseconds kSettleTime{ 50 };
+        constexpr int kStopCheckMs = 100;
+    }
+
+    bool ConfigWatcher::Start(const std::string& path, Callback onChange, std::chrono::milliseconds pollInterval)
+    {
+        Stop();
+
+        path_ = path;
+        onChange_ = std::move(onChange);
+        pollInterval_ = pollInterval;
+        stop_.store(false, std::memory_order_relaxed);
+
+#if defined(__linux__)
+        const std::filesystem::path file(path_);
+        const std::string directory = file.has_parent_path() ? file.parent_path().string() : std::string(".");
+
+        inotifyFd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (inotifyFd_ < 0 || inotify_add_watch(inotifyFd_, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0)
+        {
+            Logger::Get().Log("Config watcher: cannot watch " + directory, LogLevel::Warning);
+            if (inotifyFd_ >= 0)
+                ::close(inotifyFd_);
+            inotifyFd_ = -1;
+            return false;
+        }
+#endif
+
+        thread_ = std::thread(&ConfigWatcher::WatchLoop, this);
+        return true;
+    }
+
+    void ConfigWatcher::Stop()
+    {
+        if (!thread_.joinable())
+            return;
+
+        stop_.store(true, std::memory_order_relaxed);
+        thread_.join();
+
+#if defined(__linux__)
+        if (inotifyFd_ >= 0)
+            ::close(inotifyFd_);
+        inotifyFd_ = -1;
+#endif
+    }
+
+#if defined(__linux__)
+    void ConfigWatcher::WatchLoop()
+    {
+        const std::string fileName = std::filesystem::path(path_).filename().string();
+        alignas(inotify_event) char buffer[4096];
+
+        // Reads all pending events; true if any of them named our file
+        auto drain = [&]()
+        {
+            bool matched = false;
+            ssize_t length;
+            while ((length = ::read(inotifyFd_, buffer, sizeof(buffer))) > 0)
+            {
+                for (char* p = buffer; p < buffer + length;)
+                {
+                    const auto* event = reinterpret_cast<const inotify_event*>(p);
+                    if (event->len > 0 && fileName == event->name)
+                        matched = true;
+                    p += sizeof(inotify_event) + event->len;
+                }
+            }
+            return matched;
+        };
+
+        pollfd pfd{ inotifyFd_, POLLIN, 0 };
+        while (!stop_.load(std::memory_order_relaxed))
+        {
+            if (::poll(&pfd, 1, kStopCheckMs) <= 0 || !drain())
+                continue;
+
+            // Let the writer finish; a save often produces several events
+            while (::poll(&pfd, 1, static_cast<int>(kSettleTime.count())) > 0)
+                drain();
+
+            if (!stop_.load(std::memory_order_relaxed))
+                onChange_();
+        }
+    }
+#else
+    void ConfigWatcher::WatchLoop()
+    {
+        std::error_code ec;
+        auto lastWrite = std::filesystem::last_write_time(path_, ec);
+
+        while (!stop_.load(std::memory_order_relaxed))
+        {
+            // Sleep in short steps so Stop() does not wait a full interval
+            for (auto waited = std::chrono::milliseconds(0);
+                 waited < pollInterval_ && !stop_.load(std::memory_order_relaxed);
+                 waited += std::chrono::milliseconds(kStopCheckMs))
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(kStopCheckMs));
+            }
+
+            const auto current = std::filesystem::last_write_time(path_, ec);
+            if (ec || current == lastWrite)
+                continue;
+
+            lastWrite = current;
+            std::this_thread::sleep_for(kSettleTime);
+            if (!stop_.load(std::memory_order_relaxed))
+                onChange_();
+        }
+    }
+#endif
+}
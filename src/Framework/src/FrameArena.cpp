@@ -0,0 +1,156 @@
+#include <Framework/FrameArena.hpp>
+#include <Framework/Logger.hpp>
+#include <Framework/MemoryTracker.hpp>
+#include <algorithm>
+
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <sys/mman.h>
+#endif
+
+namespace Aurum
+{
+    namespace
+    {
+        constexpr std::size_t kCommitGranularity = 64 * 1024;
+
+        std::size_t RoundUp(std::size_t value, std::size_t granularity)
+        {
+            return (value + granularity - 1) / granularity * granularity;
+        }
+
+        // ------------------------------------------------------------
+        // Virtual memory
+        // ------------------------------------------------------------
+        std::uint8_t* Reserve(std::size_t bytes)
+        {
+#if defined(_WIN32)
+            return static_cast<std::uint8_t*>(VirtualAlloc(nullptr, bytes, MEM_RESERVE, PAGE_NOACCESS));
+#else
+            void* memory = mmap(nullptr, bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+            return (memory == MAP_FAILED) ? nullptr : static_cast<std::uint8_t*>(memory);
+#endif
+        }
+
+        bool Commit(std::uint8_t* address, std::size_t bytes)
+        {
+#if defined(_WIN32)
+            return VirtualAlloc(address, bytes, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+#else
+            return mprotect(address, bytes, PROT_READ | PROT_WRITE) == 0;
+#endif
+        }
+
+        void Release(std::uint8_t* address, std::size_t bytes)
+        {
+#if defined(_WIN32)
+            (void)bytes;
+            VirtualFree(address, 0, MEM_RELEASE);
+#else
+            munmap(address, bytes);
+#endif
+        }
+    }
+
+    FrameArena::FrameArena(const char* name, std::size_t reserveBytes, std::uint32_t framesInFlight)
+        : name_(name),
+          reserveBytes_(RoundUp(reserveBytes, kCommitGranularity)),
+          buffers_(std::max<std::uint32_t>(framesInFlight, 1))
+    {
+        reservation_ = Reserve(reserveBytes_ * buffers_.size());
+        if (!reservation_)
+        {
+            Logger::Get().Log(std::string(name_) + ": address space reservation failed; using the heap", LogLevel::Warning);
+            reserveBytes_ = 0;
+        }
+
+        for (std::size_t i = 0; i < buffers_.size(); ++i)
+            buffers_[i].base = reservation_ ? reservation_ + i * reserveBytes_ : nullptr;
+    }
+
+    FrameArena::~FrameArena()
+    {
+        for (Buffer& buffer : buffers_)
+            ReleaseOverflow(buffer);
+        if (reservation_)
+            Release(reservation_, reserveBytes_ * buffers_.size());
+    }
+
+    // ------------------------------------------------------------
+    // Frame rotation
+    // ------------------------------------------------------------
+    void FrameArena::BeginFrame()
+    {
+        const std::size_t frameBytes = GetUsedBytes();
+        peakFrameBytes_ = std::max(peakFrameBytes_, frameBytes);
+
+        MemoryArenaStats stats;
+        stats.name = name_;
+        stats.frameBytes = frameBytes;
+        stats.peakFrameBytes = peakFrameBytes_;
+        stats.committedBytes = GetCommittedBytes();
+        stats.reservedBytes = GetReservedBytes();
+        MemoryTracker::Get().UpdateArena(stats);
+
+        current_ = (current_ + 1) % buffers_.size();
+        Buffer& buffer = buffers_[current_];
+        buffer.used = 0;
+        ReleaseOverflow(buffer);
+    }
+
+    std::size_t FrameArena::GetCommittedBytes() const
+    {
+        std::size_t committed = 0;
+        for (const Buffer& buffer : buffers_)
+            committed += buffer.committed;
+        return committed;
+    }
+
+    // ------------------------------------------------------------
+    // Growth
+    // ------------------------------------------------------------
+    void* FrameArena::AllocateSlow(std::size_t size, std::size_t align)
+    {
+        Buffer& buffer = buffers_[current_];
+        const std::size_t offset = (buffer.used + align - 1) & ~(align - 1);
+        const std::size_t end = offset + size;
+
+        // Commit the next pages of the reserved range
+        if (end <= reserveBytes_)
+        {
+            const std::size_t target = std::min(RoundUp(end, kCommitGranularity), reserveBytes_);
+            if (Commit(buffer.base + buffer.committed, target - buffer.committed))
+            {
+                buffer.committed = target;
+                buffer.used = end;
+                return buffer.base + offset;
+            }
+        }
+
+        // Out of reserve: fall back to the heap until this buffer resets
+        if (!warnedOverflow_)
+        {
+            warnedOverflow_ = true;
+            Logger::Get().Log(std::string(name_) + ": frame exceeded its reserve; spilling to the heap", LogLevel::Warning);
+        }
+        void* memory = ::operator new(size, std::align_val_t(align));
+        buffer.overflow.push_back({ memory, align });
+        buffer.overflowBytes += size;
+        return memory;
+    }
+
+    void FrameArena::ReleaseOverflow(Buffer& buffer)
+    {
+        for (const OverflowBlock& block : buffer.overflow)
+            ::operator delete(block.memory, std::align_val_t(block.align));
+        buffer.overflow.clear();
+        buffer.overflowBytes = 0;
+    }
+}
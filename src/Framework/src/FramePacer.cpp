@@ -0,0 +1,197 @@
+#include <Framework/FramePacer.hpp>
+#include <Framework/Profiler.hpp>
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <thread>
+
+#if defined(__linux__)
+    #include <sys/prctl.h>
+    #include <time.h>
+#elif defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+    #ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+        #define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+    #endif
+#endif
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #include <immintrin.h>
+#endif
+
+namespace Aurum
+{
+    namespace
+    {
+        constexpr double kMinMargin = 20e-6;
+        constexpr double kMaxMargin = 4e-3;
+        constexpr double kLatenessAlpha = 1.0 / 16.0;
+
+        inline void CpuRelax()
+        {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+            _mm_pause();
+#endif
+        }
+
+#if defined(_WIN32)
+        // Sleep() and plain waitable timers round up to the system tick
+        // (up to 15.6 ms); the high-resolution flag needs Windows 10 1803+
+        // and leaves the handle null on older systems
+        struct WaitableTimer
+        {
+            HANDLE handle = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+            ~WaitableTimer() { if (handle) CloseHandle(handle); }
+        };
+
+        HANDLE GetThreadTimer()
+        {
+            thread_local WaitableTimer timer;
+            return timer.handle;
+        }
+#endif
+
+        void SleepUntil(FramePacer::Clock::time_point wake)
+        {
+#if defined(__linux__)
+            // steady_clock is CLOCK_MONOTONIC on Linux
+            const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(wake.time_since_epoch()).count();
+            timespec ts;
+            ts.tv_sec = static_cast<time_t>(ns / 1000000000);
+            ts.tv_nsec = static_cast<long>(ns % 1000000000);
+            while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR) {}
+#elif defined(_WIN32)
+            // Relative due time in 100 ns units; steady_clock is not the
+            // timer's clock, so the deadline is converted just before arming
+            const auto remaining = std::chrono::duration_cast<std::chrono::nanoseconds>(wake - FramePacer::Clock::now()).count();
+            if (remaining <= 0)
+                return;
+            LARGE_INTEGER due;
+            due.QuadPart = -static_cast<LONGLONG>((remaining + 99) / 100);
+            HANDLE timer = GetThreadTimer();
+            if (SetWaitableTimer(timer, &due, 0, nullptr, nullptr, FALSE))
+                WaitForSingleObject(timer, INFINITE);
+#else
+            std::this_thread::sleep_until(wake);
+#endif
+        }
+    }
+
+    bool FramePacer::IsPreciseSupported()
+    {
+#if defined(__linux__)
+        return true;
+#elif defined(_WIN32)
+        return GetThreadTimer() != nullptr;
+#else
+        return false;
+#endif
+    }
+
+    void FramePacer::SetTargetFrameTime(double seconds)
+    {
+        period_ = (seconds > 0.0)
+            ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(seconds))
+            : Clock::duration::zero();
+        deadline_ = {};
+    }
+
+    double FramePacer::GetWakeMargin() const
+    {
+        return std::clamp(latenessMean_ + 4.0 * latenessDev_, kMinMargin, kMaxMargin);
+    }
+
+    void FramePacer::Wait()
+    {
+        if (period_ == Clock::duration::zero())
+            return;
+
+        const auto now = Clock::now();
+        if (deadline_ == Clock::time_point{})
+            deadline_ = now + period_;
+
+        if (now >= deadline_)
+        {
+            stats_.missed++;
+        }
+        else if (mode_ == FramePacingMode::Spin || !IsPreciseSupported())
+        {
+            WaitSpin();
+        }
+        else
+        {
+            WaitPrecise();
+        }
+        stats_.frames++;
+
+        deadline_ += period_;
+        const auto end = Clock::now();
+        if (deadline_ <= end)
+            deadline_ = end + period_;
+    }
+
+    // ------------------------------------------------------------
+    // Spin: the original hybrid limiter
+    // ------------------------------------------------------------
+    void FramePacer::WaitSpin()
+    {
+        using namespace std::chrono;
+
+        {
+            AURUM_PROFILE_ZONE("Pacer Sleep");
+            while (Clock::now() < deadline_ - milliseconds(2))
+                std::this_thread::sleep_for(milliseconds(1));
+        }
+
+        AURUM_PROFILE_ZONE("Pacer Spin");
+        const auto spinStart = Clock::now();
+        while (Clock::now() < deadline_) {}
+        stats_.spinSeconds += duration<double>(Clock::now() - spinStart).count();
+    }
+
+    // ------------------------------------------------------------
+    // Precise: calibrated absolute sleep + short spin
+    // ------------------------------------------------------------
+    void FramePacer::WaitPrecise()
+    {
+#if defined(__linux__)
+        // Default timer slack (50 us) would be added to every wake-up
+        if (!threadPrepared_)
+            prctl(PR_SET_TIMERSLACK, 1UL, 0UL, 0UL, 0UL);
+#endif
+        threadPrepared_ = true;
+
+        const auto margin = std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double>(GetWakeMargin()));
+        const auto wake = deadline_ - margin;
+
+        if (Clock::now() < wake)
+        {
+            AURUM_PROFILE_ZONE("Pacer Sleep");
+            SleepUntil(wake);
+            RecordLateness(std::chrono::duration<double>(Clock::now() - wake).count());
+        }
+
+        AURUM_PROFILE_ZONE("Pacer Spin");
+        const auto spinStart = Clock::now();
+        while (Clock::now() < deadline_)
+            CpuRelax();
+        stats_.spinSeconds += std::chrono::duration<double>(Clock::now() - spinStart).count();
+    }
+
+    void FramePacer::RecordLateness(double seconds)
+    {
+        seconds = std::max(seconds, 0.0);
+        stats_.maxLateness = std::max(stats_.maxLateness, seconds);
+
+        const double error = seconds - latenessMean_;
+        latenessMean_ += kLatenessAlpha * error;
+        latenessDev_ += kLatenessAlpha * (std::abs(error) - latenessDev_);
+    }
+}
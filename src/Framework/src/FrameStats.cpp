@@ -0,0 +1,211 @@
+#include <Framework/FrameStats.hpp>
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+
+namespace Aurum
+{
+    // ------------------------------------------------------------
+    // FrameTimeHistogram
+    // ------------------------------------------------------------
+    std::size_t FrameTimeHistogram::BucketIndex(std::uint64_t us)
+    {
+        us = std::min(us, kMaxMicroseconds);
+        if (us < 2 * kSubBuckets)
+            return static_cast<std::size_t>(us);
+
+        // Keep the top kSubBucketBits + 1 bits; the leading one selects the octave
+        const int shift = std::bit_width(us) - (kSubBucketBits + 1);
+        return static_cast<std::size_t>(2 * kSubBuckets + (shift - 1) * kSubBuckets + ((us >> shift) - kSubBuckets));
+    }
+
+    std::uint64_t FrameTimeHistogram::BucketLow(std::size_t index)
+    {
+        if (index < 2 * kSubBuckets)
+            return index;
+        const std::size_t offset = index - 2 * kSubBuckets;
+        const int shift = static_cast<int>(offset / kSubBuckets) + 1;
+        return (kSubBuckets + offset % kSubBuckets) << shift;
+    }
+
+    std::uint64_t FrameTimeHistogram::BucketHigh(std::size_t index)
+    {
+        return (index + 1 < kBucketCount) ? BucketLow(index + 1) - 1 : kMaxMicroseconds;
+    }
+
+    void FrameTimeHistogram::Record(double seconds)
+    {
+        const auto us = static_cast<std::uint64_t>(std::llround(std::max(0.0, seconds) * 1e6));
+        buckets_[BucketIndex(us)]++;
+        count_++;
+        sum_ += us;
+        min_ = std::min(min_, us);
+        max_ = std::max(max_, us);
+    }
+
+    void FrameTimeHistogram::Clear()
+    {
+        buckets_.fill(0);
+        count_ = 0;
+        sum_ = 0;
+        min_ = UINT64_MAX;
+        max_ = 0;
+    }
+
+    double FrameTimeHistogram::GetMin() const { return count_ ? min_ * 1e-6 : 0.0; }
+    double FrameTimeHistogram::GetMax() const { return max_ * 1e-6; }
+    double FrameTimeHistogram::GetMean() const { return count_ ? (double(sum_) / count_) * 1e-6 : 0.0; }
+
+    double FrameTimeHistogram::Percentile(double percent) const
+    {
+        if (count_ == 0)
+            return 0.0;
+
+        const auto rank = std::max<std::uint64_t>(1,
+            static_cast<std::uint64_t>(std::ceil(std::clamp(percent, 0.0, 100.0) / 100.0 * count_)));
+
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < kBucketCount; ++i)
+        {
+            seen += buckets_[i];
+            if (seen >= rank)
+            {
+                // Bucket midpoint, never outside the observed range
+                const std::uint64_t mid = (BucketLow(i) + BucketHigh(i)) / 2;
+                return std::clamp(mid, min_, max_) * 1e-6;
+            }
+        }
+        return GetMax();
+    }
+
+    // ------------------------------------------------------------
+    // FrameStats
+    // ------------------------------------------------------------
+    FrameStats::FrameStats(std::size_t capacity)
+        : ring_(std::max<std::size_t>(1, capacity), 0.0),
+          scratch_(ring_.size(), 0.0)
+    {}
+
+    void FrameStats::Record(double seconds)
+    {
+        ring_[head_] = seconds;
+        head_ = (head_ + 1) % ring_.size();
+        count_ = std::min(count_ + 1, ring_.size());
+
+        histogram_.Record(seconds);
+        if (seconds > hitchThreshold_)
+            lifetimeHitches_++;
+    }
+
+    void FrameStats::Reset()
+    {
+        head_ = 0;
+        count_ = 0;
+        histogram_.Clear();
+        lifetimeHitches_ = 0;
+    }
+
+    FrameStatsSummary FrameStats::Summarize(std::size_t frames) const
+    {
+        FrameStatsSummary summary;
+        const std::size_t n = (frames == 0) ? count_ : std::min(frames, count_);
+        if (n == 0)
+            return summary;
+
+        // Newest n entries, oldest first
+        double sum = 0.0;
+        const std::size_t capacity = ring_.size();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const double t = ring_[(head_ + capacity - n + i) % capacity];
+            scratch_[i] = t;
+            sum += t;
+            if (t > hitchThreshold_)
+                summary.hitches++;
+        }
+
+        const auto first = scratch_.begin();
+        const auto last = first + static_cast<std::ptrdiff_t>(n);
+        auto rank = [&](double percent)
+        {
+            const auto k = static_cast<std::size_t>(std::ceil(percent / 100.0 * n));
+            const auto nth = first + static_cast<std::ptrdiff_t>(std::max<std::size_t>(k, 1) - 1);
+            std::nth_element(first, nth, last);
+            return *nth;
+        };
+
+        summary.frames = n;
+        summary.mean = sum / n;
+        summary.min = *std::min_element(first, last);
+        summary.max = *std::max_element(first, last);
+        summary.p50 = rank(50.0);
+        summary.p95 = rank(95.0);
+        summary.p99 = rank(99.0);
+        return summary;
+    }
+
+    FrameStatsSummary FrameStats::SummarizeLifetime() const
+    {
+        FrameStatsSummary summary;
+        summary.frames = static_cast<std::size_t>(histogram_.GetCount());
+        summary.min = histogram_.GetMin();
+        summary.mean = histogram_.GetMean();
+        summary.p50 = histogram_.Percentile(50.0);
+        summary.p95 = histogram_.Percentile(95.0);
+        summary.p99 = histogram_.Percentile(99.0);
+        summary.max = histogram_.GetMax();
+        summary.hitches = static_cast<std::size_t>(lifetimeHitches_);
+        return summary;
+    }
+
+    // ------------------------------------------------------------
+    // CSV Export
+    // ------------------------------------------------------------
+    bool FrameStats::ExportCsv(const std::string& path, std::span<const std::size_t> windows) const
+    {
+        std::error_code ec;
+        const bool writeHeader = !std::filesystem::exists(path, ec) || std::filesystem::file_size(path, ec) == 0;
+
+        std::ofstream file(path, std::ios::app);
+        if (!file.is_open())
+            return false;
+
+        if (writeHeader)
+            file << "timestamp_ms,window,frames,min_ms,mean_ms,p50_ms,p95_ms,p99_ms,max_ms,hitches\n";
+
+        const auto timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+
+        auto row = [&](const std::string& label, const FrameStatsSummary& s)
+        {
+            file << timestamp << ',' << label << ',' << s.frames << ','
+                 << s.min * 1e3 << ',' << s.mean * 1e3 << ',' << s.p50 * 1e3 << ','
+                 << s.p95 * 1e3 << ',' << s.p99 * 1e3 << ',' << s.max * 1e3 << ','
+                 << s.hitches << '\n';
+        };
+
+        for (std::size_t window : windows)
+            row(std::to_string(window), Summarize(window));
+        row("lifetime", SummarizeLifetime());
+        return file.good();
+    }
+
+    bool FrameStats::ExportHistogramCsv(const std::string& path) const
+    {
+        std::ofstream file(path, std::ios::trunc);
+        if (!file.is_open())
+            return false;
+
+        file << "bucket_low_us,bucket_high_us,count\n";
+        for (std::size_t i = 0; i < FrameTimeHistogram::kBucketCount; ++i)
+        {
+            if (const std::uint64_t n = histogram_.GetBucket(i))
+                file << FrameTimeHistogram::BucketLow(i) << ',' << FrameTimeHistogram::BucketHigh(i) << ',' << n << '\n';
+        }
+        return file.good();
+    }
+}
@@ -0,0 +1,104 @@
+#include <Framework/Math/LargeWorld.hpp>
+#include <Framework/Math/Simd.hpp>
+
+namespace Aurum
+{
+    namespace
+    {
+        // Four doubles per step with the baseline SIMD set; the same
+        // subtract and round as the scalar tail, so results are identical
+        void RelativeAxis(const double* world, double origin, float* out, std::size_t count)
+        {
+            std::size_t i = 0;
+#if AURUM_SIMD_SSE
+            const __m128d o = _mm_set1_pd(origin);
+            for (; i + 4 <= count; i += 4)
+            {
+                const __m128 lo = _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(world + i), o));
+                const __m128 hi = _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(world + i + 2), o));
+                _mm_storeu_ps(out + i, _mm_movelh_ps(lo, hi));
+            }
+#elif AURUM_SIMD_NEON
+            const float64x2_t o = vdupq_n_f64(origin);
+            for (; i + 4 <= count; i += 4)
+            {
+                const float32x2_t lo = vcvt_f32_f64(vsubq_f64(vld1q_f64(world + i), o));
+                const float32x2_t hi = vcvt_f32_f64(vsubq_f64(vld1q_f64(world + i + 2), o));
+                vst1q_f32(out + i, vcombine_f32(lo, hi));
+            }
+#endif
+            for (; i < count; ++i)
+                out[i] = static_cast<float>(world[i] - origin);
+        }
+
+        std::int64_t NearestSector(double value)
+        {
+            return static_cast<std::int64_t>(std::floor(value / SectorPosition::kSectorSize + 0.5));
+        }
+
+        // int64 -> double has no SIMD form before AVX-512DQ; kept scalar
+        void RelativeSectorAxis(const std::int64_t* sectors, const float* offsets,
+                                std::int64_t originSector, float* out, std::size_t count)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const double base = static_cast<double>(sectors[i] - originSector) * SectorPosition::kSectorSize;
+                out[i] = static_cast<float>(base + static_cast<double>(offsets[i]));
+            }
+        }
+    }
+
+    FloatingOrigin::FloatingOrigin(double rebaseDistance)
+        : rebaseDistance_(rebaseDistance)
+    {
+    }
+
+    bool FloatingOrigin::Update(const Vector3d& camera)
+    {
+        const Vector3d delta = camera - origin_;
+        lastShift_ = Vector3d();
+        if (std::abs(delta.x) <= rebaseDistance_ && std::abs(delta.y) <= rebaseDistance_ && std::abs(delta.z) <= rebaseDistance_)
+            return false;
+
+        // Nearest sector corner: with a rebase distance under half a sector
+        // that can be the current origin, which is then not a re-centre
+        const std::int64_t sx = NearestSector(camera.x);
+        const std::int64_t sy = NearestSector(camera.y);
+        const std::int64_t sz = NearestSector(camera.z);
+        if (sx == sectorX_ && sy == sectorY_ && sz == sectorZ_)
+            return false;
+
+        const Vector3d previous = origin_;
+        SetOrigin(sx, sy, sz);
+        lastShift_ = previous - origin_;
+        rebaseCount_++;
+        return true;
+    }
+
+    void FloatingOrigin::SetOrigin(std::int64_t sx, std::int64_t sy, std::int64_t sz)
+    {
+        sectorX_ = sx;
+        sectorY_ = sy;
+        sectorZ_ = sz;
+        origin_ = Vector3d(static_cast<double>(sx) * SectorPosition::kSectorSize,
+                           static_cast<double>(sy) * SectorPosition::kSectorSize,
+                           static_cast<double>(sz) * SectorPosition::kSectorSize);
+    }
+
+    // ------------------------------------------------------------
+    // Batch Pass
+    // ------------------------------------------------------------
+    void FloatingOrigin::ToLocal(ConstDouble3Stream world, Float3Stream out, std::size_t count) const
+    {
+        RelativeAxis(world.x, origin_.x, out.x, count);
+        RelativeAxis(world.y, origin_.y, out.y, count);
+        RelativeAxis(world.z, origin_.z, out.z, count);
+    }
+
+    void FloatingOrigin::ToLocal(ConstSectorStream world, Float3Stream out, std::size_t count) const
+    {
+        RelativeSectorAxis(world.sx, world.offset.x, sectorX_, out.x, count);
+        RelativeSectorAxis(world.sy, world.offset.y, sectorY_, out.y, count);
+        RelativeSectorAxis(world.sz, world.offset.z, sectorZ_, out.z, count);
+    }
+}
@@ -0,0 +1,192 @@
+#include <Framework/Logging/LogSinks.hpp>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <system_error>
+
+namespace Aurum
+{
+    // ============================================================
+    // ConsoleLogSink
+    // ============================================================
+    void ConsoleLogSink::Write(const LogRecord&, std::string_view line)
+    {
+        buffer_.append(line);
+    }
+
+    void ConsoleLogSink::Flush()
+    {
+        if (buffer_.empty())
+            return;
+
+        std::cout.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+        std::cout.flush();
+        buffer_.clear();
+    }
+
+    // ============================================================
+    // FileLogSink
+    // ============================================================
+    FileLogSink::FileLogSink(const std::string& path)
+    {
+        file_.open(path, std::ios::out | std::ios::app);
+    }
+
+    void FileLogSink::Write(const LogRecord&, std::string_view line)
+    {
+        buffer_.append(line);
+    }
+
+    void FileLogSink::Flush()
+    {
+        if (buffer_.empty() || !file_.is_open())
+            return;
+
+        file_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+        file_.flush();
+        buffer_.clear();
+    }
+
+    // ============================================================
+    // RotatingFileLogSink
+    // ============================================================
+    RotatingFileLogSink::RotatingFileLogSink(const std::string& path, std::uint64_t maxBytes, std::size_t maxBackups)
+        : path_(path), maxBytes_(maxBytes), maxBackups_(maxBackups)
+    {
+        std::error_code ec;
+        const auto existing = std::filesystem::file_size(path_, ec);
+        fileSize_ = ec ? 0 : static_cast<std::uint64_t>(existing);
+        file_.open(path_, std::ios::out | std::ios::app);
+    }
+
+    void RotatingFileLogSink::Write(const LogRecord&, std::string_view line)
+    {
+        if (maxBytes_ > 0 && fileSize_ > 0 && fileSize_ + line.size() > maxBytes_)
+            Rotate();
+
+        buffer_.append(line);
+        fileSize_ += line.size();
+    }
+
+    void RotatingFileLogSink::Flush()
+    {
+        if (buffer_.empty() || !file_.is_open())
+            return;
+
+        file_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+        file_.flush();
+        buffer_.clear();
+    }
+
+    void RotatingFileLogSink::Rotate()
+    {
+        Flush();
+        file_.close();
+
+        std::error_code ec;
+        if (maxBackups_ == 0)
+        {
+            std::filesystem::remove(path_, ec);
+        }
+        else
+        {
+            std::filesystem::remove(path_ + "." + std::to_string(maxBackups_), ec);
+            for (std::size_t i = maxBackups_; i > 1; --i)
+                std::filesystem::rename(path_ + "." + std::to_string(i - 1), path_ + "." + std::to_string(i), ec);
+            std::filesystem::rename(path_, path_ + ".1", ec);
+        }
+
+        file_.open(path_, std::ios::out | std::ios::trunc);
+        fileSize_ = 0;
+    }
+
+    // ============================================================
+    // RingBufferLogSink
+    // ============================================================
+    RingBufferLogSink::RingBufferLogSink(std::size_t capacity)
+        : lines_(capacity > 0 ? capacity : 1)
+    {
+    }
+
+    void RingBufferLogSink::Write(const LogRecord&, std::string_view line)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        lines_[next_].assign(line);
+        next_ = (next_ + 1) % lines_.size();
+        if (count_ < lines_.size())
+            ++count_;
+    }
+
+    std::vector<std::string> RingBufferLogSink::Snapshot() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<std::string> result;
+        result.reserve(count_);
+
+        const std::size_t first = (next_ + lines_.size() - count_) % lines_.size();
+        for (std::size_t i = 0; i < count_; ++i)
+            result.push_back(lines_[(first + i) % lines_.size()]);
+        return result;
+    }
+
+    void RingBufferLogSink::Dump(std::ostream& out) const
+    {
+        for (const auto& line : Snapshot())
+            out << line;
+        out.flush();
+    }
+
+    // ============================================================
+    // MappedFileLogSink
+    // ============================================================
+    MappedFileLogSink::MappedFileLogSink(const std::string& path, std::size_t chunkSize)
+        : chunkSize_(chunkSize > 0 ? chunkSize : 4096)
+    {
+        if (!file_.Open(path, MappedFile::Mode::ReadWrite))
+            return;
+
+        // Continue after the last byte written; a crashed run leaves a
+        // zero-filled tail from the pre-grown chunk.
+        std::size_t end = file_.Size();
+        const std::uint8_t* data = file_.Data();
+        while (end > 0 && data[end - 1] == 0)
+            --end;
+        writeOffset_ = end;
+
+        if (file_.Size() < writeOffset_ + chunkSize_)
+            file_.Resize(writeOffset_ + chunkSize_);
+    }
+
+    MappedFileLogSink::~MappedFileLogSink()
+    {
+        if (!file_.IsOpen())
+            return;
+
+        file_.Resize(writeOffset_);
+        file_.FlushAsync();
+        file_.Close();
+    }
+
+    void MappedFileLogSink::Write(const LogRecord&, std::string_view line)
+    {
+        if (!file_.IsOpen() || line.empty())
+            return;
+
+        if (writeOffset_ + line.size() > file_.Size())
+        {
+            std::size_t newSize = file_.Size() + chunkSize_;
+            while (newSize < writeOffset_ + line.size())
+                newSize += chunkSize_;
+            if (!file_.Resize(newSize))
+                return;
+        }
+
+        // Lines that fit keep going into a mapping that could not grow;
+        // with no mapping at all there is nowhere to write
+        if (!file_.Data())
+            return;
+
+        std::memcpy(file_.Data() + writeOffset_, line.data(), line.size());
+        writeOffset_ += line.size();
+    }
+}
@@ -0,0 +1,593 @@
+#include <Framework/Logger.hpp>
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+namespace Aurum
+{
+    // ------------------------------------------------------------
+    // Logging Entry Point
+    // ------------------------------------------------------------
+    void Logger::Log(const std::string& message, LogLevel level)
+    {
+        if (!ShouldLog(level))
+            return;
+
+        LogRecord record;
+        record.level = level;
+        record.timestamp = LogClock::Now();
+        record.threadId = CurrentLogThreadId();
+        record.payload = message;
+        Submit(std::move(record));
+    }
+
+    void Logger::Submit(LogRecord&& record)
+    {
+        if (async_.load(std::memory_order_acquire))
+        {
+            Enqueue(std::move(record));
+            return;
+        }
+
+        if (staging_.load(std::memory_order_acquire))
+        {
+            StageRecord(std::move(record));
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        WriteRecords(&record, 1);
+    }
+
+    // ------------------------------------------------------------
+    // Sink Registry
+    // ------------------------------------------------------------
+    Logger::Logger()
+    {
+        sinks_.push_back({ "console", std::make_shared<ConsoleLogSink>() });
+    }
+
+    void Logger::AddSink(const std::string& name, std::shared_ptr<LogSink> sink)
+    {
+        if (!sink)
+            return;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = std::find_if(sinks_.begin(), sinks_.end(),
+                               [&](const NamedSink& entry) { return entry.name == name; });
+        if (it != sinks_.end())
+        {
+            it->sink->Flush();
+            it->sink = std::move(sink);
+        }
+        else
+        {
+            sinks_.push_back({ name, std::move(sink) });
+        }
+        UpdateTextNeeded();
+    }
+
+    bool Logger::RemoveSink(const std::string& name)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = std::find_if(sinks_.begin(), sinks_.end(),
+                               [&](const NamedSink& entry) { return entry.name == name; });
+        if (it == sinks_.end())
+            return false;
+
+        it->sink->Flush();
+        sinks_.erase(it);
+        UpdateTextNeeded();
+        return true;
+    }
+
+    std::shared_ptr<LogSink> Logger::GetSink(const std::string& name) const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& entry : sinks_)
+        {
+            if (entry.name == name)
+                return entry.sink;
+        }
+        return nullptr;
+    }
+
+    void Logger::SetRateLimit(const LogRateLimitConfig& config)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        rateLimiter_.Configure(config);
+    }
+
+    // Caller must hold mutex_
+    void Logger::UpdateTextNeeded()
+    {
+        bool needed = false;
+        for (const auto& entry : sinks_)
+            needed = needed || entry.sink->WantsText();
+        textNeeded_.store(needed, std::memory_order_release);
+    }
+
+    void Logger::AppendRecord(std::string& out, const LogRecord& record, TimestampCache& timestamps)
+    {
+        out += '[';
+        out += timestamps.Format(record.timestamp, anchor_);
+        out += "] ";
+        out += LogLevelToString(record.level);
+        out += ": ";
+        if (record.site)
+            FormatLogMessage(out, record.site->format, record.payload);
+        else
+            out += record.payload;
+        out += '\n';
+    }
+
+    // Runs the records through the rate limiter, formats the survivors once
+    // and hands them to every sink whose level accepts them. Records staged
+    // by other threads arrive with their text already formatted.
+    // Caller must hold mutex_.
+    void Logger::WriteRecords(const LogRecord* records, std::size_t count,
+                              const std::string* text, const std::size_t* lineOffsets)
+    {
+        const bool needText = textNeeded_.load(std::memory_order_relaxed);
+
+        admitted_.clear();
+        summaries_.clear();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (rateLimiter_.Admit(records[i], summaries_))
+                admitted_.push_back(i);
+        }
+        rateLimiter_.Sweep(LogClock::Now(), summaries_);
+
+        if (admitted_.empty() && summaries_.empty())
+            return;
+
+        lines_.clear();
+        if (needText)
+        {
+            textBuffer_.clear();
+            for (std::size_t i : admitted_)
+            {
+                if (text)
+                {
+                    lines_.push_back({ false, lineOffsets[i], lineOffsets[i + 1] });
+                    continue;
+                }
+                const std::size_t begin = textBuffer_.size();
+                AppendRecord(textBuffer_, records[i], timestamps_);
+                lines_.push_back({ true, begin, textBuffer_.size() });
+            }
+            for (const auto& summary : summaries_)
+            {
+                const std::size_t begin = textBuffer_.size();
+                AppendRecord(textBuffer_, summary, timestamps_);
+                lines_.push_back({ true, begin, textBuffer_.size() });
+            }
+        }
+
+        auto lineAt = [&](std::size_t index) -> std::string_view
+        {
+            if (!needText)
+                return {};
+            const LineRef& ref = lines_[index];
+            const std::string& source = ref.local ? textBuffer_ : *text;
+            return std::string_view(source).substr(ref.begin, ref.end - ref.begin);
+        };
+
+        for (const auto& entry : sinks_)
+        {
+            LogSink& sink = *entry.sink;
+            for (std::size_t k = 0; k < admitted_.size(); ++k)
+            {
+                const LogRecord& record = records[admitted_[k]];
+                if (sink.Accepts(record.level))
+                    sink.Write(record, lineAt(k));
+            }
+            for (std::size_t k = 0; k < summaries_.size(); ++k)
+            {
+                if (sink.Accepts(summaries_[k].level))
+                    sink.Write(summaries_[k], lineAt(admitted_.size() + k));
+            }
+            sink.Flush();
+        }
+    }
+
+    // ------------------------------------------------------------
+    // Async Mode Control
+    // ------------------------------------------------------------
+    void Logger::StartAsync(const AsyncLogConfig& config)
+    {
+        std::lock_guard<std::mutex> control(asyncControlMutex_);
+        if (async_.load(std::memory_order_acquire))
+            return;
+
+        asyncConfig_ = config;
+        if (asyncConfig_.maxBatchSize == 0)
+            asyncConfig_.maxBatchSize = 1;
+
+        queue_ = std::make_unique<BoundedMpmcQueue<LogRecord>>(asyncConfig_.queueCapacity);
+        stopRequested_.store(false, std::memory_order_relaxed);
+        writer_ = std::thread(&Logger::WriterLoop, this);
+        async_.store(true, std::memory_order_release);
+    }
+
+    void Logger::StopAsync()
+    {
+        std::lock_guard<std::mutex> control(asyncControlMutex_);
+        if (!async_.load(std::memory_order_acquire))
+            return;
+
+        // New calls fall back to the synchronous path; wait for callers
+        // that already committed to the queue before tearing it down.
+        async_.store(false, std::memory_order_seq_cst);
+        while (activeProducers_.load(std::memory_order_seq_cst) != 0)
+            std::this_thread::yield();
+
+        stopRequested_.store(true, std::memory_order_seq_cst);
+        WakeWriter();
+        if (writer_.joinable())
+            writer_.join();
+
+        queue_.reset();
+    }
+
+    void Logger::Flush()
+    {
+        if (async_.load(std::memory_order_acquire))
+        {
+            const std::uint64_t target = enqueued_.load(std::memory_order_acquire);
+            WakeWriter();
+
+            std::uint64_t done = consumed_.load(std::memory_order_acquire);
+            while (done < target)
+            {
+                consumed_.wait(done, std::memory_order_acquire);
+                done = consumed_.load(std::memory_order_acquire);
+            }
+            return;
+        }
+
+        FlushStaging();
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        // Collapsed repeats whose window has closed are written now
+        WriteRecords(nullptr, 0);
+        for (const auto& entry : sinks_)
+            entry.sink->Flush();
+    }
+
+    // ------------------------------------------------------------
+    // Producer Side
+    // ------------------------------------------------------------
+    void Logger::Enqueue(LogRecord&& record)
+    {
+        activeProducers_.fetch_add(1, std::memory_order_seq_cst);
+
+        // StopAsync may have started between the caller's check and here
+        if (!async_.load(std::memory_order_seq_cst))
+        {
+            activeProducers_.fetch_sub(1, std::memory_order_seq_cst);
+            Submit(std::move(record));
+            return;
+        }
+
+        // Counted before the push: once the record is visible the writer may
+        // consume it, and a Flush() that starts after this call returns must
+        // already include it in its target.
+        enqueued_.fetch_add(1, std::memory_order_release);
+
+        if (!queue_->TryPush(std::move(record)))
+        {
+            switch (asyncConfig_.overflowPolicy)
+            {
+                case LogOverflowPolicy::Block:
+                    while (!queue_->TryPush(std::move(record)))
+                    {
+                        WakeWriter();
+                        std::this_thread::yield();
+                    }
+                    break;
+
+                case LogOverflowPolicy::DropOldest:
+                {
+                    LogRecord discarded;
+                    while (!queue_->TryPush(std::move(record)))
+                    {
+                        if (queue_->TryPop(discarded))
+                        {
+                            droppedPending_.fetch_add(1, std::memory_order_relaxed);
+                            droppedTotal_.fetch_add(1, std::memory_order_relaxed);
+                            consumed_.fetch_add(1, std::memory_order_release);
+                            consumed_.notify_all();
+                        }
+                    }
+                    break;
+                }
+
+                case LogOverflowPolicy::DropNewest:
+                    // Settles the count taken above, so Flush() never waits on it
+                    droppedPending_.fetch_add(1, std::memory_order_relaxed);
+                    droppedTotal_.fetch_add(1, std::memory_order_relaxed);
+                    consumed_.fetch_add(1, std::memory_order_release);
+                    consumed_.notify_all();
+                    break;
+            }
+        }
+
+        // Pairs with the fence in WriterLoop so a sleeping writer never misses a record
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (writerSleeping_.load(std::memory_order_relaxed))
+            WakeWriter();
+
+        activeProducers_.fetch_sub(1, std::memory_order_seq_cst);
+    }
+
+    void Logger::WakeWriter()
+    {
+        wakeSignal_.fetch_add(1, std::memory_order_release);
+        wakeSignal_.notify_one();
+    }
+
+    // ------------------------------------------------------------
+    // Writer Thread
+    // ------------------------------------------------------------
+    void Logger::WriterLoop()
+    {
+        std::vector<LogRecord> batch;
+        batch.reserve(asyncConfig_.maxBatchSize + 1);
+        LogRecord record;
+
+        for (;;)
+        {
+            batch.clear();
+            while (batch.size() < asyncConfig_.maxBatchSize && queue_->TryPop(record))
+                batch.push_back(std::move(record));
+            const std::size_t count = batch.size();
+
+            const std::uint64_t dropped = droppedPending_.exchange(0, std::memory_order_relaxed);
+            if (dropped > 0)
+            {
+                LogRecord notice;
+                notice.level = LogLevel::Warning;
+                notice.timestamp = LogClock::Now();
+                notice.threadId = CurrentLogThreadId();
+                notice.payload = "Logger queue overflow: dropped " + std::to_string(dropped) + " records";
+                batch.push_back(std::move(notice));
+            }
+
+            if (!batch.empty())
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                WriteRecords(batch.data(), batch.size());
+            }
+
+            if (count > 0)
+            {
+                consumed_.fetch_add(count, std::memory_order_release);
+                consumed_.notify_all();
+                continue;
+            }
+
+            if (stopRequested_.load(std::memory_order_acquire))
+            {
+                if (queue_->Empty())
+                    break;
+                continue;
+            }
+
+            // Nothing to do: announce that we sleep, re-check, then park
+            const std::uint32_t signal = wakeSignal_.load(std::memory_order_acquire);
+            writerSleeping_.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            if (queue_->Empty() && !stopRequested_.load(std::memory_order_acquire))
+                wakeSignal_.wait(signal, std::memory_order_acquire);
+
+            writerSleeping_.store(false, std::memory_order_relaxed);
+        }
+
+        consumed_.notify_all();
+    }
+
+    // ------------------------------------------------------------
+    // Per-Thread Staging
+    // ------------------------------------------------------------
+    void Logger::EnableThreadStaging(const ThreadStagingConfig& config)
+    {
+        if (staging_.load(std::memory_order_acquire))
+            return;
+
+        stagingConfig_ = config;
+        lastStagingFlush_.store(LogClock::Now(), std::memory_order_relaxed);
+        staging_.store(true, std::memory_order_release);
+    }
+
+    void Logger::DisableThreadStaging()
+    {
+        staging_.store(false, std::memory_order_release);
+        FlushStaging(true);
+    }
+
+    LogStagingBuffer& Logger::GetStagingBuffer()
+    {
+        // Marks the buffer for removal once its thread exits; the Logger
+        // keeps it alive until its remaining records have been merged.
+        struct Holder
+        {
+            std::shared_ptr<LogStagingBuffer> buffer;
+            ~Holder()
+            {
+                if (buffer)
+                {
+                    std::lock_guard<std::mutex> lock(buffer->mutex);
+                    buffer->orphaned = true;
+                }
+            }
+        };
+        thread_local Holder holder;
+
+        if (!holder.buffer)
+        {
+            holder.buffer = std::make_shared<LogStagingBuffer>();
+            std::lock_guard<std::mutex> lock(stagingRegistryMutex_);
+            stagingBuffers_.push_back(holder.buffer);
+        }
+        return *holder.buffer;
+    }
+
+    void Logger::StageRecord(LogRecord&& record)
+    {
+        LogStagingBuffer& buffer = GetStagingBuffer();
+        std::uint64_t timestamp = 0;
+        bool flushNow = false;
+
+        {
+            // Stamped under the buffer lock: a merge that starts later than
+            // this timestamp is sure to find the record (see FlushStaging)
+            std::lock_guard<std::mutex> lock(buffer.mutex);
+            timestamp = record.timestamp = LogClock::Now();
+            buffer.lineOffsets.push_back(buffer.text.size());
+            if (textNeeded_.load(std::memory_order_relaxed))
+                AppendRecord(buffer.text, record, buffer.timestamps);
+            buffer.records.push_back(std::move(record));
+
+            flushNow = buffer.text.size() >= stagingConfig_.flushThresholdBytes ||
+                       buffer.records.size() >= stagingConfig_.flushThresholdRecords;
+        }
+
+        if (flushNow || IsStagingDue(timestamp))
+            FlushStaging();
+    }
+
+    void Logger::PollStaging()
+    {
+        if (staging_.load(std::memory_order_acquire) && IsStagingDue(LogClock::Now()))
+            FlushStaging();
+    }
+
+    bool Logger::IsStagingDue(std::uint64_t now) const
+    {
+        const auto maxLatency = static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(stagingConfig_.maxLatency).count());
+        const std::uint64_t last = lastStagingFlush_.load(std::memory_order_relaxed);
+        return now >= last && now - last >= maxLatency;
+    }
+
+    // A merge writes the records stamped before its cut-off and holds the
+    // rest. Records are stamped under their buffer's lock, so any record
+    // older than the cut-off was staged before the merge reached its buffer
+    // and is part of this merge; one stamped later can only come in the
+    // next merge, whose cut-off is later still.
+    void Logger::FlushStaging(bool drainAll)
+    {
+        std::lock_guard<std::mutex> flushLock(stagingFlushMutex_);
+        const std::uint64_t now = LogClock::Now();
+        const std::uint64_t cutoff = drainAll ? std::numeric_limits<std::uint64_t>::max() : now;
+        lastStagingFlush_.store(now, std::memory_order_relaxed);
+
+        // --- Detach every thread's pending records ---
+        std::vector<LogStagedBatch> batches = std::move(stagingHeld_);
+        stagingHeld_.clear();
+        {
+            std::lock_guard<std::mutex> registryLock(stagingRegistryMutex_);
+            for (auto it = stagingBuffers_.begin(); it != stagingBuffers_.end();)
+            {
+                LogStagingBuffer& buffer = **it;
+                bool remove = false;
+                {
+                    std::lock_guard<std::mutex> lock(buffer.mutex);
+                    if (!buffer.records.empty())
+                    {
+                        LogStagedBatch batch;
+                        batch.records.swap(buffer.records);
+                        batch.text.swap(buffer.text);
+                        batch.lineOffsets.swap(buffer.lineOffsets);
+                        batch.lineOffsets.push_back(batch.text.size());
+                        batches.push_back(std::move(batch));
+                    }
+                    remove = buffer.orphaned;
+                }
+                it = remove ? stagingBuffers_.erase(it) : it + 1;
+            }
+        }
+
+        // --- Hold back what is at or past the cut-off ---
+        std::size_t total = 0;
+        for (LogStagedBatch& batch : batches)
+        {
+            const auto split = std::partition_point(batch.records.begin(), batch.records.end(),
+                [cutoff](const LogRecord& record) { return record.timestamp < cutoff; });
+            const std::size_t keep = static_cast<std::size_t>(split - batch.records.begin());
+            total += keep;
+            if (keep == batch.records.size())
+                continue;
+
+            LogStagedBatch held;
+            held.records.assign(std::make_move_iterator(split), std::make_move_iterator(batch.records.end()));
+            const std::size_t textStart = batch.lineOffsets[keep];
+            held.text.assign(batch.text, textStart);
+            for (std::size_t i = keep; i < batch.lineOffsets.size(); ++i)
+                held.lineOffsets.push_back(batch.lineOffsets[i] - textStart);
+            stagingHeld_.push_back(std::move(held));
+
+            batch.records.resize(keep);
+            batch.text.resize(textStart);
+            batch.lineOffsets.resize(keep + 1);
+        }
+        batches.erase(std::remove_if(batches.begin(), batches.end(),
+            [](const LogStagedBatch& batch) { return batch.records.empty(); }), batches.end());
+
+        if (total == 0)
+            return;
+
+        // --- K-way merge by timestamp (each batch is already in order) ---
+        std::vector<LogRecord> merged;
+        std::string mergedText;
+        std::vector<std::size_t> mergedOffsets;
+        merged.reserve(total);
+        mergedOffsets.reserve(total + 1);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        const bool needText = textNeeded_.load(std::memory_order_relaxed);
+
+        using Cursor = std::pair<std::uint64_t, std::size_t>; // (timestamp, batch)
+        std::vector<Cursor> heap;
+        std::vector<std::size_t> positions(batches.size(), 0);
+        for (std::size_t b = 0; b < batches.size(); ++b)
+            heap.emplace_back(batches[b].records.front().timestamp, b);
+
+        const auto later = [](const Cursor& a, const Cursor& b) { return a.first > b.first; };
+        std::make_heap(heap.begin(), heap.end(), later);
+
+        while (!heap.empty())
+        {
+            std::pop_heap(heap.begin(), heap.end(), later);
+            const std::size_t b = heap.back().second;
+            heap.pop_back();
+
+            LogStagedBatch& batch = batches[b];
+            const std::size_t i = positions[b]++;
+
+            if (needText)
+            {
+                mergedOffsets.push_back(mergedText.size());
+                const std::size_t begin = batch.lineOffsets[i];
+                const std::size_t end = batch.lineOffsets[i + 1];
+                if (end > begin)
+                    mergedText.append(batch.text, begin, end - begin);
+                else
+                    AppendRecord(mergedText, batch.records[i], timestamps_); // Text was off when staged
+            }
+            merged.push_back(std::move(batch.records[i]));
+
+            if (positions[b] < batch.records.size())
+            {
+                heap.emplace_back(batch.records[positions[b]].timestamp, b);
+                std::push_heap(heap.begin(), heap.end(), later);
+            }
+        }
+        mergedOffsets.push_back(mergedText.size());
+
+        WriteRecords(merged.data(), merged.size(), &mergedText, mergedOffsets.data());
+    }
+}
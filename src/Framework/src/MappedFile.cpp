@@ -0,0 +1,250 @@
+#include <Framework/MappedFile.hpp>
+
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace Aurum
+{
+#if defined(_WIN32)
+    namespace
+    {
+        HANDLE ToHandle(std::intptr_t handle) { return reinterpret_cast<HANDLE>(handle); }
+    }
+
+    bool MappedFile::Open(const std::string& path, Mode mode, std::size_t minSize)
+    {
+        Close();
+        mode_ = mode;
+
+        const DWORD access = (mode == Mode::Read) ? GENERIC_READ : (GENERIC_READ | GENERIC_WRITE);
+        const DWORD disposition = (mode == Mode::Read) ? OPEN_EXISTING : OPEN_ALWAYS;
+        HANDLE file = CreateFileA(path.c_str(), access, FILE_SHARE_READ, nullptr,
+                                  disposition, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return false;
+
+        handle_ = reinterpret_cast<std::intptr_t>(file);
+
+        LARGE_INTEGER fileSize{};
+        GetFileSizeEx(file, &fileSize);
+        size_ = static_cast<std::size_t>(fileSize.QuadPart);
+
+        if (mode == Mode::ReadWrite && size_ < minSize)
+            return Resize(minSize);
+
+        if (!Map())
+        {
+            Close();
+            return false;
+        }
+        return true;
+    }
+
+    bool MappedFile::Map()
+    {
+        if (size_ == 0)
+            return true; // Empty files cannot be mapped; Data() stays null
+
+        const DWORD protect = (mode_ == Mode::Read) ? PAGE_READONLY : PAGE_READWRITE;
+        const DWORD access = (mode_ == Mode::Read) ? FILE_MAP_READ : FILE_MAP_WRITE;
+        const auto size64 = static_cast<std::uint64_t>(size_);
+
+        mapping_ = CreateFileMappingA(ToHandle(handle_), nullptr, protect,
+                                      static_cast<DWORD>(size64 >> 32), static_cast<DWORD>(size64), nullptr);
+        if (!mapping_)
+            return false;
+
+        data_ = static_cast<std::uint8_t*>(MapViewOfFile(mapping_, access, 0, 0, size_));
+        return data_ != nullptr;
+    }
+
+    void MappedFile::Unmap()
+    {
+        if (data_)
+            UnmapViewOfFile(data_);
+        if (mapping_)
+            CloseHandle(mapping_);
+        data_ = nullptr;
+        mapping_ = nullptr;
+    }
+
+    bool MappedFile::Resize(std::size_t newSize)
+    {
+        if (!IsOpen() || mode_ != Mode::ReadWrite)
+            return false;
+
+        // Growing: a larger mapping object extends the file, so the new view
+        // is built next to the old one and swapped in only once it exists
+        if (newSize > size_)
+        {
+            const auto size64 = static_cast<std::uint64_t>(newSize);
+            HANDLE mapping = CreateFileMappingA(ToHandle(handle_), nullptr, PAGE_READWRITE,
+                                                static_cast<DWORD>(size64 >> 32), static_cast<DWORD>(size64), nullptr);
+            if (!mapping)
+                return false;
+
+            void* data = MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, newSize);
+            if (!data)
+            {
+                CloseHandle(mapping);
+                return false;
+            }
+
+            Unmap();
+            mapping_ = mapping;
+            data_ = static_cast<std::uint8_t*>(data);
+            size_ = newSize;
+            return true;
+        }
+
+        // Shrinking: SetEndOfFile fails while a view is open. On failure the
+        // old size is mapped again, and the file closed if even that fails.
+        Unmap();
+
+        LARGE_INTEGER position{};
+        position.QuadPart = static_cast<LONGLONG>(newSize);
+        if (!SetFilePointerEx(ToHandle(handle_), position, nullptr, FILE_BEGIN) ||
+            !SetEndOfFile(ToHandle(handle_)))
+        {
+            if (!Map())
+                Close();
+            return false;
+        }
+
+        size_ = newSize;
+        if (!Map())
+        {
+            Close();
+            return false;
+        }
+        return true;
+    }
+
+    void MappedFile::FlushAsync()
+    {
+        if (data_)
+            FlushViewOfFile(data_, 0);
+    }
+
+    void MappedFile::Close()
+    {
+        Unmap();
+        if (IsOpen())
+            CloseHandle(ToHandle(handle_));
+        handle_ = kInvalidHandle;
+        size_ = 0;
+    }
+#else
+    bool MappedFile::Open(const std::string& path, Mode mode, std::size_t minSize)
+    {
+        Close();
+        mode_ = mode;
+
+        const int flags = (mode == Mode::Read) ? O_RDONLY : (O_RDWR | O_CREAT);
+        const int fd = ::open(path.c_str(), flags, 0644);
+        if (fd < 0)
+            return false;
+
+        handle_ = fd;
+
+        struct stat info{};
+        if (::fstat(fd, &info) != 0)
+        {
+            Close();
+            return false;
+        }
+        size_ = static_cast<std::size_t>(info.st_size);
+
+        if (mode == Mode::ReadWrite && size_ < minSize)
+            return Resize(minSize);
+
+        if (!Map())
+        {
+            Close();
+            return false;
+        }
+        return true;
+    }
+
+    bool MappedFile::Map()
+    {
+        if (size_ == 0)
+            return true; // Empty files cannot be mapped; Data() stays null
+
+        const int protect = (mode_ == Mode::Read) ? PROT_READ : (PROT_READ | PROT_WRITE);
+        void* data = ::mmap(nullptr, size_, protect, MAP_SHARED, static_cast<int>(handle_), 0);
+        if (data == MAP_FAILED)
+            return false;
+
+        data_ = static_cast<std::uint8_t*>(data);
+        return true;
+    }
+
+    void MappedFile::Unmap()
+    {
+        if (data_)
+            ::munmap(data_, size_);
+        data_ = nullptr;
+    }
+
+    bool MappedFile::Resize(std::size_t newSize)
+    {
+        if (!IsOpen() || mode_ != Mode::ReadWrite)
+            return false;
+
+        // The old view stays mapped until the new one exists, so a failed
+        // grow (disk full, size limit) leaves Data() valid for Size()
+        const int fd = static_cast<int>(handle_);
+        const std::size_t oldSize = size_;
+        if (newSize > oldSize && ::ftruncate(fd, static_cast<off_t>(newSize)) != 0)
+            return false;
+
+        void* data = nullptr;
+        if (newSize > 0)
+        {
+            data = ::mmap(nullptr, newSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if (data == MAP_FAILED)
+            {
+                if (newSize > oldSize)
+                    (void)::ftruncate(fd, static_cast<off_t>(oldSize));
+                return false;
+            }
+        }
+
+        Unmap();
+        data_ = static_cast<std::uint8_t*>(data);
+        size_ = newSize;
+
+        // Shrinking last: nothing maps the cut-off pages any more. If the
+        // file stays longer the view is still valid, just smaller.
+        return newSize >= oldSize || ::ftruncate(fd, static_cast<off_t>(newSize)) == 0;
+    }
+
+    void MappedFile::FlushAsync()
+    {
+        if (data_)
+            ::msync(data_, size_, MS_ASYNC);
+    }
+
+    void MappedFile::Close()
+    {
+        Unmap();
+        if (IsOpen())
+            ::close(static_cast<int>(handle_));
+        handle_ = kInvalidHandle;
+        size_ = 0;
+    }
+#endif
+}
@@ -1,5 +1,6 @@
 #include <Framework/Math/Math.hpp>
 
-// Currently, all math types are header-only for inlining and performance.
+// Currently, all math types are header-only for inlining and performance;
+// the SIMD kernels live in Math/Simd.hpp for the same reason.
 // This file exists as a placeholder to ensure CMake tracks the Math module,
-// and will host any compiled math utilities added later (e.g., noise, random, SIMD ops).
+// and will host any compiled math utilities added later (e.g., noise, random).
@@ -0,0 +1,141 @@
+#include <Framework/MemoryTracker.hpp>
+
+// ------------------------------------------------------------
+// Global operator new/delete replacement (AURUM_GLOBAL_NEW_HOOK)
+// ------------------------------------------------------------
+// Every block carries a 16-byte header in front of the user pointer with
+// its size, tag and sampled site, so deletes are attributed exactly even
+// through the unsized operator delete.
+#if AURUM_GLOBAL_NEW_HOOK
+
+#include <cstdlib>
+#include <new>
+
+#if defined(_WIN32)
+    #include <malloc.h>
+#endif
+
+namespace
+{
+    using namespace Aurum;
+
+    struct AllocationHeader
+    {
+        std::uint64_t size;
+        std::uint16_t tag;
+        std::uint16_t siteWeight;
+        std::uint32_t site;
+    };
+    static_assert(sizeof(AllocationHeader) == 16);
+
+    constexpr std::size_t kHeaderBytes = sizeof(AllocationHeader);
+
+    // The tracker itself, stack capture and the report code may allocate
+    thread_local bool inHook = false;
+
+    void* AllocateBlock(std::size_t bytes, std::size_t align)
+    {
+        if (align <= kHeaderBytes)
+            return std::malloc(bytes);
+#if defined(_WIN32)
+        return _aligned_malloc(bytes, align);
+#else
+        void* block = nullptr;
+        return (posix_memalign(&block, align, bytes) == 0) ? block : nullptr;
+#endif
+    }
+
+    void FreeBlock(void* block, std::size_t align)
+    {
+#if defined(_WIN32)
+        if (align > kHeaderBytes)
+        {
+            _aligned_free(block);
+            return;
+        }
+#endif
+        (void)align;
+        std::free(block);
+    }
+
+    void* Allocate(std::size_t size, std::size_t align, bool nothrow)
+    {
+        // The header sits right before the user pointer; over-aligned blocks
+        // put the user pointer one alignment unit in
+        const std::size_t offset = std::max(align, kHeaderBytes);
+        void* block;
+        while (!(block = AllocateBlock(size + offset, align)))
+        {
+            std::new_handler handler = std::get_new_handler();
+            if (!handler)
+            {
+                if (nothrow)
+                    return nullptr;
+                throw std::bad_alloc();
+            }
+            handler();
+        }
+
+        auto* user = static_cast<char*>(block) + offset;
+        auto* header = reinterpret_cast<AllocationHeader*>(user) - 1;
+        header->size = size;
+        header->tag = MemoryTracker::CurrentTag();
+        header->siteWeight = 0;
+        header->site = kNoMemorySite;
+
+        if (!inHook)
+        {
+            inHook = true;
+            MemoryTracker& tracker = MemoryTracker::Get();
+            header->site = tracker.SampleStackSite(header->tag, 1); // Skip operator new
+            if (header->site != kNoMemorySite)
+                header->siteWeight = static_cast<std::uint16_t>(tracker.GetSampleInterval());
+            tracker.RegisterAllocation(size, header->tag, header->site, header->siteWeight);
+            inHook = false;
+        }
+        return user;
+    }
+
+    void Free(void* ptr, std::size_t align)
+    {
+        if (!ptr)
+            return;
+
+        auto* header = static_cast<AllocationHeader*>(ptr) - 1;
+        if (!inHook)
+        {
+            inHook = true;
+            MemoryTracker::Get().RegisterDeallocation(static_cast<std::size_t>(header->size), header->tag,
+                                                      header->site, header->siteWeight);
+            inHook = false;
+        }
+        FreeBlock(static_cast<char*>(ptr) - std::max(align, kHeaderBytes), align);
+    }
+
+    constexpr std::size_t kDefaultAlign = kHeaderBytes;
+    std::size_t ToSize(std::align_val_t align) { return static_cast<std::size_t>(align); }
+}
+
+void* operator new(std::size_t size) { return Allocate(size, kDefaultAlign, false); }
+void* operator new[](std::size_t size) { return Allocate(size, kDefaultAlign, false); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return Allocate(size, kDefaultAlign, true); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return Allocate(size, kDefaultAlign, true); }
+void* operator new(std::size_t size, std::align_val_t align) { return Allocate(size, ToSize(align), false); }
+void* operator new[](std::size_t size, std::align_val_t align) { return Allocate(size, ToSize(align), false); }
+void* operator new(std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept { return Allocate(size, ToSize(align), true); }
+void* operator new[](std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept { return Allocate(size, ToSize(align), true); }
+
+void operator delete(void* ptr) noexcept { Free(ptr, kDefaultAlign); }
+void operator delete[](void* ptr) noexcept { Free(ptr, kDefaultAlign); }
+void operator delete(void* ptr, std::size_t) noexcept { Free(ptr, kDefaultAlign); }
+void operator delete[](void* ptr, std::size_t) noexcept { Free(ptr, kDefaultAlign); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { Free(ptr, kDefaultAlign); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { Free(ptr, kDefaultAlign); }
+void operator delete(void* ptr, std::align_val_t align) noexcept { Free(ptr, ToSize(align)); }
+void operator delete[](void* ptr, std::align_val_t align) noexcept { Free(ptr, ToSize(align)); }
+void operator delete(void* ptr, std::size_t, std::align_val_t align) noexcept { Free(ptr, ToSize(align)); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t align) noexcept { Free(ptr, ToSize(align)); }
+void operator delete(void* ptr, std::align_val_t align, const std::nothrow_t&) noexcept { Free(ptr, ToSize(align)); }
+void operator delete[](void* ptr, std::align_val_t align, const std::nothrow_t&) noexcept { Free(ptr, ToSize(align)); }
+
+#endif
@@ -1,2 +1,372 @@
 #include <Framework/MemoryTracker.hpp>
-// Implementation handled in header for now.
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+
+namespace Aurum
+{
+    namespace
+    {
+        std::mutex& TagMutex()
+        {
+            static std::mutex mutex;
+            return mutex;
+        }
+
+        std::string FormatBytes(double bytes)
+        {
+            char buffer[32];
+            if (bytes >= 1024.0 * 1024.0)
+                std::snprintf(buffer, sizeof(buffer), "%.2f MiB", bytes / (1024.0 * 1024.0));
+            else if (bytes >= 1024.0)
+                std::snprintf(buffer, sizeof(buffer), "%.2f KiB", bytes / 1024.0);
+            else
+                std::snprintf(buffer, sizeof(buffer), "%.0f B", bytes);
+            return buffer;
+        }
+    }
+
+    MemoryTracker::MemoryTracker()
+    {
+        tagNames_[kUntaggedMemory].store("Untagged", std::memory_order_relaxed);
+    }
+
+    // ------------------------------------------------------------
+    // Thread Slots
+    // ------------------------------------------------------------
+    MemoryThreadSlot& MemoryTracker::ClaimSlot()
+    {
+        for (std::size_t i = 0; i + 1 < kMaxSlots; ++i)
+        {
+            bool expected = false;
+            if (slots_[i].inUse.compare_exchange_strong(expected, true, std::memory_order_acquire))
+            {
+                // Publish the slot to readers before it gets used
+                std::size_t count = slotCount_.load(std::memory_order_relaxed);
+                while (count < i + 1 && !slotCount_.compare_exchange_weak(count, i + 1, std::memory_order_release)) {}
+                return slots_[i];
+            }
+        }
+
+        slotCount_.store(kMaxSlots, std::memory_order_release);
+        return slots_.back();
+    }
+
+    void MemoryTracker::FoldPending(MemoryThreadSlot& slot)
+    {
+        const std::int64_t delta = slot.pendingBytes.exchange(0, std::memory_order_relaxed);
+        UpdatePeak(foldedLiveBytes_.fetch_add(delta, std::memory_order_relaxed) + delta);
+    }
+
+    void MemoryTracker::UpdatePeak(std::int64_t live)
+    {
+        if (live <= 0)
+            return;
+        std::uint64_t peak = peakBytes_.load(std::memory_order_relaxed);
+        while (static_cast<std::uint64_t>(live) > peak &&
+               !peakBytes_.compare_exchange_weak(peak, static_cast<std::uint64_t>(live), std::memory_order_relaxed)) {}
+    }
+
+    // ------------------------------------------------------------
+    // Tags
+    // ------------------------------------------------------------
+    std::uint16_t MemoryTracker::RegisterTag(const char* name)
+    {
+        std::lock_guard<std::mutex> lock(TagMutex());
+        const std::uint32_t count = tagCount_.load(std::memory_order_relaxed);
+        for (std::uint32_t i = 0; i < count; ++i)
+        {
+            const char* existing = tagNames_[i].load(std::memory_order_relaxed);
+            if (existing == name || std::strcmp(existing, name) == 0)
+                return static_cast<std::uint16_t>(i);
+        }
+
+        if (count >= kMaxMemoryTags)
+            return kUntaggedMemory;
+        tagNames_[count].store(name, std::memory_order_relaxed);
+        tagCount_.store(count + 1, std::memory_order_release);
+        return static_cast<std::uint16_t>(count);
+    }
+
+    const char* MemoryTracker::GetTagName(std::uint16_t tag) const
+    {
+        const char* name = (tag < kMaxMemoryTags) ? tagNames_[tag].load(std::memory_order_relaxed) : nullptr;
+        return name ? name : "Untagged";
+    }
+
+    // ------------------------------------------------------------
+    // Sites
+    // ------------------------------------------------------------
+    template <typename Init>
+    std::uint32_t MemoryTracker::FindOrAddSite(std::uint64_t key, Init&& init)
+    {
+        key |= 1; // 0 marks a free entry
+        constexpr std::size_t kMaxProbes = 64;
+        std::size_t index = static_cast<std::size_t>(key >> 7) % kMaxSites;
+        for (std::size_t probe = 0; probe < kMaxProbes; ++probe, index = (index + 1) % kMaxSites)
+        {
+            MemorySite& site = sites_[index];
+            std::uint64_t current = site.key.load(std::memory_order_acquire);
+            if (current == 0 && site.key.compare_exchange_strong(current, key, std::memory_order_acq_rel))
+            {
+                init(site.info);
+                site.ready.store(true, std::memory_order_release);
+                return static_cast<std::uint32_t>(index);
+            }
+            if (current == key)
+                return static_cast<std::uint32_t>(index);
+        }
+        return kNoMemorySite; // Table full around this key: counted, not attributed
+    }
+
+    std::uint32_t MemoryTracker::FindSourceSite(const char* file, int line, std::uint16_t tag)
+    {
+        const std::uint64_t key = (reinterpret_cast<std::uintptr_t>(file) * 1099511628211ull) ^
+                                  (static_cast<std::uint64_t>(line) << 16) ^ tag;
+        return FindOrAddSite(key, [&](MemorySiteStats& info) {
+            info.file = file;
+            info.line = line;
+            info.tag = tag;
+        });
+    }
+
+    std::uint32_t MemoryTracker::CaptureStackSite(std::uint16_t tag, std::size_t skipFrames)
+    {
+        void* frames[CallStack::kMaxFrames];
+        const std::size_t depth = CallStack::Capture(frames, CallStack::kMaxFrames, skipFrames + 1);
+        if (depth == 0)
+            return kNoMemorySite;
+
+        return FindOrAddSite(CallStack::Hash(frames, depth) ^ tag, [&](MemorySiteStats& info) {
+            info.tag = tag;
+            info.depth = depth;
+            std::copy(frames, frames + depth, info.frames);
+        });
+    }
+
+    // ------------------------------------------------------------
+    // Reading
+    // ------------------------------------------------------------
+    MemoryStats MemoryTracker::GetStats() const
+    {
+        MemoryStats stats;
+        const std::size_t count = slotCount_.load(std::memory_order_acquire);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const MemoryThreadSlot& slot = slots_[i];
+            stats.allocatedBytes += slot.allocatedBytes.load(std::memory_order_relaxed);
+            stats.freedBytes += slot.freedBytes.load(std::memory_order_relaxed);
+            stats.allocations += slot.allocations.load(std::memory_order_relaxed);
+            stats.deallocations += slot.deallocations.load(std::memory_order_relaxed);
+        }
+
+        stats.liveBytes = static_cast<std::int64_t>(stats.allocatedBytes - stats.freedBytes);
+        stats.peakBytes = std::max<std::uint64_t>(peakBytes_.load(std::memory_order_relaxed),
+                                                  static_cast<std::uint64_t>(std::max<std::int64_t>(stats.liveBytes, 0)));
+        stats.frameAllocations = frameAllocations_.load(std::memory_order_relaxed);
+        stats.frameBytes = frameBytes_.load(std::memory_order_relaxed);
+        stats.frameIndex = frameIndex_.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    std::vector<MemoryTagStats> MemoryTracker::GetTagStats() const
+    {
+        const std::uint32_t tagCount = tagCount_.load(std::memory_order_acquire);
+        std::vector<MemoryTagStats> tags(tagCount);
+        std::vector<std::uint64_t> freed(tagCount, 0);
+
+        const std::size_t slotCount = slotCount_.load(std::memory_order_acquire);
+        for (std::size_t i = 0; i < slotCount; ++i)
+        {
+            for (std::uint32_t tag = 0; tag < tagCount; ++tag)
+            {
+                const MemoryTagCounters& counters = slots_[i].tags[tag];
+                tags[tag].allocations += counters.allocations.load(std::memory_order_relaxed);
+                tags[tag].allocatedBytes += counters.allocatedBytes.load(std::memory_order_relaxed);
+                freed[tag] += counters.freedBytes.load(std::memory_order_relaxed);
+            }
+        }
+
+        for (std::uint32_t tag = 0; tag < tagCount; ++tag)
+        {
+            tags[tag].name = GetTagName(static_cast<std::uint16_t>(tag));
+            tags[tag].liveBytes = static_cast<std::int64_t>(tags[tag].allocatedBytes - freed[tag]);
+            tags[tag].frameAllocations = tagFrameAllocations_[tag].load(std::memory_order_relaxed);
+            tags[tag].frameBytes = tagFrameBytes_[tag].load(std::memory_order_relaxed);
+        }
+        return tags;
+    }
+
+    void MemoryTracker::UpdateArena(const MemoryArenaStats& stats)
+    {
+        std::lock_guard<std::mutex> lock(registryMutex_);
+        for (std::size_t i = 0; i < arenaCount_; ++i)
+        {
+            if (arenas_[i].name == stats.name)
+            {
+                arenas_[i] = stats;
+                return;
+            }
+        }
+        if (arenaCount_ < kMaxArenas)
+            arenas_[arenaCount_++] = stats;
+    }
+
+    std::vector<MemoryArenaStats> MemoryTracker::GetArenaStats() const
+    {
+        std::lock_guard<std::mutex> lock(registryMutex_);
+        return { arenas_.begin(), arenas_.begin() + static_cast<std::ptrdiff_t>(arenaCount_) };
+    }
+
+    void MemoryTracker::AddPool(const MemoryPoolSource* pool)
+    {
+        std::lock_guard<std::mutex> lock(registryMutex_);
+        pools_.push_back(pool);
+    }
+
+    void MemoryTracker::RemovePool(const MemoryPoolSource* pool)
+    {
+        std::lock_guard<std::mutex> lock(registryMutex_);
+        pools_.erase(std::remove(pools_.begin(), pools_.end(), pool), pools_.end());
+    }
+
+    std::vector<MemoryPoolStats> MemoryTracker::GetPoolStats() const
+    {
+        std::lock_guard<std::mutex> lock(registryMutex_);
+        std::vector<MemoryPoolStats> stats;
+        stats.reserve(pools_.size());
+        for (const MemoryPoolSource* pool : pools_)
+            stats.push_back(pool->GetPoolStats());
+        return stats;
+    }
+
+    std::vector<MemorySiteStats> MemoryTracker::GetTopSites(std::size_t count, bool byCount) const
+    {
+        std::vector<MemorySiteStats> sites;
+        for (const MemorySite& site : sites_)
+        {
+            if (!site.ready.load(std::memory_order_acquire))
+                continue;
+
+            MemorySiteStats stats = site.info;
+            stats.allocations = site.allocations.load(std::memory_order_relaxed);
+            stats.allocatedBytes = site.allocatedBytes.load(std::memory_order_relaxed);
+            stats.liveBytes = static_cast<std::int64_t>(stats.allocatedBytes - site.freedBytes.load(std::memory_order_relaxed));
+            if (stats.allocations > 0)
+                sites.push_back(stats);
+        }
+
+        const auto key = [byCount](const MemorySiteStats& site) { return byCount ? site.allocations : site.allocatedBytes; };
+        const std::size_t n = std::min(count, sites.size());
+        std::partial_sort(sites.begin(), sites.begin() + n, sites.end(),
+                          [&](const MemorySiteStats& a, const MemorySiteStats& b) { return key(a) > key(b); });
+        sites.resize(n);
+        return sites;
+    }
+
+    void MemoryTracker::EndFrame()
+    {
+        // Per-tag frame window
+        const std::vector<MemoryTagStats> tags = GetTagStats();
+        for (std::size_t tag = 0; tag < tags.size(); ++tag)
+        {
+            tagFrameAllocations_[tag].store(tags[tag].allocations - tagFrameBaseAllocations_[tag], std::memory_order_relaxed);
+            tagFrameBytes_[tag].store(tags[tag].allocatedBytes - tagFrameBaseBytes_[tag], std::memory_order_relaxed);
+            tagFrameBaseAllocations_[tag] = tags[tag].allocations;
+            tagFrameBaseBytes_[tag] = tags[tag].allocatedBytes;
+        }
+
+        const MemoryStats stats = GetStats();
+        UpdatePeak(stats.liveBytes); // Exact sample once per frame
+
+        frameAllocations_.store(stats.allocations - frameBaseAllocations_, std::memory_order_relaxed);
+        frameBytes_.store(stats.allocatedBytes - frameBaseBytes_, std::memory_order_relaxed);
+        frameIndex_.fetch_add(1, std::memory_order_relaxed);
+        frameBaseAllocations_ = stats.allocations;
+        frameBaseBytes_ = stats.allocatedBytes;
+    }
+
+    void MemoryTracker::Report() const
+    {
+        const MemoryStats stats = GetStats();
+        Logger::Get().Log("=== Memory Report ===", LogLevel::Info);
+        Logger::Get().Log("Allocated:   " + std::to_string(stats.allocatedBytes) + " bytes", LogLevel::Info);
+        Logger::Get().Log("Freed:       " + std::to_string(stats.freedBytes) + " bytes", LogLevel::Info);
+        Logger::Get().Log("Live:        " + std::to_string(stats.liveBytes) + " bytes", LogLevel::Info);
+        Logger::Get().Log("Peak:        " + std::to_string(stats.peakBytes) + " bytes", LogLevel::Info);
+        Logger::Get().Log("Allocations: " + std::to_string(stats.allocations), LogLevel::Info);
+        Logger::Get().Log("Deallocs:    " + std::to_string(stats.deallocations), LogLevel::Info);
+        Logger::Get().Log("Last frame:  " + std::to_string(stats.frameAllocations) + " allocs, " +
+                          std::to_string(stats.frameBytes) + " bytes", LogLevel::Info);
+        for (const MemoryArenaStats& arena : GetArenaStats())
+        {
+            Logger::Get().Log(std::string(arena.name) + ": " + FormatBytes(static_cast<double>(arena.frameBytes)) + " last frame, " +
+                              FormatBytes(static_cast<double>(arena.peakFrameBytes)) + " peak, " +
+                              FormatBytes(static_cast<double>(arena.committedBytes)) + " committed", LogLevel::Info);
+        }
+        for (const MemoryPoolStats& pool : GetPoolStats())
+        {
+            Logger::Get().Log(std::string(pool.name) + ": " + FormatBytes(static_cast<double>(pool.liveBytes)) + " live, " +
+                              FormatBytes(static_cast<double>(pool.peakBytes)) + " peak, " +
+                              FormatBytes(static_cast<double>(pool.committedBytes)) + " committed, " +
+                              std::to_string(pool.allocations) + " allocs", LogLevel::Info);
+        }
+        Logger::Get().Log("=====================", LogLevel::Info);
+    }
+
+    void MemoryTracker::ReportTags() const
+    {
+        std::vector<MemoryTagStats> tags = GetTagStats();
+        std::sort(tags.begin(), tags.end(), [](const MemoryTagStats& a, const MemoryTagStats& b) {
+            return a.allocatedBytes > b.allocatedBytes;
+        });
+
+        Logger::Get().Log("=== Memory By Tag ===", LogLevel::Info);
+        for (const MemoryTagStats& tag : tags)
+        {
+            if (tag.allocations == 0)
+                continue;
+            char line[256];
+            std::snprintf(line, sizeof(line), "%-16s %10llu allocs %12s total %12s live | last frame %6llu allocs %12s",
+                          tag.name, static_cast<unsigned long long>(tag.allocations),
+                          FormatBytes(static_cast<double>(tag.allocatedBytes)).c_str(),
+                          FormatBytes(static_cast<double>(tag.liveBytes)).c_str(),
+                          static_cast<unsigned long long>(tag.frameAllocations),
+                          FormatBytes(static_cast<double>(tag.frameBytes)).c_str());
+            Logger::Get().Log(line, LogLevel::Info);
+        }
+        Logger::Get().Log("=====================", LogLevel::Info);
+    }
+
+    void MemoryTracker::ReportSites(std::size_t topN) const
+    {
+        const auto logSites = [this](const char* title, const std::vector<MemorySiteStats>& sites) {
+            Logger::Get().Log(title, LogLevel::Info);
+            for (std::size_t i = 0; i < sites.size(); ++i)
+            {
+                const MemorySiteStats& site = sites[i];
+                char line[256];
+                std::snprintf(line, sizeof(line), "#%-2zu %10llu allocs %12s total %12s live [%s]",
+                              i + 1, static_cast<unsigned long long>(site.allocations),
+                              FormatBytes(static_cast<double>(site.allocatedBytes)).c_str(),
+                              FormatBytes(static_cast<double>(site.liveBytes)).c_str(), GetTagName(site.tag));
+                Logger::Get().Log(line, LogLevel::Info);
+
+                if (site.file)
+                {
+                    Logger::Get().Log(std::string("      at ") + site.file + ":" + std::to_string(site.line), LogLevel::Info);
+                    continue;
+                }
+                for (std::size_t frame = 0; frame < site.depth; ++frame)
+                    Logger::Get().Log("      at " + CallStack::Symbolize(site.frames[frame]), LogLevel::Info);
+            }
+        };
+
+        logSites("=== Top Sites By Bytes ===", GetTopSites(topN, false));
+        logSites("=== Top Sites By Count ===", GetTopSites(topN, true));
+        if (GetSampleInterval() > 1)
+            Logger::Get().Log("Call-stack sites are sampled 1 in " + std::to_string(GetSampleInterval()) + " and scaled", LogLevel::Info);
+        Logger::Get().Log("==========================", LogLevel::Info);
+    }
+}
@@ -0,0 +1,195 @@
+#include <Framework/Profiler.hpp>
+#include <algorithm>
+#include <cstdio>
+
+namespace Aurum
+{
+    namespace
+    {
+        std::uint32_t FindOrAddChild(std::vector<ProfileNode>& nodes, std::uint32_t parent, const ProfileSite* site)
+        {
+            std::uint32_t* link = &nodes[parent].firstChild;
+            while (*link != ProfileNode::kNone)
+            {
+                if (nodes[*link].site == site)
+                    return *link;
+                link = &nodes[*link].nextSibling;
+            }
+
+            const auto index = static_cast<std::uint32_t>(nodes.size());
+            *link = index; // Appending keeps first-seen order
+            ProfileNode node;
+            node.site = site;
+            node.parent = parent;
+            nodes.push_back(node);
+            return index;
+        }
+
+        void AppendNode(std::string& out, const std::vector<ProfileNode>& nodes, std::uint32_t index, int depth)
+        {
+            for (std::uint32_t child = nodes[index].firstChild; child != ProfileNode::kNone; child = nodes[child].nextSibling)
+            {
+                const ProfileNode& node = nodes[child];
+                if (node.calls == 0 && node.firstChild == ProfileNode::kNone)
+                    continue;
+
+                char line[256];
+                std::snprintf(line, sizeof(line), "%*s%-*s %6u calls %9.3f ms incl %9.3f ms excl\n",
+                              2 * depth, "", 32 - 2 * depth, node.site->name,
+                              node.calls, node.inclusive * 1e-6, node.exclusive * 1e-6);
+                out += line;
+                AppendNode(out, nodes, child, depth + 1);
+            }
+        }
+    }
+
+    // ------------------------------------------------------------
+    // Threads
+    // ------------------------------------------------------------
+    ProfileThreadBuffer& Profiler::RegisterThread()
+    {
+        std::lock_guard<std::mutex> lock(threadsMutex_);
+        const std::uint32_t index = nextThreadIndex_++;
+        threads_.push_back(std::make_unique<ProfileThreadBuffer>(index));
+        threads_.back()->name_ = "Thread " + std::to_string(index);
+        return *threads_.back();
+    }
+
+    void Profiler::SetThreadName(const std::string& name)
+    {
+        ProfileThreadBuffer& buffer = ThreadBuffer();
+        std::lock_guard<std::mutex> lock(threadsMutex_);
+        buffer.name_ = name;
+    }
+
+    void Profiler::SetListener(ProfileListener* listener)
+    {
+        std::lock_guard<std::mutex> lock(threadsMutex_);
+        listener_ = listener;
+    }
+
+    // ------------------------------------------------------------
+    // Frame Collection
+    // ------------------------------------------------------------
+    void Profiler::EndFrame()
+    {
+        TscClock::Recalibrate();
+        const std::uint64_t now = Now();
+
+        frame_.index = frameIndex_++;
+        frame_.begin = frameBegin_;
+        frame_.end = now;
+        frame_.dropped = 0;
+        frameBegin_ = now;
+
+        std::lock_guard<std::mutex> lock(threadsMutex_);
+        frame_.threads.resize(threads_.size());
+        bool anyRetired = false;
+        for (std::size_t i = 0; i < threads_.size(); ++i)
+        {
+            ProfileThreadBuffer& buffer = *threads_[i];
+            ProfileThreadTree& tree = frame_.threads[i];
+
+            // Checked before draining: an exited thread's last events are
+            // all visible once retired_ is
+            const bool retired = buffer.retired_.load(std::memory_order_acquire);
+            tree.thread = buffer.index_;
+            tree.name = buffer.name_;
+            BuildTree(buffer, tree);
+            frame_.dropped += buffer.dropped_.exchange(0, std::memory_order_relaxed);
+            anyRetired |= retired;
+        }
+
+        // Exited threads appear in this frame one last time, then are freed
+        if (anyRetired)
+        {
+            std::erase_if(threads_, [](const std::unique_ptr<ProfileThreadBuffer>& buffer)
+            {
+                return buffer->retired_.load(std::memory_order_relaxed) &&
+                       buffer->read_.load(std::memory_order_relaxed) == buffer->write_.load(std::memory_order_acquire);
+            });
+        }
+
+        if (listener_)
+            listener_->OnFrameEnd(frame_);
+    }
+
+    void Profiler::BuildTree(ProfileThreadBuffer& buffer, ProfileThreadTree& tree)
+    {
+        std::vector<ProfileNode>& nodes = tree.nodes;
+        nodes.clear();
+        nodes.emplace_back();
+
+        // Zones still open from earlier frames keep their place in the tree
+        std::uint32_t parent = 0;
+        for (auto& zone : buffer.open_)
+        {
+            zone.node = FindOrAddChild(nodes, parent, zone.site);
+            parent = zone.node;
+        }
+
+        const std::uint64_t read = buffer.read_.load(std::memory_order_relaxed);
+        const std::uint64_t write = buffer.write_.load(std::memory_order_acquire);
+        for (std::uint64_t i = read; i < write; ++i)
+        {
+            const ProfileEvent& event = buffer.events_[i & (ProfileThreadBuffer::kCapacity - 1)];
+            if (event.site)
+            {
+                const std::uint32_t top = buffer.open_.empty() ? 0 : buffer.open_.back().node;
+                buffer.open_.push_back({ event.site, event.time, FindOrAddChild(nodes, top, event.site) });
+            }
+            else if (!buffer.open_.empty())
+            {
+                const auto zone = buffer.open_.back();
+                buffer.open_.pop_back();
+                ProfileNode& node = nodes[zone.node];
+                node.calls++;
+                node.inclusive += event.time - zone.start;
+            }
+        }
+
+        // The ring may wrap: hand the listener up to two contiguous runs
+        if (listener_ && write > read)
+        {
+            const std::size_t mask = ProfileThreadBuffer::kCapacity - 1;
+            const std::size_t first = static_cast<std::size_t>(read & mask);
+            const std::size_t count = static_cast<std::size_t>(write - read);
+            const std::size_t head = std::min(count, ProfileThreadBuffer::kCapacity - first);
+            listener_->OnThreadEvents(tree, &buffer.events_[first], head);
+            if (head < count)
+                listener_->OnThreadEvents(tree, &buffer.events_[0], count - head);
+        }
+        buffer.read_.store(write, std::memory_order_release);
+
+        // Exclusive = inclusive minus the children's inclusive time. Children
+        // always follow their parent, so a reverse pass sees them first. A
+        // zone that is still open has no time yet and reports 0.
+        for (std::size_t i = nodes.size() - 1; i >= 1; --i)
+        {
+            ProfileNode& node = nodes[i];
+            node.exclusive = (node.inclusive > node.exclusive) ? node.inclusive - node.exclusive : 0;
+            if (node.parent == 0)
+                nodes[0].inclusive += node.inclusive;
+            else
+                nodes[node.parent].exclusive += node.inclusive; // Children total, until the parent is visited
+        }
+    }
+
+    std::string ProfileFrame::ToString() const
+    {
+        char header[128];
+        std::snprintf(header, sizeof(header), "Frame %llu (%.3f ms, %llu events dropped)\n",
+                      static_cast<unsigned long long>(index), (end - begin) * 1e-6,
+                      static_cast<unsigned long long>(dropped));
+
+        std::string out = header;
+        for (const ProfileThreadTree& tree : threads)
+        {
+            if (tree.nodes.size() <= 1)
+                continue;
+            out += "[" + tree.name + "]\n";
+            AppendNode(out, tree.nodes, 0, 1);
+        }
+        return out;
+    }
+}
@@ -0,0 +1,194 @@
+#include <Framework/SmallObjectAllocator.hpp>
+#include <algorithm>
+
+namespace Aurum
+{
+    namespace
+    {
+        constexpr std::size_t kBatchesPerSpan = 8;
+    }
+
+    // ------------------------------------------------------------
+    // Thread caches
+    // ------------------------------------------------------------
+    SmallObjectAllocator::ThreadCache* SmallObjectAllocator::CreateCache()
+    {
+        auto* cache = new ThreadCache();
+        std::lock_guard<std::mutex> lock(registryMutex_);
+        cache->nextCache = caches_;
+        caches_ = cache;
+        return cache;
+    }
+
+    void SmallObjectAllocator::RetireCache(ThreadCache* cache)
+    {
+        for (std::size_t sizeClass = 0; sizeClass < kClassCount; ++sizeClass)
+        {
+            ThreadCache::List& list = cache->lists[sizeClass];
+            while (list.count >= kBatchSizes[sizeClass])
+                ReleaseBatch(list, sizeClass);
+            if (!list.head)
+                continue;
+
+            // Leftovers go to the loose list
+            Block* tail = list.head;
+            while (tail->next)
+                tail = tail->next;
+
+            CentralList& central = central_[sizeClass];
+            AddOutstanding(-static_cast<std::int64_t>(list.count) * kClassSizes[sizeClass]);
+            std::lock_guard<std::mutex> lock(central.mutex);
+            tail->next = central.loose;
+            central.loose = list.head;
+            central.looseCount += list.count;
+            list = {};
+        }
+
+        std::lock_guard<std::mutex> lock(registryMutex_);
+        for (ThreadCache** link = &caches_; *link; link = &(*link)->nextCache)
+        {
+            if (*link == cache)
+            {
+                *link = cache->nextCache;
+                break;
+            }
+        }
+        retiredLiveBytes_ += cache->liveBytes.load(std::memory_order_relaxed);
+        retiredAllocations_ += cache->allocations.load(std::memory_order_relaxed);
+        delete cache;
+    }
+
+    // ------------------------------------------------------------
+    // Central lists
+    // ------------------------------------------------------------
+    void SmallObjectAllocator::Refill(ThreadCache::List& list, std::size_t sizeClass)
+    {
+        const std::uint32_t batchSize = kBatchSizes[sizeClass];
+        CentralList& central = central_[sizeClass];
+        {
+            std::unique_lock<std::mutex> lock(central.mutex);
+            if (Batch* batch = central.batches)
+            {
+                central.batches = batch->nextBatch;
+                lock.unlock();
+                list.head = reinterpret_cast<Block*>(batch);
+                list.count = batchSize;
+                AddOutstanding(static_cast<std::int64_t>(batchSize) * kClassSizes[sizeClass]);
+                return;
+            }
+
+            if (central.loose)
+            {
+                list.head = central.loose;
+                list.count = central.looseCount;
+                central.loose = nullptr;
+                central.looseCount = 0;
+                lock.unlock();
+                AddOutstanding(static_cast<std::int64_t>(list.count) * kClassSizes[sizeClass]);
+                return;
+            }
+        }
+
+        // Carve outside the lock; keep one batch, publish the rest
+        Batch* batches = CarveSpan(sizeClass);
+        list.head = reinterpret_cast<Block*>(batches);
+        list.count = batchSize;
+        AddOutstanding(static_cast<std::int64_t>(batchSize) * kClassSizes[sizeClass]);
+
+        Batch* rest = batches->nextBatch;
+        if (!rest)
+            return;
+        Batch* last = rest;
+        while (last->nextBatch)
+            last = last->nextBatch;
+
+        std::lock_guard<std::mutex> lock(central.mutex);
+        last->nextBatch = central.batches;
+        central.batches = rest;
+    }
+
+    void SmallObjectAllocator::ReleaseBatch(ThreadCache::List& list, std::size_t sizeClass)
+    {
+        // Detach the first batchSize blocks
+        const std::uint32_t batchSize = kBatchSizes[sizeClass];
+        Block* head = list.head;
+        Block* tail = head;
+        for (std::uint32_t i = 1; i < batchSize; ++i)
+            tail = tail->next;
+        list.head = tail->next;
+        list.count -= batchSize;
+        tail->next = nullptr;
+        AddOutstanding(-static_cast<std::int64_t>(batchSize) * kClassSizes[sizeClass]);
+
+        Batch* batch = reinterpret_cast<Batch*>(head);
+        CentralList& central = central_[sizeClass];
+        std::lock_guard<std::mutex> lock(central.mutex);
+        batch->nextBatch = central.batches;
+        central.batches = batch;
+    }
+
+    SmallObjectAllocator::Batch* SmallObjectAllocator::CarveSpan(std::size_t sizeClass)
+    {
+        const std::size_t blockSize = kClassSizes[sizeClass];
+        const std::size_t batchSize = kBatchSizes[sizeClass];
+        const std::size_t spanBytes = blockSize * batchSize * kBatchesPerSpan;
+        auto* span = static_cast<std::uint8_t*>(::operator new(spanBytes, std::align_val_t(kAlignment)));
+        committedBytes_.fetch_add(spanBytes, std::memory_order_relaxed);
+
+        Batch* first = nullptr;
+        for (std::size_t b = kBatchesPerSpan; b-- > 0;)
+        {
+            std::uint8_t* base = span + b * batchSize * blockSize;
+            for (std::size_t i = 0; i + 1 < batchSize; ++i)
+                reinterpret_cast<Block*>(base + i * blockSize)->next = reinterpret_cast<Block*>(base + (i + 1) * blockSize);
+            reinterpret_cast<Block*>(base + (batchSize - 1) * blockSize)->next = nullptr;
+
+            Batch* batch = reinterpret_cast<Batch*>(base);
+            batch->nextBatch = first;
+            first = batch;
+        }
+        return first;
+    }
+
+    // ------------------------------------------------------------
+    // Stats
+    // ------------------------------------------------------------
+    void SmallObjectAllocator::AddOutstanding(std::int64_t bytes)
+    {
+        // Tracked per batch, so the peak costs nothing on the fast path; it
+        // includes free blocks parked in thread caches
+        const std::int64_t outstanding = outstandingBytes_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        std::uint64_t peak = peakBytes_.load(std::memory_order_relaxed);
+        while (outstanding > 0 && static_cast<std::uint64_t>(outstanding) > peak &&
+               !peakBytes_.compare_exchange_weak(peak, static_cast<std::uint64_t>(outstanding), std::memory_order_relaxed)) {}
+    }
+
+    MemoryPoolStats SmallObjectAllocator::GetPoolStats() const
+    {
+        std::int64_t live;
+        std::uint64_t allocations;
+        {
+            std::lock_guard<std::mutex> lock(registryMutex_);
+            live = retiredLiveBytes_;
+            allocations = retiredAllocations_;
+            for (const ThreadCache* cache = caches_; cache; cache = cache->nextCache)
+            {
+                live += cache->liveBytes.load(std::memory_order_relaxed);
+                allocations += cache->allocations.load(std::memory_order_relaxed);
+            }
+        }
+
+        // Blocks freed on another thread make per-thread counts go negative;
+        // only the sum is meaningful
+        MemoryPoolStats stats;
+        stats.name = "Small Objects";
+        stats.liveBytes = static_cast<std::uint64_t>(std::max<std::int64_t>(live, 0));
+        stats.committedBytes = committedBytes_.load(std::memory_order_relaxed);
+        stats.allocations = allocations;
+
+        std::uint64_t peak = peakBytes_.load(std::memory_order_relaxed);
+        while (stats.liveBytes > peak && !peakBytes_.compare_exchange_weak(peak, stats.liveBytes, std::memory_order_relaxed)) {}
+        stats.peakBytes = std::max(peak, stats.liveBytes);
+        return stats;
+    }
+}
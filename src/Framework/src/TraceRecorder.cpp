@@ -0,0 +1,235 @@
+#include <Framework/TraceRecorder.hpp>
+#include <Framework/Logger.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace Aurum
+{
+    namespace
+    {
+        constexpr std::size_t kChunkBytes = 256 * 1024;
+        constexpr std::uint32_t kFrameTrack = 1u << 20; // Pseudo thread id for frame markers
+
+        void AppendEscaped(std::string& out, std::string_view text)
+        {
+            for (char c : text)
+            {
+                if (c == '"' || c == '\\')
+                    out += '\\';
+                if (static_cast<unsigned char>(c) < 0x20)
+                    continue;
+                out += c;
+            }
+        }
+    }
+
+    // ------------------------------------------------------------
+    // Capture Control
+    // ------------------------------------------------------------
+    TraceRecorder::TraceRecorder()
+    {
+        // Construct these first so they outlive us; ~TraceRecorder uses both
+        Profiler::Get();
+        Logger::Get();
+    }
+
+    bool TraceRecorder::Start(const std::string& path, std::uint64_t frames, std::uint64_t delayFrames)
+    {
+        Stop();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            file_ = std::fopen(path.c_str(), "wb");
+            if (!file_)
+            {
+                Logger::Get().Log("Trace capture failed to open " + path, LogLevel::Error);
+                return false;
+            }
+
+            path_ = path;
+            chunk_ = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+            firstEvent_ = true;
+            framesLeft_ = frames;
+            delayFrames_ = delayFrames;
+            origin_ = Profiler::Now();
+            depth_.clear();
+            named_.clear();
+            AppendThreadName(kFrameTrack, "Frames");
+        }
+
+        // Outside mutex_: the profiler calls back into us with its own lock held
+        Profiler::Get().SetListener(this);
+        Logger::Get().Log("Trace capture started: " + path, LogLevel::Info);
+        return true;
+    }
+
+    void TraceRecorder::Stop()
+    {
+        Profiler::Get().SetListener(nullptr);
+        std::lock_guard<std::mutex> lock(mutex_);
+        Close();
+    }
+
+    bool TraceRecorder::IsCapturing() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return file_ != nullptr;
+    }
+
+    void TraceRecorder::Close()
+    {
+        if (!file_)
+            return;
+
+        // Close zones that are still open so the viewer shows their extent
+        const std::uint64_t now = Profiler::Now();
+        for (std::uint32_t thread = 0; thread < depth_.size(); ++thread)
+        {
+            for (; depth_[thread] > 0; --depth_[thread])
+            {
+                BeginEvent();
+                chunk_ += "\"ph\":\"E\"";
+                AppendTime(now);
+                chunk_ += ",\"pid\":1,\"tid\":" + std::to_string(thread) + "}";
+            }
+        }
+
+        chunk_ += "\n]}\n";
+        FlushChunk(true);
+        std::fclose(file_);
+        file_ = nullptr;
+        Logger::Get().Log("Trace capture written: " + path_, LogLevel::Info);
+    }
+
+    // ------------------------------------------------------------
+    // Event Writing
+    // ------------------------------------------------------------
+    void TraceRecorder::BeginEvent()
+    {
+        chunk_ += firstEvent_ ? "{" : ",\n{";
+        firstEvent_ = false;
+    }
+
+    void TraceRecorder::AppendTime(std::uint64_t time)
+    {
+        char buffer[48];
+        const double us = (time > origin_) ? (time - origin_) * 1e-3 : 0.0;
+        std::snprintf(buffer, sizeof(buffer), ",\"ts\":%.3f", us);
+        chunk_ += buffer;
+    }
+
+    void TraceRecorder::AppendThreadName(std::uint32_t thread, std::string_view name)
+    {
+        BeginEvent();
+        chunk_ += "\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" + std::to_string(thread) + ",\"args\":{\"name\":\"";
+        AppendEscaped(chunk_, name);
+        chunk_ += "\"}}";
+    }
+
+    void TraceRecorder::FlushChunk(bool force)
+    {
+        if (!force && chunk_.size() < kChunkBytes)
+            return;
+        std::fwrite(chunk_.data(), 1, chunk_.size(), file_);
+        chunk_.clear();
+    }
+
+    void TraceRecorder::OnThreadEvents(const ProfileThreadTree& thread, const ProfileEvent* events, std::size_t count)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!IsRecording())
+            return;
+
+        const std::uint32_t tid = thread.thread;
+        if (depth_.size() <= tid)
+        {
+            depth_.resize(tid + 1, 0);
+            named_.resize(tid + 1, false);
+        }
+        if (!named_[tid])
+        {
+            AppendThreadName(tid, thread.name);
+            named_[tid] = true;
+        }
+
+        const std::string tidText = std::to_string(tid);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const ProfileEvent& event = events[i];
+            if (event.time < origin_)
+                continue;
+
+            if (event.site)
+            {
+                depth_[tid]++;
+                BeginEvent();
+                chunk_ += "\"name\":\"";
+                AppendEscaped(chunk_, event.site->name);
+                chunk_ += "\",\"ph\":\"B\"";
+            }
+            else if (depth_[tid] > 0)
+            {
+                // An end without a recorded begin started before the capture
+                depth_[tid]--;
+                BeginEvent();
+                chunk_ += "\"ph\":\"E\"";
+            }
+            else
+            {
+                continue;
+            }
+
+            AppendTime(event.time);
+            chunk_ += ",\"pid\":1,\"tid\":" + tidText + "}";
+        }
+        FlushChunk(false);
+    }
+
+    void TraceRecorder::OnFrameEnd(const ProfileFrame& frame)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!file_)
+            return;
+
+        if (delayFrames_ > 0)
+        {
+            if (--delayFrames_ == 0)
+                origin_ = frame.end;
+            return;
+        }
+
+        const std::uint64_t begin = std::max(frame.begin, origin_);
+        char buffer[96];
+        BeginEvent();
+        chunk_ += "\"name\":\"Frame " + std::to_string(frame.index) + "\",\"ph\":\"X\"";
+        AppendTime(begin);
+        std::snprintf(buffer, sizeof(buffer), ",\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+                      (frame.end > begin ? frame.end - begin : 0) * 1e-3, kFrameTrack);
+        chunk_ += buffer;
+        FlushChunk(false);
+
+        if (framesLeft_ > 0 && --framesLeft_ == 0)
+            Close(); // Listener stays registered but idle; Stop()/Start() replace it
+    }
+
+    void TraceRecorder::Counter(std::string_view name, double value)
+    {
+        // JSON has no NaN or infinity; a gap in the track beats a file the
+        // trace viewer refuses to load
+        if (!std::isfinite(value))
+            return;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!IsRecording())
+            return;
+
+        char buffer[64];
+        BeginEvent();
+        chunk_ += "\"name\":\"";
+        AppendEscaped(chunk_, name);
+        chunk_ += "\",\"ph\":\"C\"";
+        AppendTime(Profiler::Now());
+        std::snprintf(buffer, sizeof(buffer), ",\"pid\":1,\"args\":{\"value\":%.17g}}", value);
+        chunk_ += buffer;
+        FlushChunk(false);
+    }
+}
@@ -0,0 +1,156 @@
+#include <Framework/TscClock.hpp>
+#include <Framework/Logger.hpp>
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+
+#if !defined(_MSC_VER) && (defined(__x86_64__) || defined(__i386__))
+    #include <cpuid.h>
+#endif
+
+namespace Aurum
+{
+    namespace
+    {
+        constexpr std::uint64_t kInitialCalibrationNs = 2'000'000;   // 2 ms spin at startup
+        constexpr std::uint64_t kFirstRecalibrateNs = 100'000'000;     // Then doubling...
+        constexpr std::uint64_t kRecalibrateIntervalNs = 1'000'000'000; // ...up to once a second
+        constexpr double kMaxRateDrift = 0.01;
+
+        std::mutex& CalibrationMutex()
+        {
+            static std::mutex mutex;
+            return mutex;
+        }
+
+        // 32.32 fixed-point nanoseconds per tick
+        std::uint64_t ScaleFor(std::uint64_t ns, std::uint64_t ticks)
+        {
+            return static_cast<std::uint64_t>(std::llround(static_cast<double>(ns) / static_cast<double>(ticks) * 4294967296.0));
+        }
+    }
+
+    bool TscClock::HasInvariantCounter()
+    {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        int regs[4] = {};
+        __cpuid(regs, 0x80000000);
+        if (static_cast<unsigned>(regs[0]) < 0x80000007u)
+            return false;
+        __cpuid(regs, 0x80000007);
+        return (regs[3] & (1 << 8)) != 0;  // EDX bit 8: invariant TSC
+#elif defined(__x86_64__) || defined(__i386__)
+        unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+        if (__get_cpuid_max(0x80000000u, nullptr) < 0x80000007u)
+            return false;
+        __get_cpuid(0x80000007u, &eax, &ebx, &ecx, &edx);
+        return (edx & (1u << 8)) != 0;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+        return true; // The generic timer runs at a fixed frequency
+#else
+        return false;
+#endif
+    }
+
+    // ------------------------------------------------------------
+    // Calibration
+    // ------------------------------------------------------------
+    TscClock::State::State()
+    {
+        invariant = HasInvariantCounter();
+        if (!invariant)
+            return;
+
+        originTicks = ReadTicks();
+        originNs = SteadyNanoseconds();
+
+        std::uint64_t ticks, ns;
+        do
+        {
+            ticks = ReadTicks();
+            ns = SteadyNanoseconds();
+        } while (ns - originNs < kInitialCalibrationNs);
+
+        if (ticks <= originTicks)
+        {
+            invariant = false;
+            return;
+        }
+
+        lastCheckNs = ns;
+        intervalNs = kFirstRecalibrateNs;
+        rateScale = ScaleFor(ns - originNs, ticks - originTicks);
+        Publish(*this, ticks, ns, rateScale);
+        useTsc.store(true, std::memory_order_relaxed);
+    }
+
+    void TscClock::Publish(State& state, std::uint64_t ticks, std::uint64_t ns, std::uint64_t scale)
+    {
+        state.seq.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        state.baseTicks.store(ticks, std::memory_order_relaxed);
+        state.baseNs.store(ns, std::memory_order_relaxed);
+        state.scale.store(scale, std::memory_order_relaxed);
+        state.seq.fetch_add(1, std::memory_order_release);
+    }
+
+    void TscClock::Recalibrate()
+    {
+        State& state = GetState();
+        if (!state.invariant)
+            return;
+
+        std::lock_guard<std::mutex> lock(CalibrationMutex());
+        const std::uint64_t ns = SteadyNanoseconds();
+        if (ns - state.lastCheckNs < state.intervalNs)
+            return;
+        const std::uint64_t ticks = ReadTicks();
+        state.lastCheckNs = ns;
+
+        // Rate over the whole baseline: precision improves as it grows
+        const std::uint64_t rateScale = ScaleFor(ns - state.originNs, ticks - state.originTicks);
+        const double drift = std::abs(static_cast<double>(rateScale) - static_cast<double>(state.rateScale)) /
+                             static_cast<double>(state.rateScale);
+        if (drift > kMaxRateDrift)
+        {
+            if (state.useTsc.exchange(false, std::memory_order_relaxed))
+                Logger::Get().Log("TSC rate drifted " + std::to_string(drift * 100.0) + "%; falling back to steady_clock", LogLevel::Warning);
+            return;
+        }
+        state.rateScale = rateScale;
+
+        state.intervalNs = std::min(state.intervalNs * 2, kRecalibrateIntervalNs);
+
+        // Continue from the current reading (no jumps) and steer back onto
+        // steady_clock over the next interval. The new baseline is read
+        // while the sequence is odd: readers retry from there on, so every
+        // time handed out with the old parameters is older than it and the
+        // clock never goes backwards.
+        state.seq.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        const std::uint64_t baseTicks = ReadTicks();
+        const std::uint64_t current = ToNanoseconds(baseTicks, state.baseTicks.load(std::memory_order_relaxed),
+                                                    state.baseNs.load(std::memory_order_relaxed),
+                                                    state.scale.load(std::memory_order_relaxed));
+
+        const double offset = static_cast<double>(static_cast<std::int64_t>(current - ns));
+        const double steer = std::clamp(1.0 - offset / static_cast<double>(state.intervalNs), 0.5, 1.5);
+        state.baseTicks.store(baseTicks, std::memory_order_relaxed);
+        state.baseNs.store(current, std::memory_order_relaxed);
+        state.scale.store(static_cast<std::uint64_t>(static_cast<double>(rateScale) * steer), std::memory_order_relaxed);
+        state.seq.fetch_add(1, std::memory_order_release);
+    }
+
+    double TscClock::GetTicksPerSecond()
+    {
+        const State& state = GetState();
+        const std::uint64_t scale = state.scale.load(std::memory_order_relaxed);
+        return (state.invariant && scale) ? 1e9 * 4294967296.0 / static_cast<double>(scale) : 1e9;
+    }
+
+    void TscClock::SetEnabled(bool enabled)
+    {
+        State& state = GetState();
+        state.useTsc.store(enabled && state.invariant, std::memory_order_relaxed);
+    }
+}
@@ -50,6 +50,7 @@ protected:
         // Initialize Debug Overlay
         // --------------------------------------------
         overlay_.Initialize();
+        overlay_.SetCsvExport(runtimeConfig_.GetFrameStatsCsvPath());
 
         // Simulate initial resize event
         dispatcher.Publish(Aurum::WindowResizeEvent(1920, 1080));
@@ -72,11 +73,7 @@ protected:
             renderer->Present();
 
             // --- Optional debug output ---
-            Aurum::Logger::Get().Log(
-                "Δt: " + std::to_string(dt) + "s | RGB(" +
-                std::to_string(r) + ", " + std::to_string(g) + ", " + std::to_string(b) + ")",
-                Aurum::LogLevel::Debug
-            );
+            AURUM_LOG_DEBUG("Δt: {:.6f}s | RGB({:.3f}, {:.3f}, {:.3f})", dt, r, g, b);
         }
     }
 
@@ -0,0 +1,158 @@
+// --- aurum-logdecode ---
+// Turns binary logs written by Aurum::BinaryLogSink back into text
+// or JSON Lines (one object per record).
+//
+// Usage: aurum-logdecode [--json] [-o output] <input.alog>
+
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <Framework/Logging/BinaryLog.hpp>
+#include <Framework/Logging/LogFormat.hpp>
+#include <thirdparty/nlohmann/json.hpp>
+
+namespace
+{
+    void PrintUsage()
+    {
+        std::cerr << "Usage: aurum-logdecode [--json] [-o output] <input.alog>\n";
+    }
+
+    // "HH:MM:SS.mmm" in local time
+    std::string FormatWallTime(std::int64_t wallNs)
+    {
+        const std::time_t seconds = static_cast<std::time_t>(wallNs / 1000000000);
+        const int millis = static_cast<int>((wallNs / 1000000) % 1000);
+
+        char clock[16] = {};
+        std::strftime(clock, sizeof(clock), "%H:%M:%S", std::localtime(&seconds));
+
+        char result[24] = {};
+        std::snprintf(result, sizeof(result), "%s.%03d", clock, millis);
+        return result;
+    }
+
+    nlohmann::json DecodeArgs(std::string_view args)
+    {
+        nlohmann::json out = nlohmann::json::array();
+        Aurum::LogArgValue value;
+        while (Aurum::ReadLogArg(args, value))
+        {
+            switch (value.type)
+            {
+                case Aurum::LogArgType::Int64:  out.push_back(value.i); break;
+                case Aurum::LogArgType::UInt64: out.push_back(value.u); break;
+                case Aurum::LogArgType::Double: out.push_back(value.d); break;
+                case Aurum::LogArgType::Float:  out.push_back(value.f); break;
+                case Aurum::LogArgType::Bool:   out.push_back(value.u != 0); break;
+                case Aurum::LogArgType::Char:
+                case Aurum::LogArgType::String: out.push_back(std::string(value.s)); break;
+            }
+        }
+        return out;
+    }
+
+    std::string LevelName(Aurum::LogLevel level)
+    {
+        // "[INFO]" -> "INFO"
+        std::string name = Aurum::LogLevelToString(level);
+        return name.substr(1, name.size() - 2);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    bool json = false;
+    std::string inputPath;
+    std::string outputPath;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if (arg == "--json")
+            json = true;
+        else if (arg == "-o" && i + 1 < argc)
+            outputPath = argv[++i];
+        else if (arg == "-h" || arg == "--help")
+        {
+            PrintUsage();
+            return 0;
+        }
+        else if (inputPath.empty())
+            inputPath = arg;
+        else
+        {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    if (inputPath.empty())
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    Aurum::BinaryLogReader reader;
+    if (!reader.Open(inputPath))
+    {
+        std::cerr << "aurum-logdecode: " << reader.GetError() << "\n";
+        return 1;
+    }
+
+    std::ofstream outputFile;
+    if (!outputPath.empty())
+    {
+        outputFile.open(outputPath, std::ios::out | std::ios::trunc);
+        if (!outputFile.is_open())
+        {
+            std::cerr << "aurum-logdecode: cannot open " << outputPath << "\n";
+            return 1;
+        }
+    }
+    std::ostream& out = outputPath.empty() ? std::cout : outputFile;
+
+    Aurum::BinaryLogEntry entry;
+    std::string message;
+    std::size_t count = 0;
+
+    while (reader.Next(entry))
+    {
+        message.clear();
+        Aurum::BinaryLogReader::FormatMessage(entry, message);
+
+        if (json)
+        {
+            nlohmann::json line;
+            line["time_ns"] = entry.wallNs;
+            line["time"] = FormatWallTime(entry.wallNs);
+            line["level"] = LevelName(entry.level);
+            line["thread"] = entry.threadId;
+            line["message"] = message;
+            if (entry.format)
+            {
+                line["file"] = entry.format->file;
+                line["line"] = entry.format->line;
+                line["format"] = entry.format->format;
+                line["args"] = DecodeArgs(entry.args);
+            }
+            out << line.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace) << '\n';
+        }
+        else
+        {
+            out << '[' << FormatWallTime(entry.wallNs) << "] "
+                << Aurum::LogLevelToString(entry.level)
+                << " [T" << entry.threadId << "]: " << message << '\n';
+        }
+        ++count;
+    }
+
+    if (!reader.GetError().empty())
+    {
+        std::cerr << "aurum-logdecode: " << reader.GetError() << " (after " << count << " records)\n";
+        return 2;
+    }
+    return 0;
+}